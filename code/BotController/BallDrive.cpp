@@ -7,12 +7,16 @@
 
 #include <BallDrive.h>
 #include <types.h>
+#include <Profiler.h>
+#include <DebugLog.h>
+#include <libraries/DeferredLog.h>
 
 void BallDrive::setup(MenuController* menuCtrl) {
 	// register out menu
 	registerMenuController(menuCtrl);
 	engine.setup(menuCtrl);
 	kinematics.setup();
+	odometry.setup(&kinematics);
 	reset();
 }
 
@@ -38,80 +42,46 @@ void BallDrive::printHelp() {
 }
 
 void BallDrive::setSpeed(float speedX, float speedY, float omega,
-		 	 	 	 	 float angleX, float angleY) {
+		 	 	 	 	 float angleX, float angleY, uint32_t sampleTime_us) {
 
 	// apply kinematics to compute wheel speed out of x,y, omega
 	float  newWheelSpeed[3] = { 0, 0, 0};
-	kinematics.computeWheelSpeed(speedX, speedY, omega,
- 							angleX,angleY,
-							newWheelSpeed);
-
-	/*
-	log("kinematics:(");
-	log(speedX);
-	log(",");
-	log(speedY);
-	log(",");
-	log(omega);
-	log(")->(");
-	log(newWheelSpeed[0]);
-	log(",");
-	log(newWheelSpeed[1]);
-	log(",");
-	log(newWheelSpeed[2]);
-	logln(")");
-
-	// send new speed to motors
-	logging("new wheelspeed");
-	logging(newWheelSpeed[0],3,3);
-	logging(",");
-	logging(newWheelSpeed[1],3,3);
-	logging(",");
-	logging(newWheelSpeed[2],3,3);
-	loggingln("");
-	*/
-
-	engine.setWheelSpeed(newWheelSpeed);
+	{
+		ProfileScope scope(PROFILE_KINEMATICS);
+		kinematics.computeWheelSpeed(speedX, speedY, omega,
+	 							angleX,angleY,
+								newWheelSpeed);
+	}
+
+	if (LOG_ENABLED(LOG_LEVEL_DEBUG, LOG_KINEMATICS) && kinematicsLogTimer.isDue_ms(100, millis())) {
+		LogCost cost(LOG_KINEMATICS);
+		deferredLog.log("kinematics:({2.3},{2.3},{2.3})->({3.3},{3.3},{3.3})\n",
+						speedX, speedY, omega, newWheelSpeed[0], newWheelSpeed[1], newWheelSpeed[2]);
+	}
+
+	for (int i = 0;i<3;i++)
+		wheelSpeedSetpoint[i] = newWheelSpeed[i];
+	engine.setWheelSpeed(newWheelSpeed, sampleTime_us);
 }
 
 // compute the current speed since the last invocation.
 // returns 0 when called first (assuming the we start without motion)
-void BallDrive::getSpeed(const IMUSample &sample, BotMovement &current) {
+void BallDrive::getSpeed(uint64_t now_us, const IMUSample &sample, BotMovement &current) {
+	ProfileScope scope(PROFILE_GET_SPEED);
 
-	// this function required
-	uint32_t now = millis();
-	if ((now > lastCall_ms) && (lastCall_ms > 0))  {
-		float dT = ((float)(now - lastCall_ms))/1000.0; // [s]
-		lastCall_ms = now;
+	if ((now_us > lastCall_us) && (lastCall_us > 0))  {
+		float dT = MicroClock::seconds(now_us - lastCall_us); // [s]
+		lastCall_us = now_us;
 
 		// fetch motor encoder values to compute real wheel position
 		float angleChange[3] = {0,0,0};
 		engine.getWheelAngleChange(angleChange);
-
-		float currentWheelSpeed[3];
-		// @TODO bug: wheelspeed = (angleChange / (TWO_PI*dT))
-		currentWheelSpeed[0] = angleChange[0]  / dT;	// compute wheel speed out of delta-angle
-		currentWheelSpeed[1] = angleChange[1]  / dT;
-		currentWheelSpeed[2] = angleChange[2]  / dT;
-
-		// apply inverse kinematics to get { speed (x,y), omega } out of wheel speed
-		kinematics.computeActualSpeed(  currentWheelSpeed,
-										sample.plane[X].angle, sample.plane[Y].angle,
-										current.x.speed, current.y.speed, current.omega);
-
-		current.x.pos += dT*current.x.speed;
-		current.y.pos += dT*current.y.speed;
-		current.x.accel = (current.x.speed - lastSpeedX)/dT;
-		current.y.accel = (current.y.speed - lastSpeedY)/dT;
-		lastSpeedX = current.x.speed;
-		lastSpeedY = current.y.speed;
-	} else {
-		lastSpeedX = current.x.speed;
-		lastSpeedY = current.y.speed;
-	}
+		odometry.update(dT, angleChange, sample, current);
+	} else
+		odometry.reset(current);
 }
 
-void BallDrive::loop(uint32_t now_us) {
+void BallDrive::loop(uint64_t now_us) {
 	// drive the motors
 	// due to use of brushless motors, this requires permanent invokation of loop
 	engine.loop(now_us);
@@ -224,7 +194,7 @@ void BallDrive::menuLoop(char ch, bool continously) {
 		logging(")");
 
 		IMUSample a(IMUSamplePlane(menuAngleX,0), IMUSamplePlane(menuAngleY,0),IMUSamplePlane(0,menuOmega));
-		getSpeed(a,  menuMovement);
+		getSpeed(MicroClock::now_us(), a,  menuMovement);
 		menuMovement.print();
 
 		command->println(" >");
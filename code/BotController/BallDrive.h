@@ -17,6 +17,9 @@
 #include <PowerRelay.h>
 #include <types.h>
 #include <IMU.h>
+#include <Odometry.h>
+#include <MicroClock.h>
+#include <TimePassedBy.h>
 
 class BallDrive : public Menuable {
 public:
@@ -24,7 +27,7 @@ public:
 	virtual ~BallDrive() {};
 
 	void setup(MenuController* menuCtrl);
-	void loop(uint32_t now_us);
+	void loop(uint64_t now_us);
 
 	void enable(bool doit) {
 		engine.enable(doit);
@@ -44,7 +47,7 @@ public:
 	// set delta wheel angle to zero
 	void reset() {
 		engine.resetWheelAngleChange();
-		lastCall_ms = millis();
+		lastCall_us = MicroClock::now_us();
 
 		// set speed to zero
 		float wheelSpeed[3] = {0,0,0};
@@ -52,15 +55,26 @@ public:
 	}
 
 	// Set the speed of the ball drive in terms of a cartesic coord system.
-	// Considers the tilt angle in computation
-	void setSpeed(float speedX /* [m/s] */,float speedY /* [m/s] */, float omega, float angleX, float angleY);
+	// Considers the tilt angle in computation. sampleTime_us is the time of the underlying IMU sample (if any)
+	void setSpeed(float speedX /* [m/s] */,float speedY /* [m/s] */, float omega, float angleX, float angleY, uint32_t sampleTime_us = 0);
 
 	// return speed as measured by encoders (might be different from speed set in method above)
-	void getSpeed(const IMUSample &sample,BotMovement &current);
+	// now_us is the time of the current tick
+	void getSpeed(uint64_t now_us, const IMUSample &sample,BotMovement &current);
+
+	// return wheel speeds [rev/s] as computed in the last setSpeed
+	void getWheelSpeedSetpoint(float wheelSpeed[3]) {
+		for (int i = 0;i<3;i++)
+			wheelSpeed[i] = wheelSpeedSetpoint[i];
+	}
 
 	// return tilt angles as set in setSpeed
 	void getSetAngle(float &angleX, float &angleY);
 
+	// time of the last getSpeed [us], and the motors, used for sensor recordings
+	uint64_t getLastCall_us() { return lastCall_us; };
+	Engine& getEngine() { return engine; };
+
 	// ascii menu, menu commands are implemented there
 	virtual void menuLoop(char ch, bool continously);
 
@@ -70,11 +84,12 @@ public:
 private:
 	Engine engine;				// three independent motors
 	Kinematix kinematics;		// computation of speedx/speedy/omega into wheel speed
+	Odometry odometry;			// computation of the current movement out of the encoders
 	PowerRelay powerRelay;		// turn on/off power for motors
 
-	uint32_t lastCall_ms = 0;	// used by getSpeed to compute time since last call
-	float lastSpeedX = 0;		// used by getSpeed
-	float lastSpeedY = 0;
+	uint64_t lastCall_us = 0;	// used by getSpeed to compute time since last call
+	float wheelSpeedSetpoint[3] = {0,0,0};	// last wheel speed passed to the engine [rev/s]
+	TimePassedBy kinematicsLogTimer;
 
 	// current movement of bot in terms of position and speed
 	BotMovement menuMovement;
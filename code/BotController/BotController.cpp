@@ -12,6 +12,16 @@
 #include <BotController.h>
 #include <BotMemory.h>
 #include <TimePassedBy.h>
+#include <MicroClock.h>
+#include <Profiler.h>
+#include <LatencyTracer.h>
+#include <LoadGovernor.h>
+#include <FlightRecorder.h>
+#include <libraries/DeferredLog.h>
+#include <libraries/BufferedSerial.h>
+#include <DebugLog.h>
+#include <Telemetry.h>
+#include <SensorRecording.h>
 
 const int LifterEnablePin = 31;
 const int LifterIn1Pin = 29;
@@ -22,19 +32,80 @@ const int LifterCurrentSensePin = A22;
 
 const int LifterCPR = 48;
 
+// periods [us] and budgets [us] of all tasks run by the scheduler, priority 0 is the most important one.
+// The IMU's data-ready flag is polled with 1kHz, the balancing part runs whenever a new sample is there,
+// i.e. with SampleFrequency
+const uint32_t BalanceTaskPeriod_us 	= 1000;
+const uint32_t BalanceTaskBudget_us 	= 800;		// below the period, otherwise an overrun is never reported
+const uint32_t CommutationTaskPeriod_us = 1000000/MaxBrushlessDriverFrequency;
+const uint32_t CommutationTaskBudget_us = 300;
+const uint32_t LifterTaskPeriod_us 		= 1000000/SampleFrequency;
+const uint32_t LifterTaskBudget_us 		= 200;
+const uint32_t LifterTaskPeriodShed_us 	= 4*LifterTaskPeriod_us;	// period of lifter when the load governor sheds it
+const uint32_t SerialTaskPeriod_us 		= 1000;
+const uint32_t SerialTaskBudget_us 		= 100;
+const uint32_t MenuTaskPeriod_us 		= 5000;
+const uint32_t MenuTaskBudget_us 		= 1000;
+const uint32_t MemoryTaskPeriod_us 		= 100000;
+const uint32_t MemoryTaskBudget_us 		= 1000;
+const uint32_t LogTaskPeriod_us 		= 200000;
+const uint32_t LogTaskBudget_us 		= 1000;
+const uint32_t LogFlushTaskPeriod_us 	= 5000;
+const uint32_t LogFlushTaskBudget_us 	= 1000;
+const int LogFlushEntries 				= 4;		// max number of deferred log entries printed per flush
+const uint32_t DumpTaskPeriod_us 		= 5000;
+const uint32_t DumpTaskBudget_us 		= 1000;
+const int DumpRecords 					= 4;		// max number of flight records printed per run
+
 void BotController::setup() {
 	registerMenuController(&menuController);
 
 	ballDrive.setup(&menuController);
 	imu.setup(&menuController);
-	state.setup(&menuController);
+	state.setup(&menuController, []() {
+		BotController& bc = BotController::getInstance();
+		bc.balanceMode(bc.isBalancing()?OFF:BALANCING);
+		return bc.isBalancing();
+	});
 	lifter.setup(&menuController);
 	lifter.setupMotor(LifterEnablePin, LifterIn1Pin, LifterIn2Pin,LifterCurrentSensePin);
 	lifter.setupEncoder(LifterEncoderAPin, LifterEncoderBPin, LifterCPR);
 
 	performanceLogTimer.setRate(5000);
-
-
+	profiler.setup();
+	setFatalErrorHook([](const char s[]) { flightRecorder.freeze(s); });
+	loadGovernor.setup(1000000/SampleFrequency);
+	// a tier is held longer than the period of the work it sheds, so shedding can take effect before escalating
+	loadGovernor.setDwell(LOAD_SHED_DEBUG_LOG, 2*LogTaskPeriod_us);
+	loadGovernor.setDwell(LOAD_SHED_MEMORY, 2*MemoryTaskPeriod_us);
+
+	// register all tasks, the balancing part has the highest priority, followed by the motors
+	scheduler.setup();
+	scheduler.addTask("balance", BalanceTaskPeriod_us, 0, BalanceTaskBudget_us,
+			[](uint64_t now_us) { BotController::getInstance().balanceTask(now_us); });
+	scheduler.addTask("motor", CommutationTaskPeriod_us, 1, CommutationTaskBudget_us,
+			[](uint64_t now_us) { BotController::getInstance().commutationTask(now_us); });
+	lifterTaskId = scheduler.addTask("lifter", LifterTaskPeriod_us, 2, LifterTaskBudget_us,
+			[](uint64_t now_us) { BotController::getInstance().lifter.loop(); });
+	scheduler.addTask("serial", SerialTaskPeriod_us, 3, SerialTaskBudget_us,
+			[](uint64_t now_us) { bufferedSerial.loop(); });
+	scheduler.addTask("menu", MenuTaskPeriod_us, 3, MenuTaskBudget_us,
+			[](uint64_t now_us) {
+				ProfileScope scope(PROFILE_MENU);
+				BotController::getInstance().menuController.loop();
+			});
+	scheduler.addTask("memory", MemoryTaskPeriod_us, 4, MemoryTaskBudget_us,
+			[](uint64_t now_us) {
+				// saving is deferred under high load, dirty data is written once the governor allows it again
+				if (!loadGovernor.sheds(LOAD_SHED_MEMORY))
+					memory.loop(now_us/1000);
+			});
+	scheduler.addTask("log", LogTaskPeriod_us, 5, LogTaskBudget_us,
+			[](uint64_t now_us) { BotController::getInstance().logTask(now_us); });
+	scheduler.addTask("logflush", LogFlushTaskPeriod_us, 6, LogFlushTaskBudget_us,
+			[](uint64_t now_us) { deferredLog.flush(LogFlushEntries); });
+	scheduler.addTask("dump", DumpTaskPeriod_us, 6, DumpTaskBudget_us,
+			[](uint64_t now_us) { flightRecorder.dumpLoop(DumpRecords); });
 }
 
 void BotController::printHelp() {
@@ -51,10 +122,17 @@ void BotController::printHelp() {
 	command->println("t - set trajectory");
 
 	command->println();
-	command->println("1 - performance log on");
+	command->println("1 - performance log on/off (off prints profile and latency)");
 	command->println("2 - calibration log on");
 	command->println("3 - debug log on");
 	command->println("4 - state log on");
+	command->println("5 - motor log on/off");
+	command->println("6 - kinematics log on/off");
+
+	command->println("T - binary telemetry on/off");
+	command->println("R - sensor recording on/off (starts with next balancing)");
+	command->println("f - dump flight recorder (freezes it)");
+	command->println("F - restart flight recorder");
 
 	command->println("m - save configuration to epprom");
 	command->println("M - reset to factory settings");
@@ -120,18 +198,55 @@ void BotController::menuLoop(char ch, bool continously) {
 		break;
 	}
 	case '1':
-		memory.persistentMem.logConfig.performanceLog = !memory.persistentMem.logConfig.performanceLog;
+		if (toggleLogCategory(LOG_PERF)) {
+			profiler.reset();
+			latencyTracer.reset();
+			loadGovernor.reset();
+			bufferedSerial.resetStatistics();
+			logCost.reset();
+		} else {
+			profiler.print();
+			latencyTracer.print();
+		}
 		break;
 	case '2':
-		memory.persistentMem.logConfig.calibrationLog = !memory.persistentMem.logConfig.calibrationLog;
+		toggleLogCategory(LOG_CALIBRATION);
 		break;
 	case '3':
-		memory.persistentMem.logConfig.debugBalanceLog = !memory.persistentMem.logConfig.debugBalanceLog;
+		toggleLogCategory(LOG_BALANCE);
 		break;
 	case '4':
-		memory.persistentMem.logConfig.debugStateLog = !memory.persistentMem.logConfig.debugStateLog;
+		toggleLogCategory(LOG_STATE);
+		break;
+	case '5':
+		logger->print("motor log ");
+		logger->println(toggleLogCategory(LOG_MOTOR)?"on":"off");
+		break;
+	case '6':
+		logger->print("kinematics log ");
+		logger->println(toggleLogCategory(LOG_KINEMATICS)?"on":"off");
 		break;
 
+	case 'T':
+		telemetryOn = !telemetryOn;
+		logger->print("binary telemetry ");
+		logger->println(telemetryOn?"on":"off");
+		break;
+	case 'R':
+		sensorRecordingOn = !sensorRecordingOn;
+		if (!sensorRecordingOn)
+			sensorRecording = false;
+		logger->print("sensor recording ");
+		logger->println(sensorRecordingOn?"on":"off");
+		break;
+	case 'f':
+		flightRecorder.freeze("menu");
+		flightRecorder.startDump();
+		break;
+	case 'F':
+		flightRecorder.reset();
+		logger->println("flight recorder restarted");
+		break;
 	case 'h':
 		printHelp();
 		loggingln();
@@ -152,89 +267,207 @@ void BotController::setTarget(const BotMovement& target) {
 
 
 void BotController::loop() {
-	// performance measurement
-	uint32_t start_us = micros();
-
 	// give other libraries some time
 	yield();
 
+	// execute the most important task that is due
+	scheduler.loop();
+}
+
+void BotController::commutationTask(uint64_t now_us) {
 	// drive motors
-	ballDrive.loop(start_us);
+	ballDrive.loop(now_us);
+}
 
-	// react on serial line
-	menuController.loop();
+void BotController::balanceTask(uint64_t now_us) {
+	// check the slack of the loop and shed non-critical work if necessary
+	if (loadGovernor.update(now_us, scheduler.getBusyTime()))
+		scheduler.setPeriod(lifterTaskId, loadGovernor.sheds(LOAD_SHED_LIFTER)?LifterTaskPeriodShed_us:LifterTaskPeriod_us);
 
 	// check if new IMU orientation is there
-	imu.loop();
-	IMUSample sensorSample = imu.getSample();
-
-	ballDrive.loop(start_us);
-
-	// drive the lifter
-	lifter.loop();
+	imu.loop(now_us);
+	sensorSample = imu.getSample();
+	bool imuUpdated = (imu.getLastUpdate_us() == now_us);
 
 	// run main balance loop. Timing is determined by IMU that sends an
 	// interrupt everytime a new value is there.
 	float dT = 0; // set by isNewValueAvailable
 	if ((mode == BALANCING) && imu.isNewValueAvailable(dT)) {
+		balanceDT = dT;
+		latencyTracer.add(LATENCY_IMU_READ, sensorSample.timestamp_us);
 
 		// apply inverse kinematics to get { speed (x,y), omega } out of wheel speed
-		ballDrive.getSpeed(sensorSample,currentMovement);
+		ballDrive.getSpeed(now_us, sensorSample,currentMovement);
 
-		// call balance and speed controller
+		// call balance and speed controller, the lifter's position is part of the operating point of the gain schedule
+		state.setLifterPosition(lifter.getMotorAngle());
 		state.update(dT, sensorSample, currentMovement, targetBotMovement);
+		latencyTracer.add(LATENCY_STATE_UPDATE, sensorSample.timestamp_us);
 
 		// apply kinematics to compute wheel speed out of x,y, omega
-		// and set speed of each wheel
+		// and set speed of each wheel. The PWM latency is traced by the engine with the next commutation
 		ballDrive.setSpeed( state.getSpeedX(), state.getSpeedY(), state.getOmega(),
-				            sensorSample.plane[Dimension::X].angle,sensorSample.plane[Dimension::Y].angle);
-
-		uint32_t end_us= micros();
-		avrLoopTime = (((float)(end_us-start_us))/1000000.0 + avrLoopTime)/2.0;
-
-		if (logTimer.isDue_ms(200,millis())) {
-			if (memory.persistentMem.logConfig.debugBalanceLog) {
-				logging("a=(");
-				logging(degrees(sensorSample.plane[Dimension::X].angle),3,1);
-				logging(",");
-				logging(degrees(sensorSample.plane[Dimension::X].angularVelocity),3,1);
-				logging(",");
-				logging(currentMovement.x.pos,2,3);
-				logging(",");
-				logging(currentMovement.x.speed,2,3);
-				logging("|");
-				logging(degrees(sensorSample.plane[Dimension::Y].angle),3,1);
-				logging(",");
-				logging(degrees(sensorSample.plane[Dimension::Y].angularVelocity),3,1);
-				logging(",");
-				logging(currentMovement.y.pos,2,3);
-				logging(",");
-				logging(currentMovement.y.speed,2,3);
-				logging(") ");
-				// currentMovement.print();
-				logging(" state=(");
-				logging(state.getSpeedX(),2,3);
-				logging(",");
-				logging(state.getAccelX(),2,3);
-				logging("|");
-				logging(state.getSpeedY(),2,3);
-				logging(",");
-				logging(state.getAccelY(),2,3);
-				logging("|");
-				logging(state.getOmega(),2,3);
-				logging(")");
-			}
-			if (memory.persistentMem.logConfig.performanceLog) {
-				logger->print(" t=(dT=");
-				logger->print(dT*1000000.0);
-				logger->print("us, cpu=");
-				logger->print((avrLoopTime / SamplingTime) * 100.0,0);
-				logger->println("%)");
-			}
-		}
+				            sensorSample.plane[Dimension::X].angle,sensorSample.plane[Dimension::Y].angle,
+							sensorSample.timestamp_us);
+		latencyTracer.add(LATENCY_SET_SPEED, sensorSample.timestamp_us);
+
+		uint32_t loopTime_us = (uint32_t)(MicroClock::now_us()-now_us);
+		avrLoopTime = (MicroClock::seconds(loopTime_us) + avrLoopTime)/2.0;
+
+		// keep the last seconds, stop recording when the bot tilts over
+		float wheelSpeed[3];
+		ballDrive.getWheelSpeedSetpoint(wheelSpeed);
+		flightRecorder.record(sensorSample, currentMovement, targetBotMovement,
+							  state.getPlaneX(), state.getPlaneY(), wheelSpeed, dT, loopTime_us);
+		if ((abs(sensorSample.plane[Dimension::X].angle) > MaxTiltAngle) ||
+			(abs(sensorSample.plane[Dimension::Y].angle) > MaxTiltAngle))
+			flightRecorder.freeze("tilt");
+
+		if (telemetryOn)
+			sendTelemetry(wheelSpeed);
+		if (sensorRecording)
+			recordSensors(now_us, imuUpdated);
+	}
+}
 
+void BotController::sendTelemetry(const float wheelSpeed[3]) {
+	TelemetryRecord record;
+	record.version = TelemetryVersion;
+	record.sequence = telemetrySequence++;
+	record.time_us = sensorSample.timestamp_us;
+	const ControlPlane* plane[2] = { &state.getPlaneX(), &state.getPlaneY() };
+	const State* current[2] = { &currentMovement.x, &currentMovement.y };
+	for (int i = 0;i<2;i++) {
+		TelemetryPlane& p = record.plane[i];
+		p.angle 			= telemetryFixed(sensorSample.plane[i].angle, TelemetryAngleScale);
+		p.angularVelocity 	= telemetryFixed(sensorSample.plane[i].angularVelocity, TelemetryAngularVelocityScale);
+		p.ballPos 			= telemetryFixed(current[i]->pos, TelemetryPosScale);
+		p.ballSpeed 		= telemetryFixed(current[i]->speed, TelemetrySpeedScale);
+		p.ballAccel 		= telemetryFixed(current[i]->accel, TelemetryAccelScale);
+		p.outputAccel 		= telemetryFixed(plane[i]->accel, TelemetryAccelScale);
+		p.outputSpeed 		= telemetryFixed(plane[i]->filteredSpeed, TelemetrySpeedScale);
 	}
+	record.omega = telemetryFixed(state.getOmega(), TelemetryOmegaScale);
+	for (int i = 0;i<3;i++)
+		record.wheelSpeed[i] = telemetryFixed(wheelSpeed[i], TelemetryWheelSpeedScale);
+
+	// the frame is dropped as a whole if the serial buffer is full, the decoder sees the gap in the sequence
+	uint8_t frame[TelemetryMaxFrameSize];
+	size_t len = telemetryEncodeFrame(record, frame);
+	logger->write(frame, len);
 }
 
+void BotController::startSensorRecording() {
+	SensorRecordingHeader header;
+	memset(&header, 0, sizeof(header));		// padding too, so the frame is reproducible
+	header.type = SENSOR_RECORD_HEADER;
+	header.version = SensorRecordingVersion;
+	header.layoutVersion = PersistentMemLayoutVersion;
+	memcpy(header.persistentMem, &memory.persistentMem, sizeof(header.persistentMem));
+
+	// state of IMU and odometry right after the reset, the next tick continues from here
+	IMUFrontend& frontend = imu.getFrontend();
+	header.imuCalibration = frontend.getCalibration();
+	frontend.getState(header.kalman);
+	for (int i = 0;i<3;i++) {
+		header.imuSample[i][0] = imu.getSample().plane[i].angle;
+		header.imuSample[i][1] = imu.getSample().plane[i].angularVelocity;
+	}
+	header.imuDT = imu.getDT();
+	header.imuUpdate_us = (uint32_t)imu.getLastUpdate_us();
+	header.odometryUpdate_us = (uint32_t)ballDrive.getLastCall_us();
+	ballDrive.getEngine().getLastWheelAngle(header.lastWheelAngle);
+	for (int i = 0;i<3;i++)
+		header.reverse[i] = ballDrive.getEngine().isReverse(i);
+
+	uint8_t frame[telemetryFrameSize<SensorRecordingHeader>()];
+	size_t len = telemetryEncodeFrame(header, frame);
+	logger->write(frame, len);
+
+	sensorSequence = 0;
+	sensorRecording = true;
+	sendSensorTarget();
+}
 
+void BotController::sendSensorTarget() {
+	SensorRecordingTarget record;
+	memset(&record, 0, sizeof(record));
+	record.type = SENSOR_RECORD_TARGET;
+	const State* target[2] = { &targetBotMovement.x, &targetBotMovement.y };
+	for (int i = 0;i<2;i++) {
+		record.state[i][0] = target[i]->pos;
+		record.state[i][1] = target[i]->speed;
+		record.state[i][2] = target[i]->accel;
+	}
+	record.omega = targetBotMovement.omega;
+	recordedTarget = targetBotMovement;
+
+	uint8_t frame[telemetryFrameSize<SensorRecordingTarget>()];
+	size_t len = telemetryEncodeFrame(record, frame);
+	logger->write(frame, len);
+}
 
+void BotController::recordSensors(uint64_t now_us, bool imuUpdated) {
+	// the target is recorded only when it changes
+	const BotMovement& t = targetBotMovement;
+	const BotMovement& r = recordedTarget;
+	if ((t.x.pos != r.x.pos) || (t.x.speed != r.x.speed) || (t.x.accel != r.x.accel) ||
+		(t.y.pos != r.y.pos) || (t.y.speed != r.y.speed) || (t.y.accel != r.y.accel) ||
+		(t.omega != r.omega))
+		sendSensorTarget();
+
+	SensorRecordingSample record;
+	record.type = SENSOR_RECORD_SAMPLE;
+	record.imuUpdated = imuUpdated;
+	record.sequence = sensorSequence++;
+	record.tick_us = (uint32_t)now_us;
+	record.timestamp_us = sensorSample.timestamp_us;
+	imu.getCounts(record.accel, record.gyro);
+
+	// the encoders have not been read since getSpeed, these are the counts the odometry used
+	ballDrive.getEngine().getEncoderCounts(record.encoder);
+
+	// dropped as a whole if the serial buffer is full, the replay stops at the gap
+	uint8_t frame[telemetryFrameSize<SensorRecordingSample>()];
+	size_t len = telemetryEncodeFrame(record, frame);
+	logger->write(frame, len);
+}
+
+void BotController::logTask(uint64_t now_us) {
+	if (mode == BALANCING) {
+		if (LOG_ENABLED(LOG_LEVEL_DEBUG, LOG_BALANCE) && !loadGovernor.sheds(LOAD_SHED_DEBUG_LOG)) {
+			LogCost cost(LOG_BALANCE);
+			deferredLog.log("a=({3.1},{3.1},{2.3},{2.3}|",
+					degrees(sensorSample.plane[Dimension::X].angle), degrees(sensorSample.plane[Dimension::X].angularVelocity),
+					currentMovement.x.pos, currentMovement.x.speed);
+			deferredLog.log("{3.1},{3.1},{2.3},{2.3}) ",
+					degrees(sensorSample.plane[Dimension::Y].angle), degrees(sensorSample.plane[Dimension::Y].angularVelocity),
+					currentMovement.y.pos, currentMovement.y.speed);
+			// currentMovement.print();
+			deferredLog.log(" state=({2.3},{2.3}|{2.3},{2.3}|{2.3})",
+					state.getSpeedX(), state.getAccelX(), state.getSpeedY(), state.getAccelY(), state.getOmega());
+		}
+		if (LOG_ENABLED(LOG_LEVEL_INFO, LOG_PERF)) {
+			LogCost cost(LOG_PERF);
+			deferredLog.log(" t=(dT={}us, cpu={0.0}%)\n", balanceDT*1000000.0, (avrLoopTime / SamplingTime) * 100.0);
+		}
+	}
+
+	// print the statistics of the scheduler, the load governor, the profiler and the latency every now and then
+	if (LOG_ENABLED(LOG_LEVEL_INFO, LOG_PERF) && performanceLogTimer.isDue()) {
+		deferredLog.flush(); // keep the sequence of the output
+		if (deferredLog.getDropped() > 0) {
+			logging("deferred log dropped ");
+			loggingln((int)deferredLog.getDropped());
+		}
+		bufferedSerial.printStatistics();
+		scheduler.print();
+		loadGovernor.print();
+		profiler.print();
+		profiler.reset();
+		latencyTracer.print();
+		latencyTracer.reset();
+		logCost.print();
+		logCost.reset();
+	}
+}
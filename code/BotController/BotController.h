@@ -17,6 +17,8 @@
 #include <BrushedMotorDriver.h>
 #include <PowerRelay.h>
 #include <TimePassedBy.h>
+#include <libraries/TaskScheduler.h>
+#include <libraries/BufferedSerial.h>
 
 class BotController : public Menuable {
 public:
@@ -33,7 +35,8 @@ public:
 	void setup();
 
 	// to be called in main loop as often as possible.
-	// takes are of fetching the IMU values and doing the balancing part
+	// runs the scheduler that takes care of fetching the IMU values, doing the balancing part,
+	// driving the motors and all the other stuff
 	void loop();
 
 	virtual ~BotController() {};
@@ -71,6 +74,15 @@ public:
 		ballDrive.reset();
 		state.reset();
 		currentMovement.reset();
+
+		// a sensor recording covers one balancing run from its start
+		sensorRecording = false;
+		if ((mode == BALANCING) && sensorRecordingOn)
+			startSensorRecording();
+
+		// while balancing, output must not block the loop and is dropped if the buffer is full.
+		// Otherwise menus, help texts and dumps are complete
+		bufferedSerial.setPolicy((mode == BALANCING)?BufferedSerial::DROP_ON_FULL:BufferedSerial::BLOCK_ON_FULL);
 	}
 
 	void setTarget(const BotMovement& target);
@@ -82,6 +94,20 @@ public:
 private:
 	BotController() {};
 
+	// tasks executed by the scheduler
+	void balanceTask(uint64_t now_us);
+	void commutationTask(uint64_t now_us);
+	void logTask(uint64_t now_us);
+
+	// send one binary telemetry record of the current balancing tick
+	void sendTelemetry(const float wheelSpeed[3]);
+
+	// sensor recording (see SensorRecording.h), the header is sent when balancing starts,
+	// then the raw readings of every balancing tick
+	void startSensorRecording();
+	void recordSensors(uint64_t now_us, bool imuUpdated);
+	void sendSensorTarget();
+
 	BallDrive ballDrive;
 	MenuController menuController;
 	IMU imu;
@@ -91,8 +117,17 @@ private:
 	BrushedMotorDriver lifter;
 	TimePassedBy performanceLogTimer;
 	BotMode mode = OFF;
-	TimePassedBy logTimer;
+	TaskScheduler scheduler;
+	int lifterTaskId = 0;
+	IMUSample sensorSample;
+	float balanceDT = 0;			// [s] time between the last two balancing loops
 	float avrLoopTime = 0;
+	bool telemetryOn = false;		// not persistent, switched on in the menu only
+	uint16_t telemetrySequence = 0;
+	bool sensorRecordingOn = false;	// not persistent, recording starts with the next balancing
+	bool sensorRecording = false;	// recording of the current balancing run is running
+	uint16_t sensorSequence = 0;
+	BotMovement recordedTarget;		// target as of the last target record
 };
 
 #endif /* BOTCONTROLLER_H_ */
@@ -5,13 +5,14 @@
 BotMemory memory;
 
 BotMemory::BotMemory()
-: MemoryBase((void*)&(persistentMem),sizeof(BotMemory::persistentMem)) {
+: MemoryBase((void*)&(persistentMem),sizeof(BotMemory::persistentMem), PersistentMemLayoutVersion) {
 	// initialization for the very first start, when EEPROM is not yet initialized
 	BotMemory::setDefaults();
 }
 
 void BotMemory::setDefaults() {
 	memory.persistentMem.ctrlConfig.initDefaultValues();
+	memory.persistentMem.ctrlSchedule.initDefaultValues();
 	memory.persistentMem.motorControllerConfig.initDefaultValues();
 	memory.persistentMem.imuControllerConfig.initDefaultValues();
 	memory.persistentMem.logConfig.initDefaultValues();
@@ -25,6 +26,8 @@ void BotMemory::println() {
 
 	persistentMem.ctrlConfig.print();
 	logger->println();
+	persistentMem.ctrlSchedule.print();
+	logger->println();
 	persistentMem.motorControllerConfig.print();;
 	logger->println();
 	persistentMem.imuControllerConfig.print();
@@ -13,12 +13,17 @@
 #include "libraries/MemoryBase.h"
 #include "libraries/PIDController.h"
 #include "StateController.h"
-#include "BrushlessMotorDriver.h"
-#include "IMU.h"
+#include "MotorConfig.h"
+#include "IMUSample.h"
 
 class BotMemory;
 extern BotMemory memory;
 
+// to be increased with every change of persistentMem
+//   1 PIDControllerConfig without vtable
+//   2 StateControllerSchedule
+const uint16_t PersistentMemLayoutVersion = 2;
+
 class LogConfig {
 public:
 	void null();
@@ -41,6 +46,7 @@ class BotMemory : public MemoryBase {
 
 		struct {
 			StateControllerConfig ctrlConfig;
+			StateControllerSchedule ctrlSchedule;
 			MotorConfig motorControllerConfig;
 			IMUConfig imuControllerConfig;
 			LogConfig logConfig;
@@ -10,8 +10,13 @@
 #include <libraries/Util.h>
 #include <BotMemory.h>
 #include <BrushlessMotorDriver.h>
+#include <SVPWM.h>
+#include <SensorFrontend.h>
 
 #include <TimePassedBy.h>
+#include <MicroClock.h>
+#include <DebugLog.h>
+#include <libraries/DeferredLog.h>
 
 const float maxAngleError = radians(10);						// limit for PID controller
 const float minTorqueRatio = 0.1;								// minimum percentage of torque when in position
@@ -23,122 +28,6 @@ const float maxRevolutionSpeed = voltage*RevPerSecondPerVolt; 	// [rev/s]
 
 MotorConfig& motorConfig = memory.persistentMem.motorControllerConfig;
 
-// array to store pre-computed values of space vector wave form (SVPWM)
-// array size is choosen by having a maximum difference of 1% in two subsequent table items,
-// i.e. we have a precision of 1%. The rest is compensated by the optical
-// encoder with a precision of 0.1%
-#define svpwmArraySize 244 // manually set such that two adjacent items have a difference of 2 of 255 at most (approx. 1%)
-int svpwmTable[svpwmArraySize];
-
-void setPwmTable(int i, int value) {
-	if ((i<0) || (i> svpwmArraySize))
-		fatalError("pwmTable:Idx out of bound");
-	svpwmTable[i] = value;
-}
-
-int getPwmTable(int i) {
-	if ((i<0) || (i> svpwmArraySize))
-		fatalError("pwmTable:Idx out of bound");
-	return svpwmTable[i];
-}
-
-void precomputeSVPMWave() {
-	const int maxPWMValue = (1<<pwmResolutionBits)-1;
-	const float spaceVectorScaleUpFactor = 1.15; // empiric value to reach full pwm scale
-	static boolean initialized = false;
-	if (!initialized) {
-		for (int i = 0;i<svpwmArraySize;i++) {
-			float angle = float(i) / float(svpwmArraySize) * (TWO_PI);
-			float phaseA = sin(angle);
-			float phaseB = sin(angle + M_PI*2.0/3.0);
-			float phaseC = sin(angle + M_PI*4.0/3.0);
-
-			// trick to avoid the switch of 6 phases everyone else is doing, neat, huh?
-			float voff = (min(phaseA, min(phaseB, phaseC)) + max(phaseA, max(phaseB, phaseC)))/2.0;
-			setPwmTable(i,(phaseA - voff)/2.0*spaceVectorScaleUpFactor*maxPWMValue);
-
-			// if you want to use plain sin waves:
-			setPwmTable(i,(phaseA/2.0 + 0.5)*maxPWMValue);
-		}
-		initialized = true;
-	}
-}
-
-
-
-void MotorConfig::initDefaultValues() {
-	// at slow speeds PID controller is aggressively keeping the position
-	pid_position.Kp = 0.5;
-	pid_position.Ki = 0.2;
-	pid_position.Kd = 0.0000;
-
-	pid_speed.Kp = 0.1;
-	pid_speed.Ki = 0.1;
-	pid_speed.Kd = 0.001;
-
-	pid_lifter.Kp = 0.01;
-	pid_lifter.Ki = 0.005;
-	pid_lifter.Kd = 0.0;
-
-	phaseAAngle[0] = radians(229.4);
-	phaseAAngle[1] = radians(234.3);
-	phaseAAngle[2] = radians(126.8);
-}
-
-void MotorConfig::print() {
-	loggingln("motor controller configuration:");
-	logging("   PID (speed=0)  : ");
-	logging("(");
-	logging(pid_position.Kp,3);
-	logging(",");
-	logging(pid_position.Ki,3);
-	logging(",");
-	logging(pid_position.Kd,4);
-	loggingln(")");
-	logging("   PID (speed=max): ");
-	logging("(");
-	logging(pid_speed.Kp,3);
-	logging(",");
-	logging(pid_speed.Ki,3);
-	logging(",");
-	logging(pid_speed.Kd,4);
-	loggingln(")");
-	logging("   rotorAngle=(");
-	logging(degrees(phaseAAngle[0]),1);
-	logging(",");
-	logging(degrees(phaseAAngle[1]),1);
-	logging(",");
-	logging(degrees(phaseAAngle[2]),1);
-	loggingln(")");
-	loggingln("lifter controller configuration:");
-	logging("   PID (speed=max): ");
-	logging("(");
-	logging(pid_lifter.Kp);
-	logging(",");
-	logging(pid_lifter.Ki);
-	logging(",");
-	logging(pid_lifter.Kd);
-	loggingln(")");
-}
-
-
-int BrushlessMotorDriver::getPWMValue(float torque, float angle_rad) {
-	// map input angle to 0..2*PI
-
-	// clear negative angles (fmod does not do this)
-	if (angle_rad < 0)
-		angle_rad += ((int)(-angle_rad/TWO_PI + 1.0))*TWO_PI;
-
-	angle_rad = fmod(angle_rad, TWO_PI);
-
-	// compute index in precomputed pwm array
-	int angleIndex = ((int)(angle_rad / TWO_PI * svpwmArraySize));
-	if ((angleIndex < 0) || (angleIndex > svpwmArraySize))
-		fatalError("getPWMValue: idx out of bounds");
-
-	return  torque * getPwmTable(angleIndex);
-}
-
 BrushlessMotorDriver::BrushlessMotorDriver() {
 	// initialize precomputed spvm values
 	// first invocation does the initialization
@@ -238,22 +127,17 @@ void BrushlessMotorDriver::sendPWMDuty(float torque) {
 
 
 // call me as often as possible
-bool BrushlessMotorDriver::loop(uint32_t now_us) {
+bool BrushlessMotorDriver::loop(uint64_t now_us) {
 
 	readEncoderAngle();
 	if (enabled) {
 
-		// @TODO take current time as method parameter. Currently turnReferenceAngle is imprecise due to low resolution of 1ms
-		// frequency of motor control is 1000Hz max
-		uint32_t now = millis();
-		uint32_t timePassed = now - lastLoopCall_ms;
-		if (timePassed < 1000/MaxBrushlessDriverFrequency) {
-			lastLoopCall_ms = now;
+		// frequency of motor control is MaxBrushlessDriverFrequency max
+		float dT = commutationDT(now_us, lastLoopCall_us);
+		if (dT == 0) {
 			return false;
 		}
-		lastLoopCall_ms = now;
-
-		float dT = ((float)timePassed)/1000.0;
+		lastLoopCall_us = now_us;
 
 		// turn reference angle along the given speed
 		turnReferenceAngle(dT);
@@ -288,39 +172,15 @@ bool BrushlessMotorDriver::loop(uint32_t now_us) {
 		// send new pwm value to motor
 		sendPWMDuty(min(abs(torque),1.0));
 
-		/*
-		if (motorNo == 0) {
-			static TimePassedBy t;
-			if (t.isDue_ms(100,millis())) {
-							logging(" aa=");
-							logging(degrees(advanceAngle));
-							logging(" sr=");
-							logging(speedRatio);
-							logging(" co=");
-							logging(degrees(controlOutput));
-
-							logging(" enc=");
-							logging(degrees(getEncoderAngle()));
-
-							logging(" e=");
-							logging(degrees(errorAngle));
-							logging(" ref=");
-							logging(degrees(referenceAngle));
-							logging(" mag=");
-							logging(degrees(magneticFieldAngle));
-							logging(" v=");
-							logging(currentReferenceMotorSpeed,1);
-							logging(" tv=");
-							logging(targetMotorSpeed,1);
-							logging(" torque=");
-							logging(torque,2);
-							logging(" dT=");
-							logging(dT,4);
-
-							loggingln();
-			}
+		if (LOG_ENABLED(LOG_LEVEL_DEBUG, LOG_MOTOR) && (motorNo == 0) && logTime.isDue_ms(100,millis())) {
+			LogCost cost(LOG_MOTOR);
+			deferredLog.log(" aa={} sr={} co={} enc={} e={} ref={} mag={}",
+							degrees(advanceAngle), speedRatio, degrees(controlOutput),
+							degrees(getEncoderAngle()), degrees(errorAngle), degrees(referenceAngle),
+							degrees(magneticFieldAngle));
+			deferredLog.log(" v={0.1} tv={0.1} torque={0.2} dT={0.4}\n",
+							currentReferenceMotorSpeed, targetMotorSpeed, torque, dT);
 		}
-		*/
 		return true;
 	}
 
@@ -349,7 +209,8 @@ float BrushlessMotorDriver::getSpeed() {
 }
 
 float BrushlessMotorDriver::getIntegratedAngle() {
-	return getIntegratedMotorAngle()*GearBoxRatio;
+	// same as getIntegratedMotorAngle()*GearBoxRatio, shared with the replay of sensor recordings
+	return wheelAngleFromEncoder(magEncoder.getCounts(), motorConfig.phaseAAngle[motorNo], reverse);
 }
 
 float BrushlessMotorDriver::getEncoderAngle() {
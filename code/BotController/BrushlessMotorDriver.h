@@ -13,26 +13,11 @@
 #include <Filter/ComplementaryFilter.h>
 #include <Encoder/AS5047D.h>
 #include <TimePassedBy.h>
+#include <MicroClock.h>
+#include <MotorConfig.h>
+#include <setup.h>
 
 const float MaxWheelAcceleration = 1000.0; 			// [rev/s^2]
-const float GearBoxRatio = 18.0/54.0*18.0/54.0; 	// two timing belts with 54/18*54/18 pulleys = 1:9
-
-class MotorConfig {
-public:
-	void initDefaultValues();
-	void print();
-
-	// PID values for control at 0 rev/s
-	PIDControllerConfig pid_position;
-	PIDControllerConfig pid_speed;
-	PIDControllerConfig pid_lifter;
-
-	// mounting property: differing angle between rotor and encoder.
-	// Needs to be calibrated after assembly to ake into account that
-	// the magnet gets a random position to the rotor
-	float phaseAAngle[3];
-};
-
 
 class BrushlessMotorDriver : virtual public Menuable {
 public:
@@ -48,7 +33,16 @@ public:
 	void calibrate();
 
 	// engine loop, returns true, if engine did something
-	bool loop(uint32_t now_us );
+	bool loop(uint64_t now_us );
+
+	// time passed since the last commutation [s], or 0 if the next one is not due yet.
+	// Half of the period is accepted to not skip a commutation due to jitter of the scheduler
+	static float commutationDT(uint64_t now_us, uint64_t lastCall_us) {
+		uint64_t timePassed_us = now_us - lastCall_us;
+		if (timePassed_us < 500000/MaxBrushlessDriverFrequency)
+			return 0;
+		return MicroClock::seconds(timePassed_us);
+	}
 
 	// set speed of motor
 	void setMotorSpeed(float speed /* [rev/s] */, float acc = MaxWheelAcceleration /* [rev/s^2] */);
@@ -60,6 +54,10 @@ public:
 	float getSpeed();
 	float getIntegratedAngle();
 
+	// unwrapped counts of the encoder, getIntegratedAngle is computed out of them
+	int32_t getEncoderCounts() { return magEncoder.getCounts(); };
+	bool isReverse() { return reverse; };
+
 	void enable(bool doit);
 	bool isEnabled() { return enabled; };
 
@@ -83,7 +81,6 @@ private:
 	float measuredMotorSpeed = 0;			// [rev/s] speed as given by encoder
 	SpeedGainPIDController pid;
 
-	int getPWMValue( float torque, float angle_rad);
 	void turnReferenceAngle(float dT);
 
 	// return absolute angle of rotor's position relative to
@@ -106,7 +103,7 @@ private:
 	int menuAcc = MaxWheelAcceleration;
 	float menuTorque = 0.0;
 	bool menuEnable = false;
-	uint32_t lastLoopCall_ms = 0;
+	uint64_t lastLoopCall_us = 0;
 	TimePassedBy logTime;
 };
 
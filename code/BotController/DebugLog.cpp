@@ -0,0 +1,71 @@
+/*
+ * DebugLog.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <BotMemory.h>
+#include <DebugLog.h>
+
+LogCostAccounting logCost;
+
+static const char* LogCategoryName[NumberOfLogCategories] = {
+		"balance", "state", "perf", "calib", "motor", "kinematics" };
+
+// runtime flags of the categories that are not part of the persistent log configuration
+static bool motorLog = false;
+static bool kinematicsLog = false;
+
+bool logActive(int category) {
+	LogConfig& config = memory.persistentMem.logConfig;
+	switch (category) {
+	case LOG_BALANCE: 		return config.debugBalanceLog;
+	case LOG_STATE: 		return config.debugStateLog;
+	case LOG_PERF: 			return config.performanceLog;
+	case LOG_CALIBRATION: 	return config.calibrationLog;
+	case LOG_MOTOR: 		return motorLog;
+	case LOG_KINEMATICS: 	return kinematicsLog;
+	default:
+		return false;
+	}
+}
+
+bool toggleLogCategory(int category) {
+	LogConfig& config = memory.persistentMem.logConfig;
+	switch (category) {
+	case LOG_BALANCE: 		config.debugBalanceLog = !config.debugBalanceLog; break;
+	case LOG_STATE: 		config.debugStateLog = !config.debugStateLog; break;
+	case LOG_PERF: 			config.performanceLog = !config.performanceLog; break;
+	case LOG_CALIBRATION: 	config.calibrationLog = !config.calibrationLog; break;
+	case LOG_MOTOR: 		motorLog = !motorLog; break;
+	case LOG_KINEMATICS: 	kinematicsLog = !kinematicsLog; break;
+	default:
+		break;
+	}
+	return logActive(category);
+}
+
+void LogCostAccounting::reset() {
+	for (int i = 0;i<NumberOfLogCategories;i++)
+		cycles[i] = 0;
+	startTime_ms = millis();
+}
+
+void LogCostAccounting::print() {
+	// show the share of cpu time each category takes
+	float passed_us = (millis() - startTime_ms)*1000.0;
+	float cyclesPerUs = Profiler::cyclesPerMicrosecond();
+	logging("log cost:");
+	for (int i = 0;i<NumberOfLogCategories;i++) {
+		logging(" ");
+		logging(LogCategoryName[i]);
+		logging(logCompiled(LOG_LEVEL_NONE, i)?"=":"(off)=");
+		if (passed_us > 0)
+			logging(cycles[i]/cyclesPerUs/passed_us*100.0,2);
+		logging("%");
+	}
+	loggingln();
+}
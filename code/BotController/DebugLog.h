@@ -0,0 +1,111 @@
+/*
+ * DebugLog.h
+ *
+ * Levels and categories of the debug output. A log statement is compiled only if its level is
+ * at most LOG_LEVEL and its category is part of LOG_CATEGORIES. Both are evaluated at compile time,
+ * so in a release build the statement and the check of the runtime flag are removed by the
+ * optimizer completely. In a debug build, the runtime flags of the menu decide.
+ *
+ * use:
+ * 		if (LOG_ENABLED(LOG_LEVEL_DEBUG, LOG_STATE)) {
+ * 			LogCost cost(LOG_STATE);		// counts the cycles spent for the category
+ * 			deferredLog.log(...);
+ * 		}
+ *
+ * Without LOG_LEVEL given, the level follows NDEBUG:
+ * 	- Release configuration of the firmware (.cproject, compile options -DNDEBUG): LOG_LEVEL_WARN,
+ * 	  all debug and info statements are stripped
+ * 	- debug build of the firmware, i.e. the Release configuration without -DNDEBUG in its
+ * 	  compile options: LOG_LEVEL_DEBUG, the runtime flags decide
+ * 	- host builds in code/Host set LOG_LEVEL_DEBUG explicitly, so the simulation and the fuzzer
+ * 	  run through all log statements
+ * Any build can override this with -DLOG_LEVEL=... or -DLOG_CATEGORIES=0. Alternatively,
+ * LogBuildConfig.h is included if it exists, which is what tools/log_size_report.py uses to
+ * measure the flash size of each category.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef DEBUGLOG_H_
+#define DEBUGLOG_H_
+
+#include <Arduino.h>
+#include <Profiler.h>
+
+#if defined(__has_include)
+#if __has_include(<LogBuildConfig.h>)
+#include <LogBuildConfig.h>
+#endif
+#endif
+
+// levels, a statement is compiled if its level is <= LOG_LEVEL
+#define LOG_LEVEL_NONE 		0
+#define LOG_LEVEL_ERROR 	1
+#define LOG_LEVEL_WARN 		2
+#define LOG_LEVEL_INFO 		3
+#define LOG_LEVEL_DEBUG 	4
+
+// categories, bit number in LOG_CATEGORIES
+#define LOG_BALANCE 		0		// balance loop of BotController 	(runtime flag debugBalanceLog)
+#define LOG_STATE 			1		// state controller 					(runtime flag debugStateLog)
+#define LOG_PERF 			2		// performance 						(runtime flag performanceLog)
+#define LOG_CALIBRATION 	3		// calibration 						(runtime flag calibrationLog)
+#define LOG_MOTOR 			4		// brushless motor control 			(runtime flag, not persistent)
+#define LOG_KINEMATICS 		5		// kinematics of ball drive 			(runtime flag, not persistent)
+#define NumberOfLogCategories 6
+
+#ifndef LOG_LEVEL
+#ifdef NDEBUG
+#define LOG_LEVEL LOG_LEVEL_WARN
+#else
+#define LOG_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+
+#ifndef LOG_CATEGORIES
+#define LOG_CATEGORIES ((1 << NumberOfLogCategories)-1)
+#endif
+
+// true if a statement of this level and category is compiled at all
+constexpr bool logCompiled(int level, int category) {
+	return (level <= LOG_LEVEL) && (((LOG_CATEGORIES) >> category) & 1);
+}
+
+// true if the runtime flag of the category is set
+bool logActive(int category);
+
+// toggle the runtime flag of a category, returns the new state
+bool toggleLogCategory(int category);
+
+#define LOG_ENABLED(level, category) (logCompiled(level, category) && logActive(category))
+
+// cycles spent in the log statements per category
+class LogCostAccounting {
+public:
+	void add(int category, uint32_t cycles) { this->cycles[category] += cycles; };
+	void reset();
+	void print();
+private:
+	uint32_t cycles[NumberOfLogCategories] = { 0 };
+	uint32_t startTime_ms = 0;
+};
+
+extern LogCostAccounting logCost;
+
+// counts the cycles from construction to destruction to the passed category
+class LogCost {
+public:
+	LogCost(int category) {
+		this->category = category;
+		start = Profiler::cycles();
+	}
+	~LogCost() {
+		logCost.add(category, Profiler::cycles() - start);
+	}
+private:
+	int category;
+	uint32_t start;
+};
+
+#endif /* DEBUGLOG_H_ */
@@ -55,8 +55,8 @@ uint32_t AS5047D::sensorRead(void)
 }
 
 void AS5047D::reset() {
-	float sensorValue = sensorRead();
-	currentAngle = ((float)sensorValue)/((float)resolution)*TWO_PI;
+	uint16_t sensorValue = sensorRead();
+	counts = sensorValue;
 	lastSensorRead = sensorValue;
 }
 
@@ -74,12 +74,13 @@ float AS5047D::readAngle() {
 	if (abs(diff) > abs ( diff - resolution))
 		diff -= resolution;
 
-	currentAngle += ((float)diff)/((float)resolution)*TWO_PI;
-	return currentAngle;
+	// accumulate the counts instead of the angle, so no rounding error sums up
+	counts += diff;
+	return getAngle();
 }
 
 float AS5047D::getAngle() {
-	return currentAngle;
+	return countsToAngle(counts);
 }
 
 float AS5047D::getSensorRead() {
@@ -12,9 +12,12 @@
 
 class AS5047D
 {
-	const int resolution = 0x4000; // =16384
-
 public:
+	static const int resolution = 0x4000; // =16384
+
+	// convert unwrapped counts into [rad]
+	static float countsToAngle(int32_t counts) { return ((float)counts)/((float)resolution)*TWO_PI; };
+
 	static void setupBus(uint16_t mosiPin, uint16_t misoPin, uint16_t SCKPin, const uint16_t SS[3]);
     void setup(uint16_t clientSelectPin);
 
@@ -25,14 +28,17 @@ public:
     // return angle recently used
     float getAngle();
 
+    // return unwrapped counts recently read, i.e. the angle without rounding errors
+    int32_t getCounts() { return counts; };
+
     float getSensorRead();
     // reset to angle between 0..360
     void reset();
 private:
 	uint16_t selectPin = 0;
 	uint32_t sensorRead(void);
-	uint32_t readRegister(uint32_t register);
-	float currentAngle = 0;
+	uint32_t readRegister(uint32_t thisRegister);
+	int32_t counts = 0;				// accumulated, not limited to one revolution
 	uint16_t lastSensorRead = 0;
 	static bool SPIBusInitialized;
 };
@@ -9,6 +9,8 @@
 #include <libraries/MenuController.h>
 #include <Engine.h>
 #include <setup.h>
+#include <Profiler.h>
+#include <LatencyTracer.h>
 
 
 void Engine::setup(MenuController* menuCtrl) {
@@ -29,15 +31,24 @@ void Engine::setup(MenuController* menuCtrl) {
 	}
 }
 
-void Engine::loop(uint32_t now_us) {
+void Engine::loop(uint64_t now_us) {
+	bool pwmSent = false;
 	for (int i = 0;i<3;i++) {
-		wheel[i].loop(now_us);
+		ProfileScope scope((ProfileStage)(PROFILE_MOTOR_0 + i));
+		pwmSent = wheel[i].loop(now_us) || pwmSent;
+	}
+
+	// the first commutation after a new speed closes the chain from IMU to wheel
+	if (pwmSent && (pendingSampleTime_us != 0)) {
+		latencyTracer.add(LATENCY_PWM, pendingSampleTime_us);
+		pendingSampleTime_us = 0;
 	}
 }
 
-void Engine::setWheelSpeed(float revPerSec[3]) {
+void Engine::setWheelSpeed(float revPerSec[3], uint32_t sampleTime_us) {
 	for (int i = 0;i<3;i++)
 		wheel[i].setSpeed(revPerSec[i]);
+	pendingSampleTime_us = sampleTime_us;
 }
 
 void Engine::getWheelSpeed(float revPerSec[3]) {
@@ -66,6 +77,17 @@ void Engine::getWheelAngleChange(float wheelAngleChange[3]) {
 		lastWheelAngle[i] = angle;
 	}
 }
+
+void Engine::getEncoderCounts(int32_t counts[3]) {
+	for (int i = 0;i<3;i++)
+		counts[i] = wheel[i].getEncoderCounts();
+}
+
+void Engine::getLastWheelAngle(float wheelAngle[3]) {
+	for (int i = 0;i<3;i++)
+		wheelAngle[i] = lastWheelAngle[i];
+}
+
 void Engine::enable(bool doIt) {
 	if (doIt) {
 		bool ok = true;
@@ -21,7 +21,8 @@ public:
 	virtual ~Engine() {};
 
 	// set target speed of all wheels in revolutions per seconds, accelerate as quick as possible
-	void setWheelSpeed(float revPerSec[3]);
+	// sampleTime_us is the time of the IMU sample the speed is based on (0 if not known), used to trace the latency
+	void setWheelSpeed(float revPerSec[3], uint32_t sampleTime_us = 0);
 	void getWheelSpeed(float revPerSec[3]);
 
 	// get angle of all wheels. Accumulates when turning
@@ -33,8 +34,13 @@ public:
 	// get the change of angles since last invocation of getWheelChange or resetWheelAngleChange
 	void getWheelAngleChange(float wheelAngleChange[3] /* [rad] */);
 
+	// raw state of the wheel angles, used for sensor recordings
+	void getEncoderCounts(int32_t counts[3]);
+	void getLastWheelAngle(float wheelAngle[3] /* [rad] */);
+	bool isReverse(int wheelNo) { return wheel[wheelNo].isReverse(); };
+
 	void setup(MenuController* menuCtrl);
-	void loop(uint32_t now_us);
+	void loop(uint64_t now_us);
 
 	void enable(bool doit);
 	bool isEnabled() { return enabled; };
@@ -46,6 +52,7 @@ private:
 	int activeMenuWheel = 0;
 	uint32_t lastLoop_ms = 0;
 	float lastWheelAngle[3] = {0,0,0};
+	uint32_t pendingSampleTime_us = 0;	// sample time of the last speed that did not yet reach the PWM
 	bool enabled = false;
 };
 
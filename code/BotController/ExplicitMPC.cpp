@@ -0,0 +1,67 @@
+/*
+ * ExplicitMPC.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <setup.h>
+#include <StateController.h>
+#include <ExplicitMPC.h>
+#include <MPCTable.h>
+
+static_assert(MPCSampleFrequency == SampleFrequency, "MPCTable.h has been designed for another sample frequency, run mpc_design");
+static_assert(MPCParameters == LQRStates + 2, "MPCTable.h does not fit to LQRState, run mpc_design");
+static_assert(MPCRegions > 0, "MPCTable.h requires at least the unconstrained region");
+
+void ExplicitMPC::reset() {
+	region = 0;
+	lastFound = 0;
+}
+
+bool ExplicitMPC::inside(int region, const float parameter[MPCParameters]) {
+	const MPCRegion& r = MPCRegionTable[region];
+	for (int i = r.firstRow;i<r.firstRow + r.rows;i++) {
+		const float* row = MPCRowTable[i];
+		float sum = 0;
+		for (int j = 0;j<MPCParameters;j++)
+			sum += row[j]*parameter[j];
+		if (sum > row[MPCParameters])
+			return false;
+	}
+	return true;
+}
+
+float ExplicitMPC::evaluate(const float parameter[MPCParameters]) {
+	// the table covers the operating range only, outside regions may overlap
+	bool inRange = true;
+	for (int i = 0;i<MPCParameters;i++)
+		inRange = inRange && (abs(parameter[i]) <= MPCParameterLimit[i]);
+
+	region = -1;
+	if (inRange) {
+		// the state moves slowly compared to the sample frequency, so the region of the last tick
+		// is most likely the current one. Otherwise search in the order of the table, most frequent first
+		if (inside(lastFound, parameter))
+			region = lastFound;
+		else
+			for (int i = 0;i<MPCRegions;i++)
+				if ((i != lastFound) && inside(i, parameter)) {
+					region = i;
+					break;
+				}
+	}
+
+	// outside of the table apply the unconstrained law
+	const MPCRegion& r = MPCRegionTable[(region >= 0)?region:0];
+	if (region >= 0)
+		lastFound = region;
+	float accel = r.offset;
+	for (int j = 0;j<MPCParameters;j++)
+		accel += r.gain[j]*parameter[j];
+	return accel;
+}
+
+float ExplicitMPC::getGain(int parameter) {
+	return MPCRegionTable[0].gain[parameter];
+}
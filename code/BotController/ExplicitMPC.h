@@ -0,0 +1,61 @@
+/*
+ * ExplicitMPC.h
+ *
+ * Explicit model predictive control of one plane. The constrained optimisation of the
+ * acceleration over a horizon (limits of acceleration, tilt angle and wheel speed) is solved
+ * offline by Host/tools/mpc_design for all parameters of the operating range. Its solution is
+ * piecewise affine: the parameter space falls into polyhedral regions, each with an affine law.
+ * MPCTable.h stores the regions in flash, so one tick costs the search of the region and one
+ * affine evaluation.
+ *
+ * The parameter is the state of LQRState followed by the target angle and the target speed of
+ * the ball, the latter two are required by the constraints only.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef EXPLICITMPC_H_
+#define EXPLICITMPC_H_
+
+#include <Arduino.h>
+
+// error state of LQRState, target angle, target ball speed
+const int MPCParameters = 7;
+const int MPC_TARGET_ANGLE = 5;
+const int MPC_TARGET_SPEED = 6;
+
+// row h·p <= k of a region, with h in the first MPCParameters fields and k in the last
+typedef float MPCRow[MPCParameters+1];
+
+// polyhedral region of the parameter space with its optimal acceleration gain·p + offset
+struct MPCRegion {
+	uint16_t firstRow;
+	uint16_t rows;
+	float gain[MPCParameters];
+	float offset;
+};
+
+class ExplicitMPC {
+public:
+	ExplicitMPC() {};
+
+	// start the search with the unconstrained region
+	void reset();
+
+	// optimal acceleration [m/s^2] for the parameter. Outside of the table this is the
+	// unconstrained law, i.e. the caller has to limit the acceleration anyhow
+	float evaluate(const float parameter[MPCParameters]);
+
+	// region of the last evaluation, -1 if the parameter has not been found in the table
+	int getRegion() { return region; };
+
+	// gain of the unconstrained law, e.g. to derive limits of the errors like for the LQR gains
+	static float getGain(int parameter);
+private:
+	bool inside(int region, const float parameter[MPCParameters]);
+	int region = 0;
+	int lastFound = 0;
+};
+
+#endif /* EXPLICITMPC_H_ */
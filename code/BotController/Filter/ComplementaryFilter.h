@@ -10,6 +10,7 @@
 #define COMPLEMENTARYFILTER_H_
 
 #include "Arduino.h"
+#include <libraries/Util.h>
 
 class LowPassFilterAverage {
 	public:
@@ -64,7 +64,9 @@ void Filter::init(filterType filt_t, int num_taps, float SamplingFrequency, floa
 	if( FilterFrequency <= 0 || FilterFrequency >= SamplingFrequency/2 ) ECODE(-2);
 	if( m_num_taps <= 0 || m_num_taps > MAX_NUM_FILTER_TAPS ) ECODE(-3);
 
-	m_taps = m_sr = NULL;
+	// buffers of a previous initialization, ControlPlane::reset re-initializes its filters
+	free(m_taps);
+	free(m_sr);
 	m_taps = (float*)malloc( m_num_taps * sizeof(float) );
 	m_sr = (float*)malloc( m_num_taps * sizeof(float) );
 	if( m_taps == NULL || m_sr == NULL ) ECODE(-4);
@@ -97,7 +99,9 @@ void Filter::init(filterType filt_t, int num_taps, float SamplingFrequency, floa
 	if( higherFilterFrequency <= 0 || higherFilterFrequency >= SamplingFrequency/2 ) ECODE(-13);
 	if( m_num_taps <= 0 || m_num_taps > MAX_NUM_FILTER_TAPS ) ECODE(-14);
 
-	m_taps = m_sr = NULL;
+	// buffers of a previous initialization, ControlPlane::reset re-initializes its filters
+	free(m_taps);
+	free(m_sr);
 	m_taps = (float*)malloc( m_num_taps * sizeof(float) );
 	m_sr = (float*)malloc( m_num_taps * sizeof(float) );
 	if( m_taps == NULL || m_sr == NULL ) ECODE(-15);
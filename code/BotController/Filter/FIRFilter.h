@@ -139,8 +139,8 @@ class Filter{
 		float m_Fs;
 		float m_Fx;
 		float  m_lambda;
-		float *m_taps;
-		float *m_sr;
+		float *m_taps = NULL;
+		float *m_sr = NULL;
 		void designLPF();
 		void designHPF();
 
@@ -17,6 +17,7 @@
  */
 
 #include "IIRFilter.h"
+#include <libraries/Util.h>
 
 using namespace IIR;
 
@@ -77,17 +78,17 @@ void Filter::flush() {
 
 void Filter::dumpParams() {
   uint8_t p = 6;
-  Serial.println("Filter parameters:");
-  Serial.print("ts\t= "); Serial.println(ts, p);
-  Serial.print("hz\t= "); Serial.println(hz, p);
-  Serial.print("od\t= "); Serial.println((uint8_t)od);
-
-  Serial.print("k0\t= ");  Serial.println(k0, p);
-  Serial.print("k1\t= ");  Serial.println(k1, p);
-  Serial.print("k2\t= ");  Serial.println(k2, p);
-  Serial.print("k3\t= ");  Serial.println(k3, p);
-  Serial.print("k4\t= ");  Serial.println(k4, p);
-  Serial.print("k5\t= ");  Serial.println(k5, p);
+  logger->println("Filter parameters:");
+  logger->print("ts\t= "); logger->println(ts, p);
+  logger->print("hz\t= "); logger->println(hz, p);
+  logger->print("od\t= "); logger->println((uint8_t)od);
+
+  logger->print("k0\t= ");  logger->println(k0, p);
+  logger->print("k1\t= ");  logger->println(k1, p);
+  logger->print("k2\t= ");  logger->println(k2, p);
+  logger->print("k3\t= ");  logger->println(k3, p);
+  logger->print("k4\t= ");  logger->println(k4, p);
+  logger->print("k5\t= ");  logger->println(k5, p);
 }
 
 // PRIVATE METHODS  * * * * * * * * * * * * * * * * * * * *
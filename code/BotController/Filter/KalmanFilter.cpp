@@ -20,6 +20,7 @@ void KalmanFilter::setup(float angle) {
 
     this->angle = angle;
     bias = 0.0f;
+    rate = 0.0f;
 
     P00 = 0.0f;
     P01 = 0.0f;
@@ -64,6 +65,26 @@ void KalmanFilter::update(float newAngle /* rad */, float newRate /* rad/s */, f
     P11 -= K1 * P01saved;
 };
 
+void KalmanFilter::getState(float state[StateSize]) {
+	state[0] = angle;
+	state[1] = bias;
+	state[2] = rate;
+	state[3] = P00;
+	state[4] = P01;
+	state[5] = P10;
+	state[6] = P11;
+}
+
+void KalmanFilter::setState(const float state[StateSize]) {
+	angle = state[0];
+	bias = state[1];
+	rate = state[2];
+	P00 = state[3];
+	P01 = state[4];
+	P10 = state[5];
+	P11 = state[6];
+}
+
 float KalmanFilter::getAngle() {
 	return angle;
 }
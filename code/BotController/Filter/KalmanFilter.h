@@ -10,6 +10,8 @@
 
 class KalmanFilter {
 public:
+    static const int StateSize = 7;
+
     KalmanFilter();
     virtual ~KalmanFilter() {};
 
@@ -38,6 +40,10 @@ public:
     void setQbias(float Q_bias);
     void setRmeasure(float R_measure);
 
+    // complete state of the filter, to continue it elsewhere (e.g. in a replay of a recording)
+    void getState(float state[StateSize]);
+    void setState(const float state[StateSize]);
+
     float getQangle();
     float getQbias();
     float getRmeasure();
@@ -0,0 +1,169 @@
+/*
+ * FlightRecorder.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <FlightRecorder.h>
+
+FlightRecorder flightRecorder;
+
+// convert to fixed point and saturate instead of overflowing
+static inline int16_t toFixed(float x, float scale) {
+	float v = x*scale;
+	if (v > 32767.0)
+		return 32767;
+	if (v < -32768.0)
+		return -32768;
+	return (int16_t)v;
+}
+
+static inline uint16_t toUInt16(uint32_t x) {
+	return (x > 65535)?65535:x;
+}
+
+static void recordPlane(FlightRecordPlane& r, const IMUSamplePlane& sensor,
+						const State& current, const State& target, const ControlPlane& plane) {
+	r.angle 				= toFixed(sensor.angle, RecordAngleScale);
+	r.angularVelocity 		= toFixed(sensor.angularVelocity, RecordAngularVelocityScale);
+	r.currentPos 			= toFixed(current.pos, RecordPosScale);
+	r.currentSpeed 			= toFixed(current.speed, RecordSpeedScale);
+	r.currentAccel 			= toFixed(current.accel, RecordAccelScale);
+	r.targetPos 			= toFixed(target.pos, RecordPosScale);
+	r.targetSpeed 			= toFixed(target.speed, RecordSpeedScale);
+	r.targetAccel 			= toFixed(target.accel, RecordAccelScale);
+	r.errorTilt 			= toFixed(plane.errorTilt, RecordErrorScale);
+	r.errorAngularSpeed 	= toFixed(plane.errorAngularSpeed, RecordErrorScale);
+	r.errorPos 				= toFixed(plane.errorPos, RecordErrorScale);
+	r.errorPosIntegrated 	= toFixed(plane.posErrorIntegrated, RecordErrorScale);
+	r.errorSpeed 			= toFixed(plane.errorSpeed, RecordErrorScale);
+	r.error 				= toFixed(plane.error, RecordErrorScale);
+}
+
+void FlightRecorder::record(const IMUSample& sample,
+							const BotMovement& current, const BotMovement& target,
+							const ControlPlane& planeX, const ControlPlane& planeY,
+							const float wheelSpeed[3],
+							float dT, uint32_t loopTime_us) {
+	if (frozen)
+		return;
+
+	FlightRecord& r = records[next];
+	r.time_us = sample.timestamp_us;
+	r.dT_us = toUInt16(dT*1000000.0);
+	r.loopTime_us = toUInt16(loopTime_us);
+	recordPlane(r.plane[0], sample.plane[Dimension::X], current.x, target.x, planeX);
+	recordPlane(r.plane[1], sample.plane[Dimension::Y], current.y, target.y, planeY);
+	r.currentOmega = toFixed(current.omega, RecordOmegaScale);
+	r.targetOmega = toFixed(target.omega, RecordOmegaScale);
+	for (int i = 0;i<3;i++)
+		r.wheelSpeed[i] = toFixed(wheelSpeed[i], RecordWheelSpeedScale);
+
+	next++;
+	if (next >= NumberOfRecords)
+		next = 0;
+	if (count < NumberOfRecords)
+		count++;
+}
+
+void FlightRecorder::freeze(const char* reason) {
+	if (!frozen) {
+		frozen = true;
+		freezeReason = reason;
+	}
+}
+
+void FlightRecorder::reset() {
+	next = 0;
+	count = 0;
+	frozen = false;
+	freezeReason = NULL;
+	dumpState = DUMP_IDLE;
+}
+
+static void dumpPlane(const FlightRecordPlane& r) {
+	logger->print(',');logger->print(r.angle/RecordAngleScale,4);
+	logger->print(',');logger->print(r.angularVelocity/RecordAngularVelocityScale,3);
+	logger->print(',');logger->print(r.currentPos/RecordPosScale,3);
+	logger->print(',');logger->print(r.currentSpeed/RecordSpeedScale,3);
+	logger->print(',');logger->print(r.currentAccel/RecordAccelScale,3);
+	logger->print(',');logger->print(r.targetPos/RecordPosScale,3);
+	logger->print(',');logger->print(r.targetSpeed/RecordSpeedScale,3);
+	logger->print(',');logger->print(r.targetAccel/RecordAccelScale,3);
+	logger->print(',');logger->print(r.errorTilt/RecordErrorScale,3);
+	logger->print(',');logger->print(r.errorAngularSpeed/RecordErrorScale,3);
+	logger->print(',');logger->print(r.errorPos/RecordErrorScale,3);
+	logger->print(',');logger->print(r.errorPosIntegrated/RecordErrorScale,3);
+	logger->print(',');logger->print(r.errorSpeed/RecordErrorScale,3);
+	logger->print(',');logger->print(r.error/RecordErrorScale,3);
+}
+
+void FlightRecorder::startDump() {
+	// oldest record comes first
+	dumpIdx = (count < NumberOfRecords)?0:next;
+	dumpRemaining = count;
+	dumpState = DUMP_HEADER;
+}
+
+bool FlightRecorder::dumpLoop(int maxRecords) {
+	// a line is printed only if it fits into the output buffer, so nothing is dropped while balancing
+	const int MaxLineLength = 512;
+
+	if ((dumpState == DUMP_HEADER) && (logger->availableForWrite() >= 2*MaxLineLength)) {
+		logger->print("flight recorder: ");
+		logger->print(count);
+		logger->print(" records");
+		if (frozen) {
+			logger->print(", frozen by ");
+			logger->print(freezeReason);
+		}
+		logger->println();
+
+		const char* planeHeader = "angle,angvel,pos,speed,accel,tpos,tspeed,taccel,etilt,eangvel,epos,eposint,espeed,error";
+		logger->print("time_us,dT_us,loop_us");
+		for (int p = 0;p<2;p++) {
+			const char* c = planeHeader;
+			logger->print(',');
+			// prefix each column of the plane with x or y
+			logger->print(p==0?'x':'y');
+			while (*c) {
+				logger->print(*c);
+				if (*c == ',')
+					logger->print(p==0?'x':'y');
+				c++;
+			}
+		}
+		logger->println(",omega,tomega,wheel0,wheel1,wheel2");
+		dumpState = DUMP_RECORDS;
+	}
+
+	while ((dumpState == DUMP_RECORDS) && (maxRecords > 0) && (logger->availableForWrite() >= MaxLineLength)) {
+		if (dumpRemaining == 0) {
+			dumpState = DUMP_IDLE;
+			break;
+		}
+		const FlightRecord& r = records[dumpIdx];
+		logger->print(r.time_us);
+		logger->print(',');logger->print(r.dT_us);
+		logger->print(',');logger->print(r.loopTime_us);
+		dumpPlane(r.plane[0]);
+		dumpPlane(r.plane[1]);
+		logger->print(',');logger->print(r.currentOmega/RecordOmegaScale,3);
+		logger->print(',');logger->print(r.targetOmega/RecordOmegaScale,3);
+		for (int w = 0;w<3;w++) {
+			logger->print(',');
+			logger->print(r.wheelSpeed[w]/RecordWheelSpeedScale,2);
+		}
+		logger->println();
+
+		dumpIdx++;
+		if (dumpIdx >= NumberOfRecords)
+			dumpIdx = 0;
+		dumpRemaining--;
+		maxRecords--;
+	}
+	return isDumping();
+}
@@ -0,0 +1,113 @@
+/*
+ * FlightRecorder.h
+ *
+ * Keeps the control state of every balancing tick of the last RecordingTime seconds in RAM,
+ * so after a fall or a fatal error one can see what happened before. Records are
+ * stored in fixed point int16 in a packed struct, a record costs a handful of multiplications.
+ * The recorder freezes on a fatal error, when the bot tilts over or on request in the menu,
+ * then the content can be dumped as CSV over the serial line. The dump is about 130kB, far more
+ * than the serial buffer holds, so it is sent piecewise by a low priority task, a few records
+ * whenever there is space in the buffer. That works while balancing, too.
+ *
+ * use:
+ * 		flightRecorder.record(...);			// once per balancing tick
+ * 		flightRecorder.freeze("reason");	// stop recording, keep the last seconds
+ * 		flightRecorder.startDump();			// print all records as csv...
+ * 		flightRecorder.dumpLoop(4);			// ...by a task, up to 4 records per call
+ * 		flightRecorder.reset();				// start recording again
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef FLIGHTRECORDER_H_
+#define FLIGHTRECORDER_H_
+
+#include <Arduino.h>
+#include <setup.h>
+#include <types.h>
+#include <IMU.h>
+#include <StateController.h>
+
+// fixed point scales of the recorded values, i.e. the int16 value is the float multiplied by the scale
+const float RecordAngleScale 			= 10000.0;	// [rad] 	-> [0.1 mrad]
+const float RecordAngularVelocityScale 	= 1000.0;	// [rad/s] 	-> [mrad/s]
+const float RecordPosScale 				= 1000.0;	// [m] 		-> [mm]
+const float RecordSpeedScale 			= 1000.0;	// [m/s] 	-> [mm/s]
+const float RecordAccelScale 			= 1000.0;	// [m/s^2] 	-> [mm/s^2]
+const float RecordOmegaScale 			= 1000.0;	// [rad/s] 	-> [mrad/s]
+const float RecordErrorScale 			= 1000.0;	// error terms of the control plane
+const float RecordWheelSpeedScale 		= 100.0;	// [rev/s] 	-> [rev/100s]
+
+struct FlightRecordPlane {
+	int16_t angle;
+	int16_t angularVelocity;
+	int16_t currentPos;
+	int16_t currentSpeed;
+	int16_t currentAccel;
+	int16_t targetPos;
+	int16_t targetSpeed;
+	int16_t targetAccel;
+	int16_t errorTilt;
+	int16_t errorAngularSpeed;
+	int16_t errorPos;
+	int16_t errorPosIntegrated;
+	int16_t errorSpeed;
+	int16_t error;
+} __attribute__((packed));
+
+struct FlightRecord {
+	uint32_t time_us;				// [us] time of the IMU sample
+	uint16_t dT_us;					// [us] time since the previous tick
+	uint16_t loopTime_us;			// [us] execution time of the balancing part
+	FlightRecordPlane plane[2];		// x and y
+	int16_t currentOmega;
+	int16_t targetOmega;
+	int16_t wheelSpeed[3];			// setpoint of all wheels
+} __attribute__((packed));
+
+class FlightRecorder {
+public:
+	static const int RecordingTime = 2;									// [s]
+	static const int NumberOfRecords = RecordingTime*SampleFrequency;
+
+	FlightRecorder() {};
+	virtual ~FlightRecorder() {};
+
+	// add the state of one balancing tick, does nothing if the recorder is frozen
+	void record(const IMUSample& sample,
+				const BotMovement& current, const BotMovement& target,
+				const ControlPlane& planeX, const ControlPlane& planeY,
+				const float wheelSpeed[3],
+				float dT, uint32_t loopTime_us);
+
+	// stop recording, the first reason is kept (needs to be a string literal)
+	void freeze(const char* reason);
+	bool isFrozen() { return frozen; };
+
+	// start printing all records from the oldest to the newest one as csv
+	void startDump();
+
+	// print up to maxRecords records, as long as they fit into the output buffer.
+	// Returns true while the dump is not complete
+	bool dumpLoop(int maxRecords);
+	bool isDumping() { return dumpState != DUMP_IDLE; };
+
+	// forget all records and start recording again
+	void reset();
+private:
+	FlightRecord records[NumberOfRecords];
+	int next = 0;					// index of the next record to be written
+	int count = 0;					// number of valid records
+	bool frozen = false;
+	const char* freezeReason = NULL;
+
+	enum DumpState { DUMP_IDLE, DUMP_HEADER, DUMP_RECORDS };
+	DumpState dumpState = DUMP_IDLE;
+	int dumpIdx = 0;				// index of the next record to be dumped
+	int dumpRemaining = 0;			// number of records still to be dumped
+};
+
+extern FlightRecorder flightRecorder;
+
+#endif /* FLIGHTRECORDER_H_ */
@@ -8,13 +8,14 @@
 #include <Arduino.h>
 #include <MPU9250/MPU9250.h>
 #include <TimePassedBy.h>
-#include <Filter/KalmanFilter.h>
+#include <MicroClock.h>
 #include <IMU.h>
 #include <setup.h>
 #include <libraries/Util.h>
 #include <types.h>
 #include <BotMemory.h>
 #include <libraries/I2CPortScanner.h>
+#include <Profiler.h>
 
 // instantiated in main.cpp
 extern i2c_t3* IMUWire;
@@ -23,6 +24,9 @@ extern i2c_t3* IMUWire;
 // and evaluated in loop(), so this needs to be declared volatile
 volatile bool newDataAvailable = false;
 
+// time of the last interrupt [us], used to trace the latency until the wheels react
+volatile uint32_t newDataTime_us = 0;
+
 // if the interrupt has been missed, use this emergency timer
 // to ask the IMU anyhow.
 TimePassedBy updateTimer(2.0*SamplingTime*1000.0 /* [ms] */); // twice the usual sampling frquency
@@ -32,74 +36,11 @@ IMUConfig& imuConfig = memory.persistentMem.imuControllerConfig;
 
 // interrupt that is called whenever MPU9250 has a new value (which is setup'ed to happen every 10ms)
 void imuInterrupt() {
+	newDataTime_us = micros();
 	newDataAvailable = true;
 }
 
 
-void IMUConfig::initDefaultValues() {
-	// these null values can be calibrated and set in EEPROM
-	nullOffsetX = radians(1.41);
-	nullOffsetY = radians(3.20);
-	kalmanNoiseVariance = 0.1; // noise variance, default is 0.03, the higher the more noise is filtered
-}
-
-void IMUConfig::print() {
-	loggingln("imu configuration");
-	logging("   null=(");
-	logging(degrees(nullOffsetX),3,2);
-	logging(",");
-	logging(degrees(nullOffsetY),3,2);
-	loggingln("))");
-	logging("   kalman noise variance=");
-	loggingln(kalmanNoiseVariance,1,3);
-
-}
-
-
-IMUSamplePlane::IMUSamplePlane() {
-	angle = 0;
-	angularVelocity = 0;
-}
-
-IMUSamplePlane::IMUSamplePlane(float angle, float angularVelocity) {
-	this->angle = angle;
-	this->angularVelocity = angularVelocity;
-}
-
-IMUSamplePlane::IMUSamplePlane(const IMUSamplePlane& t) {
-	this->angle = t.angle;
-	this->angularVelocity = t.angularVelocity;
-}
-
-IMUSamplePlane& IMUSamplePlane::operator=(const IMUSamplePlane& t) {
-	this->angle = t.angle;
-	this->angularVelocity = t.angularVelocity;
-	return * this;
-}
-
-IMUSample::IMUSample() {};
-
-IMUSample::IMUSample(const IMUSamplePlane& x, const IMUSamplePlane& y, const IMUSamplePlane& z) {
-	plane[Dimension::X] = x;
-	plane[Dimension::Y] = y;
-	plane[Dimension::Z] = z;
-}
-
-IMUSample::IMUSample(const IMUSample& t) {
-	this->plane[0] = t.plane[0];
-	this->plane[1] = t.plane[1];
-	this->plane[2] = t.plane[2];
-}
-
-IMUSample& IMUSample::operator=(const IMUSample& t) {
-	this->plane[0] = t.plane[0];
-	this->plane[1] = t.plane[1];
-	this->plane[2] = t.plane[2];
-
-	return *this;
-}
-
-
 bool IMU::isValid() {
 	if (!(millis() - updateTimer.mLastCall_ms < 2000/SampleFrequency))
 		logging("IMU frequency too low");
@@ -196,14 +137,21 @@ int IMU::init() {
 	attachInterrupt(IMU_INTERRUPT_PIN, imuInterrupt, RISING);
 	mpu9250->enableDataReadyInterrupt();
 
-	// initialize Kalman filter
-	kalman[Dimension::X].setup(0);
-	kalman[Dimension::Y].setup(0);
-	kalman[Dimension::Z].setup(0);
-
-	kalman[Dimension::X].setNoiseVariance(imuConfig.kalmanNoiseVariance);
-	kalman[Dimension::Y].setNoiseVariance(imuConfig.kalmanNoiseVariance);
-	kalman[Dimension::Z].setNoiseVariance(imuConfig.kalmanNoiseVariance);
+	// the conversion of the counts is done by the frontend, which initializes the Kalman filter
+	IMUCalibration calibration;
+	mpu9250->getTransform(calibration.transform);
+	calibration.accelScale = mpu9250->getAccelScale();
+	calibration.accelBias[0] = mpu9250->getAccelBiasX_mss();
+	calibration.accelBias[1] = mpu9250->getAccelBiasY_mss();
+	calibration.accelBias[2] = mpu9250->getAccelBiasZ_mss();
+	calibration.accelScaleFactor[0] = mpu9250->getAccelScaleFactorX();
+	calibration.accelScaleFactor[1] = mpu9250->getAccelScaleFactorY();
+	calibration.accelScaleFactor[2] = mpu9250->getAccelScaleFactorZ();
+	calibration.gyroScale = mpu9250->getGyroScale();
+	calibration.gyroBias[0] = mpu9250->getGyroBiasX_rads();
+	calibration.gyroBias[1] = mpu9250->getGyroBiasY_rads();
+	calibration.gyroBias[2] = mpu9250->getGyroBiasZ_rads();
+	frontend.setup(calibration, &imuConfig);
 
 	return status;
 }
@@ -238,30 +186,35 @@ void IMU::calibrate() {
 
 	// let kalman filter run and calibrate for 1s
 	while (millis() - now < 2000) {
-		loop();
+		loop(MicroClock::now_us());
 	}
 
-	imuConfig.nullOffsetX = kalman[Dimension::X].getAngle();
-	imuConfig.nullOffsetY = kalman[Dimension::Y].getAngle();
+	imuConfig.nullOffsetX = frontend.getFilteredAngle(Dimension::X);
+	imuConfig.nullOffsetY = frontend.getFilteredAngle(Dimension::Y);
 
 	imuConfig.print();
 }
 
-void IMU::loop() {
+void IMU::loop(uint64_t now_us) {
 	if (mpu9250) {
 		if (newDataAvailable || updateTimer.isDue()) {
-			uint32_t now_us = micros();
-			uint32_t sampleTime_us = now_us-lastInvocationTime_us;
+			uint32_t sampleTime_us = (uint32_t)(now_us-lastInvocationTime_us);
 			sampleRate_us = (sampleRate_us + sampleTime_us)/2.0;
 			if (newDataAvailable) {
 				updateTimer.dT(); // reset timer of updateTimer
+				currentSample.timestamp_us = newDataTime_us;
 				newDataAvailable = false;
 			} else {
+				currentSample.timestamp_us = (uint32_t)now_us; // low word is like micros()
 				warnMsg("IMU does not send interrupts");
 			}
 
 			// read raw values
-			int status = mpu9250->readSensor();
+			int status;
+			{
+				ProfileScope scope(PROFILE_IMU_READ);
+				status = mpu9250->readSensor();
+			}
 			if (status != 1) {
 				fatalError("loop IMU status error ");
 				loggingln(status);
@@ -271,34 +224,15 @@ void IMU::loop() {
 			dT = ((float)(sampleTime_us))/1000000.0;
 			lastInvocationTime_us = now_us;
 
-			// turn the coordinate system of the IMU into that one of the bot:
-			// front wheel points to the x-axis, y-axis is
-			// for use of the kalman filter, we need to break the convention and
-			// denote the coordsystem for angualr velocity in the direction of the according axis
-			// I.e. the angular velocity in the x-axis denotes the speed of the tilt angle in direction of x
-			float tilt[3];
-			float accelX = mpu9250->getAccelX_mss();
-			float accelY = mpu9250->getAccelY_mss();
-			float accelZ = mpu9250->getAccelZ_mss();
-
-			tilt[Dimension::X] = atan2( accelX, sqrt(accelZ*accelZ + accelY*accelY)) - imuConfig.nullOffsetX;
-			tilt[Dimension::Y] = atan2(-accelY, sqrt(accelZ*accelZ + accelX*accelX)) - imuConfig.nullOffsetY;
-			tilt[Dimension::Z] = accelZ;
-
-			float angularVelocity[3];
-			angularVelocity[Dimension::X] = mpu9250->getGyroY_rads();
-			angularVelocity[Dimension::Y] = mpu9250->getGyroX_rads();
-			angularVelocity[Dimension::Z] = mpu9250->getGyroZ_rads();
-
 			// save previous sample
 			lastSample = currentSample;
 
-			for (int i = 0;i<3;i++) {
-				// invoke kalman filter separately per plane
-				kalman[i].update(tilt[i], angularVelocity[i], dT);
-				currentSample.plane[i].angle = kalman[i].getAngle();
-				currentSample.plane[i].angularVelocity = kalman[i].getRate();
-				// currentSample.plane[i].angularVelocity = (kalman[i].getAngle() - lastSample.plane[i].angle) / dT;
+			// convert the counts into the bot's coordinate system and run the Kalman filter
+			mpu9250->getAccelCounts(accelCounts);
+			mpu9250->getGyroCounts(gyroCounts);
+			{
+				ProfileScope scope(PROFILE_KALMAN);
+				frontend.update(accelCounts, gyroCounts, dT, currentSample);
 			}
 
 			// indicate that new value is available
@@ -310,17 +244,17 @@ void IMU::loop() {
 					logging("dT=");
 					logging(dT,1,3);
 					logging("a=(X:");
-					logging(degrees(tilt[Dimension::X]),2,2);
+					logging(degrees(frontend.getTilt(Dimension::X)),2,2);
 					logging("/");
-					logging(degrees(angularVelocity[Dimension::X]),2,2);
+					logging(degrees(frontend.getAngularVelocity(Dimension::X)),2,2);
 					logging("Y:");
-					logging(degrees(tilt[Dimension::Y]),2,2);
+					logging(degrees(frontend.getTilt(Dimension::Y)),2,2);
 					logging("/");
-					logging(degrees(angularVelocity[Dimension::Y]),2,2);
+					logging(degrees(frontend.getAngularVelocity(Dimension::Y)),2,2);
 					logging("Z:");
-					logging(degrees(tilt[Dimension::Z]),2,2);
+					logging(degrees(frontend.getTilt(Dimension::Z)),2,2);
 					logging("/");
-					logging(degrees(angularVelocity[Dimension::Z]),2,2);
+					logging(degrees(frontend.getAngularVelocity(Dimension::Z)),2,2);
 
 					logging(" angle=(");
 					logging(degrees(getAngleRad(Dimension::X)),2,2);
@@ -357,9 +291,14 @@ float IMU::getAngularVelocity(Dimension dim) {
 }
 
 void IMU::setNoiseVariance(float noiseVariance) {
-	kalman[0].setNoiseVariance(noiseVariance);
-	kalman[1].setNoiseVariance(noiseVariance);
-	kalman[2].setNoiseVariance(noiseVariance);
+	frontend.setNoiseVariance(noiseVariance);
+}
+
+void IMU::getCounts(int16_t accel[3], int16_t gyro[3]) {
+	for (int i = 0;i<3;i++) {
+		accel[i] = accelCounts[i];
+		gyro[i] = gyroCounts[i];
+	}
 }
 
 void IMU::printHelp() {
@@ -10,44 +10,10 @@
 
 #include <libraries/MenuController.h>
 #include <MPU9250/MPU9250.h>
-#include <Filter/KalmanFilter.h>
+#include <SensorFrontend.h>
 #include <Kinematics.h>
 #include <TimePassedBy.h>
-
-class IMUConfig {
-	public:
-		void initDefaultValues();
-
-		void print();
-
-	float nullOffsetX;
-	float nullOffsetY;
-	float kalmanNoiseVariance;
-};
-
-
-
-class IMUSamplePlane {
-public:
-	IMUSamplePlane();
-	IMUSamplePlane(float angle, float angularVelocity);
-	IMUSamplePlane(const IMUSamplePlane& t);
-	IMUSamplePlane& operator=(const IMUSamplePlane& t);
-
-	float angle = 0;   			// [rad]
-	float angularVelocity = 0;	// [rad/s]
-};
-
-class IMUSample{
-public:
-	IMUSample();
-	IMUSample(const IMUSamplePlane& x, const IMUSamplePlane& y, const IMUSamplePlane& z);
-	IMUSample(const IMUSample& t);
-	IMUSample& operator=(const IMUSample& t);
-
-	IMUSamplePlane plane[3];
-};
-
+#include <IMUSample.h>
 
 class IMU : public Menuable {
 public:
@@ -64,7 +30,8 @@ public:
 
 	void setNoiseVariance(float noiseVariance);
 
-	void loop();
+	// to be called with the time of the current tick [us]
+	void loop(uint64_t now_us);
 
 	bool isValid();
 	// stateful method to indicate that a new value from IMU is available. returns true only once per new value
@@ -73,6 +40,14 @@ public:
 
 	IMUSample& getSample() { return currentSample; };
 
+	// raw counts of the last sample, as converted by the frontend
+	void getCounts(int16_t accel[3], int16_t gyro[3]);
+	IMUFrontend& getFrontend() { return frontend; };
+
+	// time of the tick [us] that processed the last sample, and the time since the one before [s]
+	uint64_t getLastUpdate_us() { return lastInvocationTime_us; };
+	float getDT() { return dT; };
+
 
 	// call when stable and upright before starting up
 	void calibrate();
@@ -87,14 +62,16 @@ private:
 	float getAngularVelocity(Dimension dim);
 	void updateFilter();
 	MPU9250* mpu9250 = NULL;
-	KalmanFilter kalman[3]; // one kalman filter per dimension
+	IMUFrontend frontend;	// conversion of counts and one kalman filter per dimension
+	int16_t accelCounts[3] = { 0,0,0 };
+	int16_t gyroCounts[3] = { 0,0,0 };
 	float noiseVariance = 0.1; // noise variance used in Kalman filter. The bigger, the more noise, default is 0.03;
 
 	IMUSample currentSample;
 	IMUSample lastSample;
 	bool valueIsUpdated = false;
 	bool logIMUValues = false;
-	uint32_t lastInvocationTime_us = 0;
+	uint64_t lastInvocationTime_us = 0;
 	float sampleRate_us = 0;
 
 	float dT = 0;
@@ -0,0 +1,75 @@
+/*
+ * IMUSample.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <IMUSample.h>
+
+void IMUConfig::initDefaultValues() {
+	// these null values can be calibrated and set in EEPROM
+	nullOffsetX = radians(1.41);
+	nullOffsetY = radians(3.20);
+	kalmanNoiseVariance = 0.1; // noise variance, default is 0.03, the higher the more noise is filtered
+}
+
+void IMUConfig::print() {
+	loggingln("imu configuration");
+	logging("   null=(");
+	logging(degrees(nullOffsetX),3,2);
+	logging(",");
+	logging(degrees(nullOffsetY),3,2);
+	loggingln("))");
+	logging("   kalman noise variance=");
+	loggingln(kalmanNoiseVariance,1,3);
+
+}
+
+
+IMUSamplePlane::IMUSamplePlane() {
+	angle = 0;
+	angularVelocity = 0;
+}
+
+IMUSamplePlane::IMUSamplePlane(float angle, float angularVelocity) {
+	this->angle = angle;
+	this->angularVelocity = angularVelocity;
+}
+
+IMUSamplePlane::IMUSamplePlane(const IMUSamplePlane& t) {
+	this->angle = t.angle;
+	this->angularVelocity = t.angularVelocity;
+}
+
+IMUSamplePlane& IMUSamplePlane::operator=(const IMUSamplePlane& t) {
+	this->angle = t.angle;
+	this->angularVelocity = t.angularVelocity;
+	return * this;
+}
+
+IMUSample::IMUSample() {};
+
+IMUSample::IMUSample(const IMUSamplePlane& x, const IMUSamplePlane& y, const IMUSamplePlane& z) {
+	plane[Dimension::X] = x;
+	plane[Dimension::Y] = y;
+	plane[Dimension::Z] = z;
+}
+
+IMUSample::IMUSample(const IMUSample& t) {
+	this->plane[0] = t.plane[0];
+	this->plane[1] = t.plane[1];
+	this->plane[2] = t.plane[2];
+	this->timestamp_us = t.timestamp_us;
+}
+
+IMUSample& IMUSample::operator=(const IMUSample& t) {
+	this->plane[0] = t.plane[0];
+	this->plane[1] = t.plane[1];
+	this->plane[2] = t.plane[2];
+	this->timestamp_us = t.timestamp_us;
+
+	return *this;
+}
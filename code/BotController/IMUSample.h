@@ -0,0 +1,52 @@
+/*
+ * IMUSample.h
+ *
+ * Orientation as delivered by the IMU and the persistent configuration of the IMU.
+ * Separated from IMU.h, so the control core can be used without the MPU9250 driver.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef IMUSAMPLE_H_
+#define IMUSAMPLE_H_
+
+#include <Arduino.h>
+#include <types.h>
+
+class IMUConfig {
+	public:
+		void initDefaultValues();
+
+		void print();
+
+	float nullOffsetX;
+	float nullOffsetY;
+	float kalmanNoiseVariance;
+};
+
+
+
+class IMUSamplePlane {
+public:
+	IMUSamplePlane();
+	IMUSamplePlane(float angle, float angularVelocity);
+	IMUSamplePlane(const IMUSamplePlane& t);
+	IMUSamplePlane& operator=(const IMUSamplePlane& t);
+
+	float angle = 0;   			// [rad]
+	float angularVelocity = 0;	// [rad/s]
+};
+
+class IMUSample{
+public:
+	IMUSample();
+	IMUSample(const IMUSamplePlane& x, const IMUSamplePlane& y, const IMUSamplePlane& z);
+	IMUSample(const IMUSample& t);
+	IMUSample& operator=(const IMUSample& t);
+
+	IMUSamplePlane plane[3];
+	uint32_t timestamp_us = 0;	// [us] time of the IMU's data-ready interrupt, used to trace the latency
+};
+
+#endif /* IMUSAMPLE_H_ */
@@ -0,0 +1,23 @@
+/*
+ * LQRGains.h
+ *
+ * Gains of the LQR mode of the ControlPlane, generated by Host/tools/control_design out of
+ * the linearised model with the constants of setup.h. Do not edit, run control_design instead:
+ *     control_design -o LQRGains.h -e ObserverGains.h
+ * max values of Bryson's rule: tilt 2.00deg, angular velocity 30.0deg/s, pos 0.100m, speed 0.250m/s,
+ * integrated pos 0.200ms, accel 1.50m/s^2. Spectral radius of the closed loop is 0.998498
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef LQRGAINS_H_
+#define LQRGAINS_H_
+
+// the gains are valid for this sample frequency only
+const int LQRSampleFrequency = 333;
+
+// acceleration [m/s^2] = LQRGain · (tilt, angular velocity, pos, speed, integrated pos) error
+constexpr float LQRGain[] = { 66.883, 11.511, 23.4987, 23.9664, 7.19729 };
+
+#endif /* LQRGAINS_H_ */
@@ -0,0 +1,84 @@
+/*
+ * LatencyTracer.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <setup.h>
+#include <LatencyTracer.h>
+
+LatencyTracer latencyTracer;
+
+static const char* LatencyStageName[NumberOfLatencyStages] = {
+		"imu", "state", "setspeed", "pwm" };
+
+void LatencyHistogram::reset() {
+	count = 0;
+	max_us = 0;
+	sum_us = 0;
+	for (int i = 0;i<NumberOfBuckets;i++)
+		buckets[i] = 0;
+}
+
+void LatencyHistogram::add(uint32_t latency_us) {
+	uint32_t bucket = latency_us / BucketWidth_us;
+	if (bucket >= NumberOfBuckets)
+		bucket = NumberOfBuckets-1;
+	buckets[bucket]++;
+	count++;
+	sum_us += latency_us;
+	if (latency_us > max_us)
+		max_us = latency_us;
+}
+
+uint32_t LatencyHistogram::percentile(float ratio) {
+	uint32_t threshold = ratio * count;
+	uint32_t sum = 0;
+	for (int i = 0;i<NumberOfBuckets;i++) {
+		sum += buckets[i];
+		if (sum > threshold)
+			return (i+1)*BucketWidth_us; // upper bound of the bucket
+	}
+	return max_us;
+}
+
+void LatencyHistogram::print(const char* name) {
+	logging("   ");
+	logging(name);
+	logging(" n=");
+	logging((int)count);
+	if (count > 0) {
+		float mean_us = ((float)sum_us)/count;
+		logging(" mean=");
+		logging(mean_us,0);
+		logging("us p50=");
+		logging((int)percentile(0.5));
+		logging("us p90=");
+		logging((int)percentile(0.9));
+		logging("us p99=");
+		logging((int)percentile(0.99));
+		logging("us max=");
+		logging((int)max_us);
+
+		// a delay of t costs a phase of 360*f*t, show that for a typical frequency of a balancing bot
+		const float referenceFrequency = 5.0; // [Hz]
+		logging("us lag(5Hz)=");
+		logging(360.0*referenceFrequency*mean_us*OneMicrosecond_s,1);
+		logging("deg");
+	}
+	loggingln();
+}
+
+void LatencyTracer::reset() {
+	for (int i = 0;i<NumberOfLatencyStages;i++)
+		stages[i].reset();
+}
+
+void LatencyTracer::print() {
+	loggingln("latency since imu interrupt:");
+	for (int i = 0;i<NumberOfLatencyStages;i++)
+		stages[i].print(LatencyStageName[i]);
+}
@@ -0,0 +1,63 @@
+/*
+ * LatencyTracer.h
+ *
+ * Traces the latency of a control sample from the data-ready interrupt of the IMU
+ * until the new PWM duty reaches the wheels. Each IMUSample carries the time of its interrupt,
+ * every stage of the loop adds the time passed since then. Per stage, a histogram with
+ * linear buckets is kept to compute percentiles.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef LATENCYTRACER_H_
+#define LATENCYTRACER_H_
+
+#include <Arduino.h>
+
+enum LatencyStage {
+	LATENCY_IMU_READ = 0,		// interrupt -> IMU::loop has read and filtered the sample
+	LATENCY_STATE_UPDATE,		// interrupt -> StateController::update is done
+	LATENCY_SET_SPEED,			// interrupt -> BallDrive::setSpeed has passed new wheel speeds
+	LATENCY_PWM,				// interrupt -> next commutation sent the new PWM duty
+	NumberOfLatencyStages
+};
+
+class LatencyHistogram {
+public:
+	static const int BucketWidth_us = 25;
+	static const int NumberOfBuckets = 400;		// covers 10ms, everything above goes into the last bucket
+
+	void reset();
+	void add(uint32_t latency_us);
+
+	// return latency [us] that is not exceeded by the given ratio of all samples (ratio = 0..1)
+	uint32_t percentile(float ratio);
+	void print(const char* name);
+
+	uint32_t count = 0;
+	uint32_t max_us = 0;
+	uint64_t sum_us = 0;
+	uint32_t buckets[NumberOfBuckets];
+};
+
+class LatencyTracer {
+public:
+	LatencyTracer() { reset(); };
+	virtual ~LatencyTracer() {};
+
+	// add the latency of a sample that has been taken at sampleTime_us
+	void add(LatencyStage stage, uint32_t sampleTime_us) {
+		if (sampleTime_us != 0)
+			stages[stage].add(micros() - sampleTime_us);
+	}
+
+	void reset();
+	void print();
+private:
+	LatencyHistogram stages[NumberOfLatencyStages];
+};
+
+extern LatencyTracer latencyTracer;
+
+#endif /* LATENCYTRACER_H_ */
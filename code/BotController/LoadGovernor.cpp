@@ -0,0 +1,95 @@
+/*
+ * LoadGovernor.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <LoadGovernor.h>
+
+LoadGovernor loadGovernor;
+
+static const char* LoadTierName[NumberOfLoadTiers] = {
+		"normal", "log", "memory", "lifter" };
+
+void LoadGovernor::setup(uint32_t window_us) {
+	this->window_us = window_us;
+	windowStart_us = 0;
+	windowStartBusy_us = 0;
+	tier = LOAD_NORMAL;
+	slack = 1.0;
+	recoveryCounter = 0;
+	dwellCounter = 0;
+	for (int i = 0;i<NumberOfLoadTiers;i++)
+		dwellWindows[i] = 0;
+	reset();
+}
+
+void LoadGovernor::setDwell(LoadTier t, uint32_t dwell_us) {
+	dwellWindows[t] = (dwell_us + window_us - 1)/window_us;
+}
+
+bool LoadGovernor::update(uint64_t now_us, uint64_t busy_us) {
+	// first call starts the window
+	if (windowStart_us == 0) {
+		windowStart_us = now_us;
+		windowStartBusy_us = busy_us;
+		return false;
+	}
+
+	uint64_t elapsed_us = now_us - windowStart_us;
+	if (elapsed_us < window_us)
+		return false;
+
+	float idle = 1.0 - ((float)(busy_us - windowStartBusy_us))/elapsed_us;
+	slack = (1.0-SlackFilter)*slack + SlackFilter*constrain(idle, 0.0, 1.0);
+	windowStart_us = now_us;
+	windowStartBusy_us = busy_us;
+
+	// shed more work when the slack is too low and the current tier had the time to take effect,
+	// give it back one tier at a time when there is plenty of slack for a while
+	LoadTier previousTier = tier;
+	dwellCounter++;
+	if (slack < LowSlack) {
+		recoveryCounter = 0;
+		if ((tier < NumberOfLoadTiers-1) && (dwellCounter >= dwellWindows[tier]))
+			enterTier((LoadTier)(tier+1));
+	} else if (slack > HighSlack) {
+		if ((tier > LOAD_NORMAL) && (++recoveryCounter >= RecoveryWindows)) {
+			recoveryCounter = 0;
+			dwellCounter = 0;
+			tier = (LoadTier)(tier-1);
+		}
+	} else
+		recoveryCounter = 0;
+
+	return tier != previousTier;
+}
+
+void LoadGovernor::enterTier(LoadTier t) {
+	tier = t;
+	dwellCounter = 0;
+	entered[t]++;
+}
+
+void LoadGovernor::reset() {
+	for (int i = 0;i<NumberOfLoadTiers;i++)
+		entered[i] = 0;
+}
+
+void LoadGovernor::print() {
+	logging("load: slack=");
+	logging(slack*100.0,0);
+	logging("% tier=");
+	logging(LoadTierName[tier]);
+	logging(" entered");
+	for (int i = LOAD_SHED_DEBUG_LOG;i<NumberOfLoadTiers;i++) {
+		logging(" ");
+		logging(LoadTierName[i]);
+		logging("=");
+		logging((int)entered[i]);
+	}
+	loggingln();
+}
@@ -0,0 +1,78 @@
+/*
+ * LoadGovernor.h
+ *
+ * Watches the slack of the main loop, i.e. the share of time the scheduler has nothing to do,
+ * and sheds non-critical work in tiers when the slack gets low:
+ * 		tier 1: suspend the debug logs (debugBalanceLog, debugStateLog)
+ * 		tier 2: defer saving the configuration to the EEPROM
+ * 		tier 3: rate limit the control of the lifter
+ * A tier is entered when the slack drops below LowSlack and left when the slack is above HighSlack
+ * for a while, so the governor does not toggle with every sample. Before escalating further,
+ * a tier is held for its dwell time, which is to be longer than the period of the work it sheds,
+ * otherwise the next tier is entered before shedding could show any effect.
+ * Per tier, the number of times it has been entered is counted.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef LOADGOVERNOR_H_
+#define LOADGOVERNOR_H_
+
+#include <Arduino.h>
+
+enum LoadTier {
+	LOAD_NORMAL = 0,			// nothing is shed
+	LOAD_SHED_DEBUG_LOG,		// debug logging suspended
+	LOAD_SHED_MEMORY,			// in addition, saving to EEPROM deferred
+	LOAD_SHED_LIFTER,			// in addition, lifter runs with a lower frequency
+	NumberOfLoadTiers
+};
+
+class LoadGovernor {
+public:
+	const float LowSlack = 0.20;			// enter next tier if less than 20% of the time is left
+	const float HighSlack = 0.40;			// leave tier if more than 40% of the time is left...
+	const int RecoveryWindows = 100;		// ... for that many windows in a row
+	const float SlackFilter = 0.2;			// weight of a new measurement in the low pass of the slack
+
+	LoadGovernor() {};
+	virtual ~LoadGovernor() {};
+
+	// set the length of the window the slack is measured in [us]
+	void setup(uint32_t window_us);
+
+	// minimum time [us] a tier is held before the next one is entered, rounded up to windows
+	void setDwell(LoadTier t, uint32_t dwell_us);
+
+	// to be called once per tick with the accumulated busy time of the scheduler.
+	// Returns true if the tier has changed
+	bool update(uint64_t now_us, uint64_t busy_us);
+
+	LoadTier getTier() { return tier; };
+
+	// true if the work belonging to the passed tier is currently shed
+	bool sheds(LoadTier t) { return tier >= t; };
+
+	// low passed ratio of idle time (0..1)
+	float getSlack() { return slack; };
+
+	void reset();
+	void print();
+private:
+	void enterTier(LoadTier t);
+
+	LoadTier tier = LOAD_NORMAL;
+	uint32_t window_us = 0;
+	uint64_t windowStart_us = 0;
+	uint64_t windowStartBusy_us = 0;
+	float slack = 1.0;
+	int recoveryCounter = 0;
+	int dwellCounter = 0;						// windows since the current tier has been entered
+	int dwellWindows[NumberOfLoadTiers];		// windows a tier is held before escalating
+	uint32_t entered[NumberOfLoadTiers];		// number of times a tier has been entered
+};
+
+extern LoadGovernor loadGovernor;
+
+#endif /* LOADGOVERNOR_H_ */
@@ -0,0 +1,774 @@
+/*
+ * MPCTable.h
+ *
+ * Regions of the explicit MPC mode of the ControlPlane, generated by Host/tools/mpc_design out of
+ * the linearised model with the constants of setup.h. Do not edit, run mpc_design instead:
+ *     mpc_design -o MPCTable.h
+ * horizon 3 steps of 20 ticks, limits: accel 2.63m/s^2, tilt 12.0deg, wheel speed 2.70rev/s, i.e. ball speed 0.615m/s.
+ * 45 regions with 693 rows out of 200 choreographies up to 0.85m/s^2, coverage 100.00%
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef MPCTABLE_H_
+#define MPCTABLE_H_
+
+#include <ExplicitMPC.h>
+
+// the table is valid for this sample frequency only
+const int MPCSampleFrequency = 333;
+
+const int MPCRegions = 45;
+const int MPCRows = 693;
+
+// operating range of the parameter, beyond the rows of the regions are not complete
+constexpr float MPCParameterLimit[7] = { 0.313597, 5.31097, 0.219126, 0.728849, 0.295729, 0.103729, 0.442589 };
+
+// rows of all regions, h·p <= k
+constexpr MPCRow MPCRowTable[693] = {
+	{ -0.89784909, -0.16425015, -0.27643533, -0.28889862, -0.083725732, 0, 0, 0.065681142 },
+	{ 0.89784909, 0.16425015, 0.27643533, 0.28889862, 0.083725732, 0, 0, 0.065681142 },
+	{ 0.3262654, -0.049493623, 0.67826387, 0.61956382, 0.21725578, 0, 0, 0.50998369 },
+	{ -0.3262654, 0.049493623, -0.67826387, -0.61956382, -0.21725578, 0, 0, 0.50998369 },
+	{ 0.74777449, 0.10680576, 0.45376089, 0.45147989, 0.14033108, 0, 0, 0.1876825 },
+	{ -0.74777449, -0.10680576, -0.45376089, -0.45147989, -0.14033108, 0, 0, 0.1876825 },
+	{ -0.57679412, -0.0047339783, 0.071787799, 0.075024406, 0.021742829, -0.80995755, 0, 0.16306653 },
+	{ 0.57679412, 0.0047339783, -0.071787799, -0.075024406, -0.021742829, 0.80995755, 0, 0.16306653 },
+	{ -0.22694714, 0.031107763, 0.19622326, 0.20812849, 0.059026294, -0.92855919, 0, 0.1670158 },
+	{ 0.22694714, -0.031107763, -0.19622326, -0.20812849, -0.059026294, 0.92855919, 0, 0.1670158 },
+	{ 0.032996276, 0.051919805, 0.2304628, 0.25039914, 0.068546379, -0.93579065, 0, 0.14177735 },
+	{ -0.032996276, -0.051919805, -0.2304628, -0.25039914, -0.068546379, 0.93579065, 0, 0.14177735 },
+	{ -0.71281176, -0.13039991, -0.21946489, -0.55965686, -0.066470732, 0, -0.33029724, 0.2030359 },
+	{ 0.71281176, 0.13039991, 0.21946489, 0.55965686, 0.066470732, 0, 0.33029724, 0.2030359 },
+	{ -0.73270809, -0.14607814, -0.16187971, -0.53520884, -0.047725612, 0, -0.35618641, 0.21895014 },
+	{ 0.73270809, 0.14607814, 0.16187971, 0.53520884, 0.047725612, 0, 0.35618641, 0.21895014 },
+	{ -0.68017042, -0.15254105, -0.034668737, -0.5347862, -0.0075958863, 0, -0.47628093, 0.29277304 },
+	{ 0.68017042, 0.15254105, 0.034668737, 0.5347862, 0.0075958863, 0, 0.47628093, 0.29277304 },
+	{ 0.89784909, 0.16425015, 0.27643533, 0.28889862, 0.083725732, 0, 0, -0.065681142 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, 0.12249014 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, -0.01753724 },
+	{ 0.26766385, -0.031061755, 0.67889474, 0.64882471, 0.21335337, 0, 0, 0.62721429 },
+	{ -0.26766385, 0.031061755, -0.67889474, -0.64882471, -0.21335337, 0, 0, 0.37443217 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, 0.15711636 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, 0.12736004 },
+	{ -0.5528087, -0.036491493, 0.066630675, 0.072356784, 0.019820311, -0.82643991, 0, 0.17431193 },
+	{ 0.5528087, 0.036491493, -0.066630675, -0.072356784, -0.019820311, 0.82643991, 0, 0.1229842 },
+	{ -0.16733973, 0.015993129, 0.17224998, 0.18971202, 0.05089533, -0.95052122, 0, 0.15870247 },
+	{ 0.16733973, -0.015993129, -0.17224998, -0.18971202, -0.05089533, 0.95052122, 0, 0.12931576 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.3230303 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.54629613 },
+	{ -0.78519309, -0.15319304, -0.19119875, -0.49024537, -0.056874986, 0, -0.28261537, 0.1886363 },
+	{ 0.78519309, 0.15319304, 0.19119875, 0.49024537, 0.056874986, 0, 0.28261537, 0.15881478 },
+	{ -0.80731115, -0.16537582, -0.13860907, -0.45855017, -0.040153922, 0, -0.29967728, 0.21196424 },
+	{ 0.80731115, 0.16537582, 0.13860907, 0.45855017, 0.040153922, 0, 0.29967728, 0.15646297 },
+	{ -0.89784909, -0.16425015, -0.27643533, -0.28889862, -0.083725732, 0, 0, -0.065681142 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, -0.01753724 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, 0.12249014 },
+	{ 0.26766385, -0.031061755, 0.67889474, 0.64882471, 0.21335337, 0, 0, 0.37443217 },
+	{ -0.26766385, 0.031061755, -0.67889474, -0.64882471, -0.21335337, 0, 0, 0.62721429 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, 0.12736004 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, 0.15711636 },
+	{ -0.5528087, -0.036491493, 0.066630675, 0.072356784, 0.019820311, -0.82643991, 0, 0.1229842 },
+	{ 0.5528087, 0.036491493, -0.066630675, -0.072356784, -0.019820311, 0.82643991, 0, 0.17431193 },
+	{ -0.16733973, 0.015993129, 0.17224998, 0.18971202, 0.05089533, -0.95052122, 0, 0.12931576 },
+	{ 0.16733973, -0.015993129, -0.17224998, -0.18971202, -0.05089533, 0.95052122, 0, 0.15870247 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.54629613 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.3230303 },
+	{ -0.78519309, -0.15319304, -0.19119875, -0.49024537, -0.056874986, 0, -0.28261537, 0.15881478 },
+	{ 0.78519309, 0.15319304, 0.19119875, 0.49024537, 0.056874986, 0, 0.28261537, 0.1886363 },
+	{ -0.80731115, -0.16537582, -0.13860907, -0.45855017, -0.040153922, 0, -0.29967728, 0.15646297 },
+	{ 0.80731115, 0.16537582, 0.13860907, 0.45855017, 0.040153922, 0, 0.29967728, 0.21196424 },
+	{ 0.93088841, 0.18352609, 0.20878272, 0.2288012, 0.061844365, 0, 0, -0.1443167 },
+	{ 0.93589957, 0.18690319, 0.19615866, 0.21758835, 0.057760545, 0, 0, -0.15840639 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.17934151 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, 0.15711636 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, 0.12736004 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, 0.17966478 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, 0.073954714 },
+	{ -0.70333975, -0.10308443, 0, 0, 0, -0.70333975, 0, 0.20904645 },
+	{ 0.70333975, 0.10308443, 0, 0, 0, 0.70333975, 0, 0.0040731093 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.3230303 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.54629613 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.21139739 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.65792905 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.099764474 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.76956196 },
+	{ -0.93088841, -0.18352609, -0.20878272, -0.2288012, -0.061844365, 0, 0, -0.1443167 },
+	{ -0.93589957, -0.18690319, -0.19615866, -0.21758835, -0.057760545, 0, 0, -0.15840639 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.17934151 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, 0.12736004 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, 0.15711636 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, 0.073954714 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, 0.17966478 },
+	{ -0.70333975, -0.10308443, 0, 0, 0, -0.70333975, 0, 0.0040731093 },
+	{ 0.70333975, 0.10308443, 0, 0, 0, 0.70333975, 0, 0.20904645 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.54629613 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.3230303 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.65792905 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.21139739 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.76956196 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.099764474 },
+	{ 0.91452089, 0.1743315, 0.24435582, 0.26112265, 0.073248004, 0, 0, -0.10128213 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, -0.12249014 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, 0.17934151 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.097199649 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, 0.15711636 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, 0.12736004 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, 0.17966478 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, 0.073954714 },
+	{ -0.53374322, -0.061214125, 0.057976591, 0.065305434, 0.016943316, -0.83872394, 0, 0.19124543 },
+	{ 0.53374322, 0.061214125, -0.057976591, -0.065305434, -0.016943316, 0.83872394, 0, 0.062897004 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.3230303 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.54629613 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.21139739 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.65792905 },
+	{ -0.84616368, -0.17122105, -0.16085504, -0.41477914, -0.047008936, 0, -0.23359035, 0.19398748 },
+	{ 0.84616368, 0.17122105, 0.16085504, 0.41477914, 0.047008936, 0, 0.23359035, 0.093191594 },
+	{ -0.91452089, -0.1743315, -0.24435582, -0.26112265, -0.073248004, 0, 0, -0.10128213 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, -0.12249014 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.097199649 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, 0.17934151 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, 0.12736004 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, 0.15711636 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, 0.073954714 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, 0.17966478 },
+	{ -0.53374322, -0.061214125, 0.057976591, 0.065305434, 0.016943316, -0.83872394, 0, 0.062897004 },
+	{ 0.53374322, 0.061214125, -0.057976591, -0.065305434, -0.016943316, 0.83872394, 0, 0.19124543 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.54629613 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.3230303 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.65792905 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.21139739 },
+	{ -0.84616368, -0.17122105, -0.16085504, -0.41477914, -0.047008936, 0, -0.23359035, 0.093191594 },
+	{ 0.84616368, 0.17122105, 0.16085504, 0.41477914, 0.047008936, 0, 0.23359035, 0.19398748 },
+	{ -0.79668069, -0.12739728, -0.047139687, -0.05165953, -0.013963436, -0.58650147, 0, -0.20690414 },
+	{ -0.79716618, -0.12804826, -0.044222951, -0.049054165, -0.013021815, -0.58617248, 0, -0.20993393 },
+	{ -0.82340914, -0.13622309, -0.052957942, -0.059652376, -0.015476646, -0.54482858, 0, -0.21494955 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, -0.064994591 },
+	{ -0.67858187, -0.28116419, 0, 0, 0, -0.67858187, 0, -0.35610922 },
+	{ -0.7041708, -0.091032737, 0, 0, 0, -0.7041708, 0, -0.079831139 },
+	{ -0.68656086, -0.23930808, 0, 0, 0, -0.68656086, 0, -0.3595175 },
+	{ -0.70333975, -0.10308443, 0, 0, 0, -0.70333975, 0, -0.10248667 },
+	{ -0.70333975, -0.10308443, 0, 0, 0, -0.70333975, 0, -0.20904645 },
+	{ -0.68311145, -0.10011969, 0, -0.16836501, 0, -0.68311145, -0.16836501, -0.072958867 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, -0.12611937 },
+	{ -0.68311145, -0.10011969, 0, -0.16836501, 0, -0.68311145, -0.16836501, -0.046378615 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, -0.15269962 },
+	{ -0.68311145, -0.10011969, 0, -0.16836501, 0, -0.68311145, -0.16836501, -0.019798363 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, -0.17927988 },
+	{ -0.89942586, -0.17504799, -0.21668816, -0.31955189, -0.064516383, 0, -0.084627349, -0.13593926 },
+	{ -0.91063632, -0.17939034, -0.20904786, -0.29447331, -0.061948504, 0, -0.065631147, -0.14375418 },
+	{ -0.54068996, -0.1094085, -0.10278473, 0.52413984, -0.03003823, 0, 0.63991763, 0.23656787 },
+	{ 0.54068996, 0.1094085, 0.10278473, -0.52413984, 0.03003823, 0, -0.63991763, 0.012612047 },
+	{ -0.77009675, -0.065357253, -0.026829485, -0.069182232, -0.0078407585, -0.62896262, -0.038961221, 0.081026322 },
+	{ 0.60944101, 0.010294593, -0.033517904, -0.086428919, -0.0097954094, 0.78575897, -0.048674004, 0.13432009 },
+	{ -0.76265027, -0.09486063, -0.024210652, -0.062429335, -0.0070754199, -0.63529228, -0.035158205, 0.037442479 },
+	{ 0.62089285, 0.052952516, -0.029594813, -0.076312877, -0.0086489092, 0.77657374, -0.042976972, 0.16220715 },
+	{ -0.72900929, -0.11054674, -0.012608632, -0.099033596, -0.0036847981, -0.6626827, -0.084831102, -0.020753407 },
+	{ 0.60372458, 0.077986275, -0.035774255, -0.01275379, -0.010454815, 0.79191187, 0.027542703, 0.20344449 },
+	{ -0.35591486, -0.072019298, -0.067659132, -0.69395084, -0.019772981, 0, -0.61773889, 0.3197486 },
+	{ -0.35591486, -0.072019298, -0.067659132, -0.69395084, -0.019772981, 0, -0.61773889, 0.40176126 },
+	{ -0.54068996, -0.1094085, -0.10278473, 0.52413984, -0.03003823, 0, 0.63991763, 0.11197791 },
+	{ -0.84616368, -0.17122105, -0.16085504, -0.41477914, -0.047008936, 0, -0.23359035, 0.56520126 },
+	{ -0.84616368, -0.17122105, -0.16085504, -0.41477914, -0.047008936, 0, -0.23359035, -0.19398748 },
+	{ 0.79668069, 0.12739728, 0.047139687, 0.05165953, 0.013963436, 0.58650147, 0, -0.20690414 },
+	{ 0.79716618, 0.12804826, 0.044222951, 0.049054165, 0.013021815, 0.58617248, 0, -0.20993393 },
+	{ 0.82340914, 0.13622309, 0.052957942, 0.059652376, 0.015476646, 0.54482858, 0, -0.21494955 },
+	{ 0.67858187, 0.28116419, 0, 0, 0, 0.67858187, 0, -0.35610922 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, -0.064994591 },
+	{ 0.68656086, 0.23930808, 0, 0, 0, 0.68656086, 0, -0.3595175 },
+	{ 0.7041708, 0.091032737, 0, 0, 0, 0.7041708, 0, -0.079831139 },
+	{ 0.70333975, 0.10308443, 0, 0, 0, 0.70333975, 0, -0.20904645 },
+	{ 0.70333975, 0.10308443, 0, 0, 0, 0.70333975, 0, -0.10248667 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, -0.12611937 },
+	{ 0.68311145, 0.10011969, 0, 0.16836501, 0, 0.68311145, 0.16836501, -0.072958867 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, -0.15269962 },
+	{ 0.68311145, 0.10011969, 0, 0.16836501, 0, 0.68311145, 0.16836501, -0.046378615 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, -0.17927988 },
+	{ 0.68311145, 0.10011969, 0, 0.16836501, 0, 0.68311145, 0.16836501, -0.019798363 },
+	{ 0.89942586, 0.17504799, 0.21668816, 0.31955189, 0.064516383, 0, 0.084627349, -0.13593926 },
+	{ 0.91063632, 0.17939034, 0.20904786, 0.29447331, 0.061948504, 0, 0.065631147, -0.14375418 },
+	{ -0.54068996, -0.1094085, -0.10278473, 0.52413984, -0.03003823, 0, 0.63991763, 0.012612047 },
+	{ 0.54068996, 0.1094085, 0.10278473, -0.52413984, 0.03003823, 0, -0.63991763, 0.23656787 },
+	{ -0.60944101, -0.010294593, 0.033517904, 0.086428919, 0.0097954094, -0.78575897, 0.048674004, 0.13432009 },
+	{ 0.77009675, 0.065357253, 0.026829485, 0.069182232, 0.0078407585, 0.62896262, 0.038961221, 0.081026322 },
+	{ -0.62089285, -0.052952516, 0.029594813, 0.076312877, 0.0086489092, -0.77657374, 0.042976972, 0.16220715 },
+	{ 0.76265027, 0.09486063, 0.024210652, 0.062429335, 0.0070754199, 0.63529228, 0.035158205, 0.037442479 },
+	{ -0.60372458, -0.077986275, 0.035774255, 0.01275379, 0.010454815, -0.79191187, -0.027542703, 0.20344449 },
+	{ 0.72900929, 0.11054674, 0.012608632, 0.099033596, 0.0036847981, 0.6626827, 0.084831102, -0.020753407 },
+	{ 0.35591486, 0.072019298, 0.067659132, 0.69395084, 0.019772981, 0, 0.61773889, 0.3197486 },
+	{ 0.54068996, 0.1094085, 0.10278473, -0.52413984, 0.03003823, 0, -0.63991763, 0.11197791 },
+	{ 0.35591486, 0.072019298, 0.067659132, 0.69395084, 0.019772981, 0, 0.61773889, 0.40176126 },
+	{ 0.84616368, 0.17122105, 0.16085504, 0.41477914, 0.047008936, 0, 0.23359035, -0.19398748 },
+	{ 0.84616368, 0.17122105, 0.16085504, 0.41477914, 0.047008936, 0, 0.23359035, 0.56520126 },
+	{ -0.86166354, -0.16523637, -0.21996807, -0.39154616, -0.065826765, 0, -0.15558077, -0.1395401 },
+	{ -0.81263102, -0.16228593, -0.17032235, 0.26879955, -0.050152829, 0, 0.45772906, 0.26003371 },
+	{ 0.81263102, 0.16228593, 0.17032235, -0.26879955, 0.050152829, 0, -0.45772906, -0.021789106 },
+	{ -0.792508, -0.075545724, -0.043312482, -0.12352397, -0.01275372, -0.58585828, -0.075479735, 0.053788297 },
+	{ 0.53096074, -0.009790015, -0.06064533, -0.17295595, -0.017857521, 0.82030784, -0.10568532, 0.10986292 },
+	{ -0.74762578, -0.092008227, -0.024661992, -0.14540767, -0.0072619284, -0.62996007, -0.11805143, 0.014128491 },
+	{ 0.48029212, 0.0174235, -0.08021705, -0.12592553, -0.023620576, 0.86301855, -0.036945023, 0.15469458 },
+	{ -0.65759921, -0.094258941, 0.0083678191, -0.18512298, 0.0024639738, -0.69752321, -0.19440496, -0.037373551 },
+	{ 0.3764821, 0.026612134, -0.11267183, -0.047468512, -0.033177154, 0.91405467, 0.077512344, 0.20425208 },
+	{ -0.44319984, -0.088508922, -0.092891896, -0.67644176, -0.02735279, 0, -0.57340173, 0.20678743 },
+	{ -0.81263102, -0.16228593, -0.17032235, 0.26879955, -0.050152829, 0, 0.45772906, 0.14091141 },
+	{ -0.79597783, -0.15896021, -0.16683194, -0.47579224, -0.04912505, 0, -0.29073445, 0.25470486 },
+	{ -0.78677603, -0.15402201, -0.18775138, -0.48822532, -0.055778281, 0, -0.28378679, -0.19020753 },
+	{ -0.8056922, -0.16443299, -0.14283499, -0.4611657, -0.041496853, 0, -0.2983693, -0.21013972 },
+	{ -0.79597783, -0.15896021, -0.16683194, -0.47579224, -0.04912505, 0, -0.29073445, -0.19961454 },
+	{ 0.86166354, 0.16523637, 0.21996807, 0.39154616, 0.065826765, 0, 0.15558077, -0.1395401 },
+	{ -0.81263102, -0.16228593, -0.17032235, 0.26879955, -0.050152829, 0, 0.45772906, -0.021789106 },
+	{ 0.81263102, 0.16228593, 0.17032235, -0.26879955, 0.050152829, 0, -0.45772906, 0.26003371 },
+	{ -0.53096074, 0.009790015, 0.06064533, 0.17295595, 0.017857521, -0.82030784, 0.10568532, 0.10986292 },
+	{ 0.792508, 0.075545724, 0.043312482, 0.12352397, 0.01275372, 0.58585828, 0.075479735, 0.053788297 },
+	{ -0.48029212, -0.0174235, 0.08021705, 0.12592553, 0.023620576, -0.86301855, 0.036945023, 0.15469458 },
+	{ 0.74762578, 0.092008227, 0.024661992, 0.14540767, 0.0072619284, 0.62996007, 0.11805143, 0.014128491 },
+	{ -0.3764821, -0.026612134, 0.11267183, 0.047468512, 0.033177154, -0.91405467, -0.077512344, 0.20425208 },
+	{ 0.65759921, 0.094258941, -0.0083678191, 0.18512298, -0.0024639738, 0.69752321, 0.19440496, -0.037373551 },
+	{ 0.81263102, 0.16228593, 0.17032235, -0.26879955, 0.050152829, 0, -0.45772906, 0.14091141 },
+	{ 0.44319984, 0.088508922, 0.092891896, 0.67644176, 0.02735279, 0, 0.57340173, 0.20678743 },
+	{ 0.78677603, 0.15402201, 0.18775138, 0.48822532, 0.055778281, 0, 0.28378679, -0.19020753 },
+	{ 0.79597783, 0.15896021, 0.16683194, 0.47579224, 0.04912505, 0, 0.29073445, 0.25470486 },
+	{ 0.8056922, 0.16443299, 0.14283499, 0.4611657, 0.041496853, 0, 0.2983693, -0.21013972 },
+	{ 0.79597783, 0.15896021, 0.16683194, 0.47579224, 0.04912505, 0, 0.29073445, -0.19961454 },
+	{ -0.35680095, -0.065272228, -0.10985408, 0.59400552, -0.033272207, 0, 0.70881246, 0.57371528 },
+	{ 0.35680095, 0.065272228, 0.10985408, -0.59400552, 0.033272207, 0, -0.70881246, -0.29770814 },
+	{ -0.73124636, -0.14483664, -0.16658484, -0.5373034, -0.049256192, 0, -0.35416025, -0.16602254 },
+	{ 0.73124636, 0.14483664, 0.16658484, 0.5373034, 0.049256192, 0, 0.35416025, 0.26938676 },
+	{ 0.49303349, 0.023818937, 0.64652656, 0.086924005, 0.20223076, 0, -0.53842454, 0.084412951 },
+	{ -0.49303349, -0.023818937, -0.64652656, -0.086924005, -0.20223076, 0, 0.53842454, 0.74635921 },
+	{ -0.72142907, -0.048799411, -0.016307747, -0.13075355, -0.0049392315, -0.66846226, -0.11371056, 0.064681041 },
+	{ 0.62905097, 0.0186662, -0.044879488, -0.011092979, -0.013592937, 0.77481746, 0.035809934, 0.17800448 },
+	{ -0.56422198, -0.040892264, 0.054642392, -0.11146744, 0.016202244, -0.79686845, -0.17119804, 0.038092606 },
+	{ 0.41876004, 0.006800014, -0.12684148, -0.04253861, -0.03802791, 0.89252875, 0.092961302, 0.2176791 },
+	{ -0.22530529, 0.0054576024, 0.15473227, 0.051465458, 0.045587754, -0.95191908, -0.11995331, 0.070484803 },
+	{ 0.033771142, -0.040488459, -0.21366507, -0.2018079, -0.063437323, 0.95175802, 0.031199058, 0.16337476 },
+	{ -0.71281176, -0.13039991, -0.21946489, -0.55965686, -0.066470732, 0, -0.33029724, 0.87045853 },
+	{ -0.71281176, -0.13039991, -0.21946489, -0.55965686, -0.066470732, 0, -0.33029724, -0.2030359 },
+	{ -0.72655901, -0.14096587, -0.18108885, -0.54365275, -0.053975495, 0, -0.34781574, 0.079054279 },
+	{ 0.73124636, 0.14483664, 0.16658484, 0.5373034, 0.049256192, 0, 0.35416025, 0.21770465 },
+	{ -0.70152198, -0.14279906, -0.12607813, -0.55118248, -0.036691681, 0, -0.40795985, 0.050500596 },
+	{ 0.69411362, 0.14700038, 0.089257597, 0.54551558, 0.024965531, 0, 0.43637108, 0.26824019 },
+	{ -0.73582277, -0.14026699, -0.1966085, 0.3277847, -0.058935285, 0, 0.53788377, 0.47062299 },
+	{ 0.73582277, 0.14026699, 0.1966085, -0.3277847, 0.058935285, 0, -0.53788377, -0.19065844 },
+	{ -0.69181493, -0.14705544, -0.085041392, -0.54572979, -0.023642395, 0, -0.44062999, -0.21443705 },
+	{ 0.69181493, 0.14705544, 0.085041392, 0.54572979, 0.023642395, 0, 0.44062999, 0.32727929 },
+	{ -0.73915807, -0.056795555, -0.027402407, -0.16281336, -0.0082141346, -0.6366024, -0.1335307, 0.046083214 },
+	{ 0.5182205, -0.012089613, -0.085767772, -0.1318655, -0.025709713, 0.83921314, -0.04021265, 0.1442375 },
+	{ -0.65125967, -0.067880161, 0.0096146764, -0.21711961, 0.0028820916, -0.68724335, -0.22739401, -0.016169207 },
+	{ 0.41339822, 0.0055436528, -0.12863022, -0.047372328, -0.038558143, 0.89480693, 0.09008404, 0.21632019 },
+	{ -0.47585818, -0.050802061, 0.070363262, -0.16137686, 0.02066303, -0.82584581, -0.23986745, -0.022327994 },
+	{ 0.15994216, -0.015755482, -0.18613026, -0.11033714, -0.055297188, 0.95695258, 0.092387735, 0.20177485 },
+	{ -0.72248707, -0.13772486, -0.19304526, -0.54876387, -0.05786717, 0, -0.34247253, 0.32464834 },
+	{ -0.71422756, -0.13144237, -0.21575449, -0.55816075, -0.065262082, 0, -0.33203814, -0.20410605 },
+	{ -0.73124636, -0.14483664, -0.16658484, -0.5373034, -0.049256192, 0, -0.35416025, -0.21770465 },
+	{ -0.70770599, -0.14326628, -0.13412587, -0.54869681, -0.039186854, 0, -0.39753422, -0.0023807621 },
+	{ 0.69181493, 0.14705544, 0.085041392, 0.54572979, 0.023642395, 0, 0.44062999, 0.27085817 },
+	{ -0.72248707, -0.13772486, -0.19304526, -0.54876387, -0.05786717, 0, -0.34247253, -0.21052013 },
+	{ -0.35680095, -0.065272228, -0.10985408, 0.59400552, -0.033272207, 0, 0.70881246, -0.29770814 },
+	{ 0.35680095, 0.065272228, 0.10985408, -0.59400552, 0.033272207, 0, -0.70881246, 0.57371528 },
+	{ -0.73124636, -0.14483664, -0.16658484, -0.5373034, -0.049256192, 0, -0.35416025, 0.26938676 },
+	{ 0.73124636, 0.14483664, 0.16658484, 0.5373034, 0.049256192, 0, 0.35416025, -0.16602254 },
+	{ 0.49303349, 0.023818937, 0.64652656, 0.086924005, 0.20223076, 0, -0.53842454, 0.74635921 },
+	{ -0.49303349, -0.023818937, -0.64652656, -0.086924005, -0.20223076, 0, 0.53842454, 0.084412951 },
+	{ -0.62905097, -0.0186662, 0.044879488, 0.011092979, 0.013592937, -0.77481746, -0.035809934, 0.17800448 },
+	{ 0.72142907, 0.048799411, 0.016307747, 0.13075355, 0.0049392315, 0.66846226, 0.11371056, 0.064681041 },
+	{ -0.41876004, -0.006800014, 0.12684148, 0.04253861, 0.03802791, -0.89252875, -0.092961302, 0.2176791 },
+	{ 0.56422198, 0.040892264, -0.054642392, 0.11146744, -0.016202244, 0.79686845, 0.17119804, 0.038092606 },
+	{ -0.033771142, 0.040488459, 0.21366507, 0.2018079, 0.063437323, -0.95175802, -0.031199058, 0.16337476 },
+	{ 0.22530529, -0.0054576024, -0.15473227, -0.051465458, -0.045587754, 0.95191908, 0.11995331, 0.070484803 },
+	{ 0.71281176, 0.13039991, 0.21946489, 0.55965686, 0.066470732, 0, 0.33029724, -0.2030359 },
+	{ 0.71281176, 0.13039991, 0.21946489, 0.55965686, 0.066470732, 0, 0.33029724, 0.87045853 },
+	{ -0.73124636, -0.14483664, -0.16658484, -0.5373034, -0.049256192, 0, -0.35416025, 0.21770465 },
+	{ 0.72655901, 0.14096587, 0.18108885, 0.54365275, 0.053975495, 0, 0.34781574, 0.079054279 },
+	{ -0.69411362, -0.14700038, -0.089257597, -0.54551558, -0.024965531, 0, -0.43637108, 0.26824019 },
+	{ 0.70152198, 0.14279906, 0.12607813, 0.55118248, 0.036691681, 0, 0.40795985, 0.050500596 },
+	{ -0.73582277, -0.14026699, -0.1966085, 0.3277847, -0.058935285, 0, 0.53788377, -0.19065844 },
+	{ 0.73582277, 0.14026699, 0.1966085, -0.3277847, 0.058935285, 0, -0.53788377, 0.47062299 },
+	{ -0.69181493, -0.14705544, -0.085041392, -0.54572979, -0.023642395, 0, -0.44062999, 0.32727929 },
+	{ 0.69181493, 0.14705544, 0.085041392, 0.54572979, 0.023642395, 0, 0.44062999, -0.21443705 },
+	{ -0.5182205, 0.012089613, 0.085767772, 0.1318655, 0.025709713, -0.83921314, 0.04021265, 0.1442375 },
+	{ 0.73915807, 0.056795555, 0.027402407, 0.16281336, 0.0082141346, 0.6366024, 0.1335307, 0.046083214 },
+	{ -0.41339822, -0.0055436528, 0.12863022, 0.047372328, 0.038558143, -0.89480693, -0.09008404, 0.21632019 },
+	{ 0.65125967, 0.067880161, -0.0096146764, 0.21711961, -0.0028820916, 0.68724335, 0.22739401, -0.016169207 },
+	{ -0.15994216, 0.015755482, 0.18613026, 0.11033714, 0.055297188, -0.95695258, -0.092387735, 0.20177485 },
+	{ 0.47585818, 0.050802061, -0.070363262, 0.16137686, -0.02066303, 0.82584581, 0.23986745, -0.022327994 },
+	{ 0.71422756, 0.13144237, 0.21575449, 0.55816075, 0.065262082, 0, 0.33203814, -0.20410605 },
+	{ 0.72248707, 0.13772486, 0.19304526, 0.54876387, 0.05786717, 0, 0.34247253, 0.32464834 },
+	{ 0.73124636, 0.14483664, 0.16658484, 0.5373034, 0.049256192, 0, 0.35416025, -0.21770465 },
+	{ -0.69181493, -0.14705544, -0.085041392, -0.54572979, -0.023642395, 0, -0.44062999, 0.27085817 },
+	{ 0.70770599, 0.14326628, 0.13412587, 0.54869681, 0.039186854, 0, 0.39753422, -0.0023807621 },
+	{ 0.72248707, 0.13772486, 0.19304526, 0.54876387, 0.05786717, 0, 0.34247253, -0.21052013 },
+	{ -0.91106002, -0.17961689, -0.20433554, 0.071365237, -0.06052705, 0, 0.29529286, 0.3032852 },
+	{ 0.91106002, 0.17961689, 0.20433554, -0.071365237, 0.06052705, 0, -0.29529286, -0.059751753 },
+	{ -0.75025136, -0.063297644, -0.03138733, -0.1889239, -0.0092973667, -0.61030634, -0.1545271, 0.027882473 },
+	{ 0.39501298, -0.042337228, -0.10587487, -0.24700391, -0.031361619, 0.86707163, -0.13097755, 0.094052384 },
+	{ -0.64558287, -0.065613237, 0.011659996, -0.2081842, 0.003453854, -0.69757067, -0.22096218, -0.010357986 },
+	{ 0.21890759, -0.039460911, -0.16052126, -0.21740917, -0.047548647, 0.93461523, -0.041496818, 0.14259671 },
+	{ -0.5219811, -0.063695205, 0.056787763, -0.21088979, 0.016821331, -0.77517769, -0.27312248, -0.050446575 },
+	{ 0.087364687, -0.031283184, -0.19546668, -0.16806574, -0.057899969, 0.95888159, 0.046142659, 0.17363995 },
+	{ -0.71487196, -0.14093811, -0.16033384, -0.54920775, -0.047493128, 0, -0.3735008, 0.14243021 },
+	{ -0.71216855, -0.13420486, -0.19540608, -0.55736086, -0.058775793, 0, -0.35002249, -0.21516114 },
+	{ -0.73256604, -0.1446993, -0.16977034, -0.53678613, -0.050257839, 0, -0.35060225, -0.21551752 },
+	{ -0.69181493, -0.14705544, -0.085041392, -0.54572979, -0.023642395, 0, -0.44062999, -0.27085817 },
+	{ -0.71487196, -0.14093811, -0.16033384, -0.54920775, -0.047493128, 0, -0.3735008, -0.22959341 },
+	{ -0.91106002, -0.17961689, -0.20433554, 0.071365237, -0.06052705, 0, 0.29529286, -0.030861127 },
+	{ -0.81263102, -0.16228593, -0.17032235, 0.26879955, -0.050152829, 0, 0.45772906, 0.021789106 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.055297377 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, 0.083577989 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, 0.01178962 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, 0.11326922 },
+	{ -0.68311145, -0.10011969, 0, -0.16836501, 0, -0.68311145, -0.16836501, -0.035552997 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, 0.14187401 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.16744937 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.22326583 },
+	{ 0.54068996, 0.1094085, 0.10278473, -0.52413984, 0.03003823, 0, -0.63991763, -0.11197791 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.13827058 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, -0.21139739 },
+	{ -0.91106002, -0.17961689, -0.20433554, 0.071365237, -0.06052705, 0, 0.29529286, -0.099580323 },
+	{ -0.81263102, -0.16228593, -0.17032235, 0.26879955, -0.050152829, 0, 0.45772906, -0.072962278 },
+	{ -0.54068996, -0.1094085, -0.10278473, 0.52413984, -0.03003823, 0, 0.63991763, -0.012612047 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.090016218 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, 0.11829683 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, 0.043054329 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, 0.14453392 },
+	{ -0.68311145, -0.10011969, 0, -0.16836501, 0, -0.68311145, -0.16836501, -0.019798363 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, 0.17927988 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.22326583 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.27908229 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.33489874 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, -0.099764474 },
+	{ 0.91106002, 0.17961689, 0.20433554, -0.071365237, 0.06052705, 0, -0.29529286, -0.099580323 },
+	{ 0.81263102, 0.16228593, 0.17032235, -0.26879955, 0.050152829, 0, -0.45772906, -0.072962278 },
+	{ 0.54068996, 0.1094085, 0.10278473, -0.52413984, 0.03003823, 0, -0.63991763, -0.012612047 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.11829683 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.090016218 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, 0.14453392 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, 0.043054329 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, 0.17927988 },
+	{ 0.68311145, 0.10011969, 0, 0.16836501, 0, 0.68311145, 0.16836501, -0.019798363 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.22326583 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.27908229 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, -0.099764474 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.33489874 },
+	{ 0.8784596, 0.16346699, 0.25583821, 0.35140957, 0.077187985, 0, 0.081776567, -0.10222524 },
+	{ -0.44199498, -0.086234273, -0.10762816, 0.56516572, -0.032015639, 0, 0.68204323, -0.14527967 },
+	{ 0.44199498, 0.086234273, 0.10762816, -0.56516572, 0.032015639, 0, -0.68204323, 0.41086304 },
+	{ -0.8056922, -0.16443299, -0.14283499, -0.4611657, -0.041496853, 0, -0.2983693, 0.25368034 },
+	{ 0.8056922, 0.16443299, 0.14283499, 0.4611657, 0.041496853, 0, 0.2983693, -0.1665991 },
+	{ -0.63434698, -0.01910129, 0.032110536, 0.08233339, 0.0095517688, -0.76621484, 0.047463338, 0.13871538 },
+	{ 0.75665221, 0.059445447, 0.027053753, 0.069367489, 0.0080475518, 0.64555096, 0.039988789, 0.089681238 },
+	{ -0.61501276, -0.052220298, 0.04135242, 0.012500018, 0.012300908, -0.78483413, -0.032406147, 0.18716649 },
+	{ 0.72561623, 0.084146004, 0.014757755, 0.11709035, 0.0043899195, 0.66501077, 0.10106435, 0.031504531 },
+	{ -0.38270269, -0.028014667, 0.11109398, 0.043211696, 0.032717581, -0.91163451, -0.079979913, 0.20559371 },
+	{ 0.55114825, 0.065981776, -0.047730959, 0.092823195, -0.013905272, 0.81191537, 0.14692751, 0.012389628 },
+	{ 0.44199498, 0.086234273, 0.10762816, -0.56516572, 0.032015639, 0, -0.68204323, 0.27807135 },
+	{ 0.28159139, 0.054939151, 0.068569021, 0.71169285, 0.020396902, 0, 0.63723114, 0.34635798 },
+	{ 0.78519309, 0.15319304, 0.19119875, 0.49024537, 0.056874986, 0, 0.28261537, -0.1886363 },
+	{ 0.78519309, 0.15319304, 0.19119875, 0.49024537, 0.056874986, 0, 0.28261537, 0.72988797 },
+	{ -0.8056922, -0.16443299, -0.14283499, -0.4611657, -0.041496853, 0, -0.2983693, 0.21013972 },
+	{ 0.80049767, 0.16146956, 0.15593939, 0.46920086, 0.045662003, 0, 0.29424396, 0.043324845 },
+	{ 0.91106002, 0.17961689, 0.20433554, -0.071365237, 0.06052705, 0, -0.29529286, -0.030861127 },
+	{ 0.81263102, 0.16228593, 0.17032235, -0.26879955, 0.050152829, 0, -0.45772906, 0.021789106 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.083577989 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.055297377 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, 0.11326922 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, 0.01178962 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, 0.14187401 },
+	{ 0.68311145, 0.10011969, 0, 0.16836501, 0, 0.68311145, 0.16836501, -0.035552997 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.16744937 },
+	{ -0.54068996, -0.1094085, -0.10278473, 0.52413984, -0.03003823, 0, 0.63991763, -0.11197791 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.22326583 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.13827058 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, -0.21139739 },
+	{ -0.8784596, -0.16346699, -0.25583821, -0.35140957, -0.077187985, 0, -0.081776567, -0.10222524 },
+	{ -0.44199498, -0.086234273, -0.10762816, 0.56516572, -0.032015639, 0, 0.68204323, 0.41086304 },
+	{ 0.44199498, 0.086234273, 0.10762816, -0.56516572, 0.032015639, 0, -0.68204323, -0.14527967 },
+	{ -0.8056922, -0.16443299, -0.14283499, -0.4611657, -0.041496853, 0, -0.2983693, -0.1665991 },
+	{ 0.8056922, 0.16443299, 0.14283499, 0.4611657, 0.041496853, 0, 0.2983693, 0.25368034 },
+	{ -0.75665221, -0.059445447, -0.027053753, -0.069367489, -0.0080475518, -0.64555096, -0.039988789, 0.089681238 },
+	{ 0.63434698, 0.01910129, -0.032110536, -0.08233339, -0.0095517688, 0.76621484, -0.047463338, 0.13871538 },
+	{ -0.72561623, -0.084146004, -0.014757755, -0.11709035, -0.0043899195, -0.66501077, -0.10106435, 0.031504531 },
+	{ 0.61501276, 0.052220298, -0.04135242, -0.012500018, -0.012300908, 0.78483413, 0.032406147, 0.18716649 },
+	{ -0.55114825, -0.065981776, 0.047730959, -0.092823195, 0.013905272, -0.81191537, -0.14692751, 0.012389628 },
+	{ 0.38270269, 0.028014667, -0.11109398, -0.043211696, -0.032717581, 0.91163451, 0.079979913, 0.20559371 },
+	{ -0.28159139, -0.054939151, -0.068569021, -0.71169285, -0.020396902, 0, -0.63723114, 0.34635798 },
+	{ -0.44199498, -0.086234273, -0.10762816, 0.56516572, -0.032015639, 0, 0.68204323, 0.27807135 },
+	{ -0.78519309, -0.15319304, -0.19119875, -0.49024537, -0.056874986, 0, -0.28261537, 0.72988797 },
+	{ -0.78519309, -0.15319304, -0.19119875, -0.49024537, -0.056874986, 0, -0.28261537, -0.1886363 },
+	{ -0.80049767, -0.16146956, -0.15593939, -0.46920086, -0.045662003, 0, -0.29424396, 0.043324845 },
+	{ 0.8056922, 0.16443299, 0.14283499, 0.4611657, 0.041496853, 0, 0.2983693, 0.21013972 },
+	{ -0.91106002, -0.17961689, -0.20433554, 0.071365237, -0.06052705, 0, 0.29529286, -0.059751753 },
+	{ 0.91106002, 0.17961689, 0.20433554, -0.071365237, 0.06052705, 0, -0.29529286, 0.3032852 },
+	{ -0.39501298, 0.042337228, 0.10587487, 0.24700391, 0.031361619, -0.86707163, 0.13097755, 0.094052384 },
+	{ 0.75025136, 0.063297644, 0.03138733, 0.1889239, 0.0092973667, 0.61030634, 0.1545271, 0.027882473 },
+	{ -0.21890759, 0.039460911, 0.16052126, 0.21740917, 0.047548647, -0.93461523, 0.041496818, 0.14259671 },
+	{ 0.64558287, 0.065613237, -0.011659996, 0.2081842, -0.003453854, 0.69757067, 0.22096218, -0.010357986 },
+	{ -0.087364687, 0.031283184, 0.19546668, 0.16806574, 0.057899969, -0.95888159, -0.046142659, 0.17363995 },
+	{ 0.5219811, 0.063695205, -0.056787763, 0.21088979, -0.016821331, 0.77517769, 0.27312248, -0.050446575 },
+	{ 0.71216855, 0.13420486, 0.19540608, 0.55736086, 0.058775793, 0, 0.35002249, -0.21516114 },
+	{ 0.71487196, 0.14093811, 0.16033384, 0.54920775, 0.047493128, 0, 0.3735008, 0.14243021 },
+	{ 0.73256604, 0.1446993, 0.16977034, 0.53678613, 0.050257839, 0, 0.35060225, -0.21551752 },
+	{ 0.69181493, 0.14705544, 0.085041392, 0.54572979, 0.023642395, 0, 0.44062999, -0.27085817 },
+	{ 0.71487196, 0.14093811, 0.16033384, 0.54920775, 0.047493128, 0, 0.3735008, -0.22959341 },
+	{ -0.78243382, -0.11397263, -0.10087472, -0.099355409, -0.031350481, -0.59479198, 0, 0.1488865 },
+	{ 0.78243382, 0.11397263, 0.10087472, 0.099355409, 0.031350481, 0.59479198, 0, -0.031341916 },
+	{ 0.15696499, 0.02125512, 0.45445675, 0.4466993, 0.14139284, -0.74084214, 0, 0.31676106 },
+	{ -0.15696499, -0.02125512, -0.45445675, -0.4466993, -0.14139284, 0.74084214, 0, 0.092277866 },
+	{ 0.22197486, -0.017004872, -0.082442478, -0.10379453, -0.022682469, 0.96558451, 0, -0.082032889 },
+	{ -0.22197486, 0.017004872, 0.082442478, 0.10379453, 0.022682469, -0.96558451, 0, 0.21054968 },
+	{ -0.83314705, -0.039594502, -0.045073873, -0.05316012, -0.012855645, -0.54706065, 0, 0.13970708 },
+	{ 0.53936489, 0.00047424444, -0.085080235, -0.089646648, -0.025672725, 0.83255693, 0, 0.14234894 },
+	{ -0.94706725, -0.058358641, -0.044597526, -0.067152461, -0.010816448, -0.30502868, 0, 0.1433428 },
+	{ 0.36156958, -0.018864993, -0.1717714, -0.17895524, -0.052094845, 0.89703249, 0, 0.32998548 },
+	{ -0.032996276, -0.051919805, -0.2304628, -0.25039914, -0.068546379, 0.93579065, 0, -0.14177735 },
+	{ -0.032996276, -0.051919805, -0.2304628, -0.25039914, -0.068546379, 0.93579065, 0, 0.47143887 },
+	{ -0.72376193, -0.1214377, -0.17018735, -0.51460429, -0.05184574, -0.2236385, -0.33902519, 0.24228348 },
+	{ 0.57803201, 0.071002131, 0.011161304, 0.28385757, 0.0043310127, 0.70855011, 0.27942079, 0.064412629 },
+	{ -0.70800239, -0.12017261, -0.053156675, -0.41245221, -0.015393638, -0.43300148, -0.35159841, 0.28173194 },
+	{ 0.50180102, 0.061245648, -0.080096905, 0.17290737, -0.024128543, 0.80072481, 0.25766224, 0.037072536 },
+	{ -0.5639485, -0.14732064, -0.13586211, -0.54849851, -0.038219459, 0.43814553, -0.38407989, 0.16971503 },
+	{ 0.66426225, 0.13239966, -0.051311985, 0.43871867, -0.017962826, 0.34837327, 0.47374298, 0.23843251 },
+	{ 0.85384475, 0.12502364, 0.081610011, 0.089434935, 0.024174029, 0.48997453, 0, -0.18127365 },
+	{ 0.89420188, 0.14283437, 0.10505421, 0.11653104, 0.030934084, 0.39297399, 0, -0.18497905 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.17934151 },
+	{ 0.6621587, 0.35084429, 0, 0, 0, 0.6621587, 0, -0.34880983 },
+	{ 0.70583169, 0.060027015, 0, 0, 0, 0.70583169, 0, -0.03496094 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, -0.17966478 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, -0.052855034 },
+	{ -0.68656086, -0.23930808, 0, 0, 0, -0.68656086, 0, 0.3595175 },
+	{ 0.7041708, 0.091032737, 0, 0, 0, 0.7041708, 0, -0.079831139 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, -0.082004507 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, -0.019475089 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, -0.11326922 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, 0.01178962 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, -0.14453392 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, 0.043054329 },
+	{ -0.91106002, -0.17961689, -0.20433554, 0.071365237, -0.06052705, 0, 0.29529286, 0.059751753 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.020578535 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, 0.048859147 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, -0.0067415836 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, 0.069271001 },
+	{ -0.68311145, -0.10011969, 0, -0.16836501, 0, -0.68311145, -0.16836501, -0.029821519 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, 0.082982024 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.11163291 },
+	{ 0.81263102, 0.16228593, 0.17032235, -0.26879955, 0.050152829, 0, -0.45772906, -0.14091141 },
+	{ -0.92959671, -0.18341119, -0.21129472, -0.23162355, -0.06257282, 0, 0, -0.074076906 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.08347405 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, -0.3230303 },
+	{ 0.91106002, 0.17961689, 0.20433554, -0.071365237, 0.06052705, 0, -0.29529286, 0.059751753 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.048859147 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.020578535 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, 0.069271001 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, -0.0067415836 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, 0.082982024 },
+	{ 0.68311145, 0.10011969, 0, 0.16836501, 0, 0.68311145, 0.16836501, -0.029821519 },
+	{ -0.81263102, -0.16228593, -0.17032235, 0.26879955, -0.050152829, 0, 0.45772906, -0.14091141 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.11163291 },
+	{ 0.92959671, 0.18341119, 0.21129472, 0.23162355, 0.06257282, 0, 0, -0.074076906 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.08347405 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, -0.3230303 },
+	{ -0.78643996, -0.12361856, -0.054440338, -0.1100894, -0.016355429, -0.59004707, -0.052193589, -0.20246003 },
+	{ -0.76963351, -0.11964862, -0.040551427, -0.086507244, -0.012131162, -0.61824283, -0.043002058, -0.20591965 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, -0.10446814 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, 0.17927988 },
+	{ -0.70446823, -0.071343977, 0, -0.034344218, 0, -0.70446823, -0.034344218, -0.041218477 },
+	{ 0.31880485, -0.45695953, 0, -0.54217844, 0, 0.31880485, -0.54217844, -0.40978666 },
+	{ -0.70357848, -0.088689355, 0, -0.032317494, 0, -0.70357848, -0.032317494, -0.060216629 },
+	{ 0.62071918, -0.059095523, 0, -0.33609755, 0, 0.62071918, -0.33609755, -0.03115289 },
+	{ -0.69985982, -0.1025744, 0, -0.070253006, 0, -0.69985982, -0.070253006, -0.068706484 },
+	{ -0.60372458, -0.077986275, 0.035774255, 0.01275379, 0.010454815, -0.79191187, -0.027542703, -0.20344449 },
+	{ -0.64262362, -0.09418562, 0, -0.28740115, 0, -0.64262362, -0.28740115, -0.02789867 },
+	{ -0.64262362, -0.09418562, 0, -0.28740115, 0, -0.64262362, -0.28740115, 0.0072901635 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, -0.14187401 },
+	{ -0.86048163, -0.15623365, -0.10263186, -0.29682735, -0.029993555, -0.32059584, -0.18122176, -0.22359956 },
+	{ -0.69985982, -0.1025744, 0, -0.070253006, 0, -0.69985982, -0.070253006, -0.21792402 },
+	{ -0.85384475, -0.12502364, -0.081610011, -0.089434935, -0.024174029, -0.48997453, 0, -0.18127365 },
+	{ -0.89420188, -0.14283437, -0.10505421, -0.11653104, -0.030934084, -0.39297399, 0, -0.18497905 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.17934151 },
+	{ -0.70583169, -0.060027015, 0, 0, 0, -0.70583169, 0, -0.03496094 },
+	{ -0.6621587, -0.35084429, 0, 0, 0, -0.6621587, 0, -0.34880983 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, -0.052855034 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, -0.17966478 },
+	{ -0.7041708, -0.091032737, 0, 0, 0, -0.7041708, 0, -0.079831139 },
+	{ 0.68656086, 0.23930808, 0, 0, 0, 0.68656086, 0, 0.3595175 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, -0.019475089 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, -0.082004507 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, 0.01178962 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, -0.11326922 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, 0.043054329 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, -0.14453392 },
+	{ 0.78643996, 0.12361856, 0.054440338, 0.1100894, 0.016355429, 0.59004707, 0.052193589, -0.20246003 },
+	{ 0.76963351, 0.11964862, 0.040551427, 0.086507244, 0.012131162, 0.61824283, 0.043002058, -0.20591965 },
+	{ -0.68311145, -0.10011969, 0, 0.16836501, 0, -0.68311145, 0.16836501, 0.17927988 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, -0.10446814 },
+	{ -0.31880485, 0.45695953, 0, 0.54217844, 0, -0.31880485, 0.54217844, -0.40978666 },
+	{ 0.70446823, 0.071343977, 0, 0.034344218, 0, 0.70446823, 0.034344218, -0.041218477 },
+	{ -0.62071918, 0.059095523, 0, 0.33609755, 0, -0.62071918, 0.33609755, -0.03115289 },
+	{ 0.70357848, 0.088689355, 0, 0.032317494, 0, 0.70357848, 0.032317494, -0.060216629 },
+	{ 0.60372458, 0.077986275, -0.035774255, -0.01275379, -0.010454815, 0.79191187, 0.027542703, -0.20344449 },
+	{ 0.69985982, 0.1025744, 0, 0.070253006, 0, 0.69985982, 0.070253006, -0.068706484 },
+	{ 0.64262362, 0.09418562, 0, 0.28740115, 0, 0.64262362, 0.28740115, -0.02789867 },
+	{ 0.68311145, 0.10011969, 0, -0.16836501, 0, 0.68311145, -0.16836501, -0.14187401 },
+	{ 0.64262362, 0.09418562, 0, 0.28740115, 0, 0.64262362, 0.28740115, 0.0072901635 },
+	{ 0.86048163, 0.15623365, 0.10263186, 0.29682735, 0.029993555, 0.32059584, 0.18122176, -0.22359956 },
+	{ 0.69985982, 0.1025744, 0, 0.070253006, 0, 0.69985982, 0.070253006, -0.21792402 },
+	{ -0.73582277, -0.14026699, -0.1966085, 0.3277847, -0.058935285, 0, 0.53788377, 0.19065844 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.042403122 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, 0.12454498 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.020578535 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, 0.048859147 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, -0.0067415836 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, 0.069271001 },
+	{ -0.51879293, -0.0594995, 0.05635265, -0.13745203, 0.016468729, -0.81523104, -0.20092824, -0.0093314287 },
+	{ 0.50604513, 0.058037476, -0.054967951, -0.25790749, -0.016064059, 0.79519915, -0.19599102, 0.070985433 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.11163291 },
+	{ 0.44199498, 0.086234273, 0.10762816, -0.56516572, 0.032015639, 0, -0.68204323, -0.27807135 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, -0.070013692 },
+	{ -0.71208479, -0.14409021, -0.13536675, -0.54563209, -0.039560134, 0, -0.39315357, -0.0010066357 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, 0.08347405 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, -0.3230303 },
+	{ 0.73582277, 0.14026699, 0.1966085, -0.3277847, 0.058935285, 0, -0.53788377, 0.19065844 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, 0.12454498 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.042403122 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.048859147 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.020578535 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, 0.069271001 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, -0.0067415836 },
+	{ -0.50604513, -0.058037476, 0.054967951, 0.25790749, 0.016064059, -0.79519915, 0.19599102, 0.070985433 },
+	{ 0.51879293, 0.0594995, -0.05635265, 0.13745203, -0.016468729, 0.81523104, 0.20092824, -0.0093314287 },
+	{ -0.44199498, -0.086234273, -0.10762816, 0.56516572, -0.032015639, 0, 0.68204323, -0.27807135 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.11163291 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, -0.070013692 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, 0.08347405 },
+	{ 0.71208479, 0.14409021, 0.13536675, 0.54563209, 0.039560134, 0, 0.39315357, -0.0010066357 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, -0.3230303 },
+	{ -0.78243382, -0.11397263, -0.10087472, -0.099355409, -0.031350481, -0.59479198, 0, -0.031341916 },
+	{ 0.78243382, 0.11397263, 0.10087472, 0.099355409, 0.031350481, 0.59479198, 0, 0.1488865 },
+	{ 0.15696499, 0.02125512, 0.45445675, 0.4466993, 0.14139284, -0.74084214, 0, 0.092277866 },
+	{ -0.15696499, -0.02125512, -0.45445675, -0.4466993, -0.14139284, 0.74084214, 0, 0.31676106 },
+	{ 0.22197486, -0.017004872, -0.082442478, -0.10379453, -0.022682469, 0.96558451, 0, 0.21054968 },
+	{ -0.22197486, 0.017004872, 0.082442478, 0.10379453, 0.022682469, -0.96558451, 0, -0.082032889 },
+	{ -0.53936489, -0.00047424444, 0.085080235, 0.089646648, 0.025672725, -0.83255693, 0, 0.14234894 },
+	{ 0.83314705, 0.039594502, 0.045073873, 0.05316012, 0.012855645, 0.54706065, 0, 0.13970708 },
+	{ -0.36156958, 0.018864993, 0.1717714, 0.17895524, 0.052094845, -0.89703249, 0, 0.32998548 },
+	{ 0.94706725, 0.058358641, 0.044597526, 0.067152461, 0.010816448, 0.30502868, 0, 0.1433428 },
+	{ 0.032996276, 0.051919805, 0.2304628, 0.25039914, 0.068546379, -0.93579065, 0, 0.47143887 },
+	{ 0.032996276, 0.051919805, 0.2304628, 0.25039914, 0.068546379, -0.93579065, 0, -0.14177735 },
+	{ -0.57803201, -0.071002131, -0.011161304, -0.28385757, -0.0043310127, -0.70855011, -0.27942079, 0.064412629 },
+	{ 0.72376193, 0.1214377, 0.17018735, 0.51460429, 0.05184574, 0.2236385, 0.33902519, 0.24228348 },
+	{ -0.50180102, -0.061245648, 0.080096905, -0.17290737, 0.024128543, -0.80072481, -0.25766224, 0.037072536 },
+	{ 0.70800239, 0.12017261, 0.053156675, 0.41245221, 0.015393638, 0.43300148, 0.35159841, 0.28173194 },
+	{ -0.66426225, -0.13239966, 0.051311985, -0.43871867, 0.017962826, -0.34837327, -0.47374298, 0.23843251 },
+	{ 0.5639485, 0.14732064, 0.13586211, 0.54849851, 0.038219459, -0.43814553, 0.38407989, 0.16971503 },
+	{ -0.18546745, -0.058564209, -0.17538585, 0.47958097, -0.052446218, 0.50243419, 0.66799942, 0.45223276 },
+	{ 0.18546745, 0.058564209, 0.17538585, -0.47958097, 0.052446218, -0.50243419, -0.66799942, -0.21677157 },
+	{ -0.53390867, -0.06534201, 0.044623092, -0.21721221, 0.013062068, -0.76802764, -0.26732475, -0.023078698 },
+	{ 0.53390867, 0.06534201, -0.044623092, 0.21721221, -0.013062068, 0.76802764, 0.26732475, 0.072853191 },
+	{ 0.2908313, -0.0022940371, -0.068863229, -0.039924432, -0.01872793, 0.95203915, 0.048440821, -0.059279759 },
+	{ -0.2908313, 0.0022940371, 0.068863229, 0.039924432, 0.01872793, -0.95203915, -0.048440821, 0.16964463 },
+	{ -0.75519448, -0.053132139, -0.032891054, -0.14600948, -0.0098355222, -0.62618858, -0.11067435, 0.062730996 },
+	{ 0.5574057, 0.014046246, -0.068245616, -0.019583553, -0.020407715, 0.82507992, 0.053733271, 0.13016048 },
+	{ -0.74713577, -0.06999456, -0.024310761, -0.21740787, -0.0069957073, -0.59430214, -0.18917647, 0.010241101 },
+	{ 0.44719281, 0.0086771042, -0.12202558, -0.04098978, -0.036708588, 0.87989103, 0.088414641, 0.26158621 },
+	{ 0.22530529, -0.0054576024, -0.15473227, -0.051465458, -0.045587754, 0.95191908, 0.11995331, -0.070484803 },
+	{ -0.29300934, -0.09252222, -0.277082, -0.42047479, -0.082856758, 0.79376683, -0.12280333, 0.5284607 },
+	{ -0.57803201, -0.071002131, -0.011161304, -0.28385757, -0.0043310127, -0.70855011, -0.27942079, -0.064412629 },
+	{ -0.64849529, -0.095424921, -0.031271433, -0.34921566, -0.0096495693, -0.58843065, -0.3179225, 0.09897698 },
+	{ 0.53390867, 0.06534201, -0.044623092, 0.21721221, -0.013062068, 0.76802764, 0.26732475, 0.047965945 },
+	{ -0.71087251, -0.13464745, -0.089508817, -0.51376234, -0.025940017, -0.18650704, -0.41122866, 0.061805854 },
+	{ 0.63912275, 0.10533444, -0.021527876, 0.37327253, -0.0073248823, 0.5374243, 0.38955411, 0.1580388 },
+	{ -0.29300934, -0.09252222, -0.277082, -0.42047479, -0.082856758, 0.79376683, -0.12280333, -0.195748 },
+	{ 0.35680095, 0.065272228, 0.10985408, -0.59400552, 0.033272207, 0, -0.70881246, 0.29770814 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, 0.12249014 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, -0.01753724 },
+	{ 0.26766385, -0.031061755, 0.67889474, 0.64882471, 0.21335337, 0, 0, 0.62721429 },
+	{ -0.26766385, 0.031061755, -0.67889474, -0.64882471, -0.21335337, 0, 0, 0.37443217 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.048859147 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.020578535 },
+	{ -0.51506073, -0.033999709, 0.062080869, 0.29272311, 0.018466902, -0.77000732, 0.22530713, 0.059481299 },
+	{ 0.53145868, 0.035082155, -0.064057333, 0.16291792, -0.019054831, 0.79452198, 0.23248022, 0.012029597 },
+	{ -0.15284517, 0.014607843, 0.1573301, 0.38726039, 0.046486899, -0.86818938, 0.21398077, 0.047202389 },
+	{ 0.16561969, -0.01582874, -0.17047946, 0.044102871, -0.05037219, 0.94075107, 0.23186489, 0.022062832 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, -0.3230303 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.11163291 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, 0.070013692 },
+	{ 0.62141267, 0.12123909, 0.15131733, 0.61165267, 0.04501165, 0, 0.44733143, 0.023510145 },
+	{ -0.94803043, -0.19420183, -0.16276948, -0.18656541, -0.047152997, 0, 0, 0.088145202 },
+	{ 0.63154885, 0.12937132, 0.10843204, 0.59315132, 0.031411883, 0, 0.46886715, 0.015301727 },
+	{ 0.92618086, 0.14570972, 0.14805322, 0.16224885, 0.043855439, 0.26606381, 0, -0.16150761 },
+	{ 0.93589957, 0.18690319, 0.19615866, 0.21758835, 0.057760545, 0, 0, -0.15840639 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.17934151 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, -0.15711636 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, -0.014878159 },
+	{ -0.6621587, -0.35084429, 0, 0, 0, -0.6621587, 0, 0.34880983 },
+	{ 0.70583169, 0.060027015, 0, 0, 0, 0.70583169, 0, -0.03496094 },
+	{ -0.67858187, -0.28116419, 0, 0, 0, -0.67858187, 0, 0.35610922 },
+	{ 0.70502524, 0.076673418, 0, 0, 0, 0.70502524, 0, -0.064994591 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, -0.048859147 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.020578535 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, -0.083577989 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.055297377 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, -0.11829683 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.090016218 },
+	{ 0.73582277, 0.14026699, 0.1966085, -0.3277847, 0.058935285, 0, -0.53788377, 0.079314777 },
+	{ 0.44199498, 0.086234273, 0.10762816, -0.56516572, 0.032015639, 0, -0.68204323, 0.14527967 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, 0.17934151 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, -0.097199649 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.083577989 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.055297377 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, 0.11326922 },
+	{ 0.67681043, 0.07360498, 0, 0.19803736, 0, 0.67681043, 0.19803736, 0.01178962 },
+	{ -0.50604513, -0.058037476, 0.054967951, 0.25790749, 0.016064059, -0.79519915, 0.19599102, 0.12272725 },
+	{ 0.51879293, 0.0594995, -0.05635265, 0.13745203, -0.016468729, 0.81523104, 0.20092824, 0.0010655232 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.16744937 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, -0.21139739 },
+	{ 0, 0, 0, 0.70710678, 0, 0, 0.70710678, 0.22326583 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, 0.13827058 },
+	{ 0.71208479, 0.14409021, 0.13536675, 0.54563209, 0.039560134, 0, 0.39315357, 0.019656115 },
+	{ -0.73582277, -0.14026699, -0.1966085, 0.3277847, -0.058935285, 0, 0.53788377, 0.079314777 },
+	{ -0.44199498, -0.086234273, -0.10762816, 0.56516572, -0.032015639, 0, 0.68204323, 0.14527967 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.097199649 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, 0.17934151 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.055297377 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, 0.083577989 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, 0.01178962 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, 0.11326922 },
+	{ -0.51879293, -0.0594995, 0.05635265, -0.13745203, 0.016468729, -0.81523104, -0.20092824, 0.0010655232 },
+	{ 0.50604513, 0.058037476, -0.054967951, -0.25790749, -0.016064059, 0.79519915, -0.19599102, 0.12272725 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.16744937 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.22326583 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, -0.21139739 },
+	{ -0.71208479, -0.14409021, -0.13536675, -0.54563209, -0.039560134, 0, -0.39315357, 0.019656115 },
+	{ 0.94238147, 0.1906907, 0.17914597, 0.20179188, 0.052354351, 0, 0, 0.13827058 },
+	{ -0.35680095, -0.065272228, -0.10985408, 0.59400552, -0.033272207, 0, 0.70881246, 0.29770814 },
+	{ -0.9235021, -0.18017746, -0.22487774, -0.24420329, -0.066893315, 0, 0, -0.01753724 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, 0.12249014 },
+	{ 0.26766385, -0.031061755, 0.67889474, 0.64882471, 0.21335337, 0, 0, 0.37443217 },
+	{ -0.26766385, 0.031061755, -0.67889474, -0.64882471, -0.21335337, 0, 0, 0.62721429 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.020578535 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, 0.048859147 },
+	{ -0.53145868, -0.035082155, 0.064057333, -0.16291792, 0.019054831, -0.79452198, -0.23248022, 0.012029597 },
+	{ 0.51506073, 0.033999709, -0.062080869, -0.29272311, -0.018466902, 0.77000732, -0.22530713, 0.059481299 },
+	{ -0.16561969, 0.01582874, 0.17047946, -0.044102871, 0.05037219, -0.94075107, -0.23186489, 0.022062832 },
+	{ 0.15284517, -0.014607843, -0.1573301, -0.38726039, -0.046486899, 0.86818938, -0.21398077, 0.047202389 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, 0.11163291 },
+	{ 0, 0, 0, -0.70710678, 0, 0, -0.70710678, -0.3230303 },
+	{ -0.62141267, -0.12123909, -0.15131733, -0.61165267, -0.04501165, 0, -0.44733143, 0.023510145 },
+	{ 0.9235021, 0.18017746, 0.22487774, 0.24420329, 0.066893315, 0, 0, 0.070013692 },
+	{ -0.63154885, -0.12937132, -0.10843204, -0.59315132, -0.031411883, 0, -0.46886715, 0.015301727 },
+	{ 0.94803043, 0.19420183, 0.16276948, 0.18656541, 0.047152997, 0, 0, 0.088145202 },
+	{ -0.78285121, -0.09898248, -0.047719544, -0.044685579, -0.01433579, -0.61059821, 0.0060668611, -0.17207395 },
+	{ -0.80704037, -0.10765324, -0.057883846, -0.055914017, -0.017242724, -0.5746971, 0.0067559631, -0.17490534 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, -0.082004507 },
+	{ 0.67681043, 0.07360498, 0, -0.19803736, 0, 0.67681043, -0.19803736, 0.14453392 },
+	{ -0.70583169, -0.060027015, 0, 0, 0, -0.70583169, 0, -0.03496094 },
+	{ -0.6621587, -0.35084429, 0, 0, 0, -0.6621587, 0, -0.34880983 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, -0.052855034 },
+	{ -0.62089285, -0.052952516, 0.029594813, 0.076312877, 0.0086489092, -0.77657374, 0.042976972, -0.16220715 },
+	{ -0.70239644, -0.094101997, 0, -0.047028196, 0, -0.70239644, -0.047028196, -0.063528331 },
+	{ -0.62071918, 0.059095523, 0, 0.33609755, 0, -0.62071918, 0.33609755, 0.03115289 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, -0.019475089 },
+	{ -0.67681043, -0.07360498, 0, -0.19803736, 0, -0.67681043, -0.19803736, 0.01178962 },
+	{ -0.67681043, -0.07360498, 0, 0.19803736, 0, -0.67681043, 0.19803736, -0.11326922 },
+	{ -0.050396408, -0.088897826, -0.16942327, -0.43687307, -0.049512948, 0.84083965, -0.24603294, 0.0099544295 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, -0.17966478 },
+	{ 0.91096713, 0.14008954, 0.15752389, 0.21959306, 0.046964162, 0.26989433, 0.049298455, -0.15218171 },
+	{ 0.81855022, 0.2005533, 0.25000731, 0.36621224, 0.074037167, -0.28136356, 0.092151528, -0.11556991 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, 0.11829683 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, -0.048859147 },
+	{ 0.60944101, 0.010294593, -0.033517904, -0.086428919, -0.0097954094, 0.78575897, -0.048674004, -0.13432009 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, -0.014878159 },
+	{ -0.6621587, -0.35084429, 0, 0, 0, -0.6621587, 0, 0.34880983 },
+	{ 0.70583169, 0.060027015, 0, 0, 0, 0.70583169, 0, -0.03496094 },
+	{ 0.31880485, -0.45695953, 0, -0.54217844, 0, 0.31880485, -0.54217844, 0.40978666 },
+	{ 0.70292023, 0.083930369, 0, 0.048795444, 0, 0.70292023, 0.048795444, -0.052287279 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.020578535 },
+	{ 0.67146484, 0.039285475, 0, -0.21991657, 0, 0.67146484, -0.21991657, -0.083577989 },
+	{ 0.67146484, 0.039285475, 0, 0.21991657, 0, 0.67146484, 0.21991657, 0.055297377 },
+	{ 0.14884556, 0.14497612, 0.18008815, 0.46437343, 0.052629698, -0.79849218, 0.26152027, -0.039608557 },
+	{ 0.70650244, 0.041335424, 0, 0, 0, 0.70650244, 0, -0.15711636 },
+	{ -0.90136465, -0.16585315, -0.27036332, -0.28328065, -0.081793924, 0, 0, 0.073696149 },
+	{ 0.90136465, 0.16585315, 0.27036332, 0.28328065, 0.081793924, 0, 0, 0.061682135 },
+	{ 0.55210096, 0.027794107, 0.59023779, 0.55789015, 0.18652065, 0, 0, 0.36605436 },
+	{ -0.55210096, -0.027794107, -0.59023779, -0.55789015, -0.18652065, 0, 0, 0.17594185 },
+	{ -0.74777449, -0.10680576, -0.45376089, -0.45147989, -0.14033108, 0, 0, -0.1876825 },
+	{ -0.58111057, -0.0055789245, 0.067927734, 0.071173162, 0.020550405, -0.80757493, 0, 0.16107761 },
+	{ 0.58111057, 0.0055789245, -0.067927734, -0.071173162, -0.020550405, 0.80757493, 0, 0.16409608 },
+	{ -0.26974067, 0.024981858, 0.1701838, 0.18221716, 0.050973629, -0.92835982, 0, 0.15622704 },
+	{ 0.26974067, -0.024981858, -0.1701838, -0.18221716, -0.050973629, 0.92835982, 0, 0.17773284 },
+	{ 0.002931805, 0.048083104, 0.21425847, 0.23448069, 0.063508566, -0.94485882, 0, 0.13552515 },
+	{ -0.002931805, -0.048083104, -0.21425847, -0.23448069, -0.063508566, 0.94485882, 0, 0.15077731 },
+	{ -0.71024618, -0.13068692, -0.21303755, -0.56106304, -0.064450965, 0, -0.33784705, 0.21241015 },
+	{ 0.71024618, 0.13068692, 0.21303755, 0.56106304, 0.064450965, 0, 0.33784705, 0.20294349 },
+	{ -0.71621545, -0.1490766, -0.11532752, -0.53724894, -0.033026635, 0, -0.4022238, 0.27515845 },
+	{ 0.71621545, 0.1490766, 0.11532752, 0.53724894, 0.033026635, 0, 0.4022238, 0.21934082 },
+	{ -0.71621545, -0.1490766, -0.11532752, -0.53724894, -0.033026635, 0, -0.4022238, 0.21165826 },
+	{ 0.71621545, 0.1490766, 0.11532752, 0.53724894, 0.033026635, 0, 0.4022238, 0.28284101 },
+	{ -0.92618086, -0.14570972, -0.14805322, -0.16224885, -0.043855439, -0.26606381, 0, -0.16150761 },
+	{ -0.93589957, -0.18690319, -0.19615866, -0.21758835, -0.057760545, 0, 0, -0.15840639 },
+	{ -0.94238147, -0.1906907, -0.17914597, -0.20179188, -0.052354351, 0, 0, -0.17934151 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, -0.014878159 },
+	{ -0.70650244, -0.041335424, 0, 0, 0, -0.70650244, 0, -0.15711636 },
+	{ -0.70583169, -0.060027015, 0, 0, 0, -0.70583169, 0, -0.03496094 },
+	{ 0.6621587, 0.35084429, 0, 0, 0, 0.6621587, 0, 0.34880983 },
+	{ -0.70502524, -0.076673418, 0, 0, 0, -0.70502524, 0, -0.064994591 },
+	{ 0.67858187, 0.28116419, 0, 0, 0, 0.67858187, 0, 0.35610922 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.020578535 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, -0.048859147 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.055297377 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, -0.083577989 },
+	{ -0.67146484, -0.039285475, 0, -0.21991657, 0, -0.67146484, -0.21991657, 0.090016218 },
+	{ -0.67146484, -0.039285475, 0, 0.21991657, 0, -0.67146484, 0.21991657, -0.11829683 }
+};
+
+// regions, the unconstrained one first, the others by frequency
+constexpr MPCRegion MPCRegionTable[45] = {
+	{ 0, 18, { 35.932228, 6.5733473, 11.063036, 11.561822, 3.3507324, 0, 0 }, 0 },
+	{ 18, 17, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 35, 17, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 52, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 67, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 82, 16, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 98, 16, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 114, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 129, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 144, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 159, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 174, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 189, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 204, 18, { 6.7960596, 1.2432533, 2.0924128, -11.314143, 0.63374243, 0, -13.500894 }, 8.2990887 },
+	{ 222, 16, { 13.817252, 2.6339281, 3.6919069, -6.1551285, 1.1066845, 0, -10.100361 }, 6.2087587 },
+	{ 238, 18, { 6.7960596, 1.2432533, 2.0924128, -11.314143, 0.63374243, 0, -13.500894 }, -8.2990887 },
+	{ 256, 16, { 13.817252, 2.6339281, 3.6919069, -6.1551285, 1.1066845, 0, -10.100361 }, -6.2087587 },
+	{ 272, 13, { 19.667079, 3.877395, 4.4109972, -1.5405634, 1.3065992, 0, -6.3744955 }, 3.9184446 },
+	{ 285, 13, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 298, 13, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 311, 13, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 324, 17, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 341, 13, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 354, 17, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 371, 13, { 19.667079, 3.877395, 4.4109972, -1.5405634, 1.3065992, 0, -6.3744955 }, -3.9184446 },
+	{ 384, 18, { 34.994233, 5.0974086, 4.5116064, 4.4436555, 1.4021455, 26.601981, 0 }, 4.0303442 },
+	{ 402, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 417, 12, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 429, 12, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 441, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 456, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 471, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 486, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 501, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 516, 18, { 34.994233, 5.0974086, 4.5116064, 4.4436555, 1.4021455, 26.601981, 0 }, -4.0303442 },
+	{ 534, 18, { 4.1409486, 1.3075684, 3.9158558, -10.707648, 1.1709715, -11.217894, -14.914484 }, 7.4684603 },
+	{ 552, 17, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 569, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 584, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 599, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 614, 17, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 631, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 },
+	{ 646, 15, { 0, 0, 0, 0, 0, 0, 0 }, -2.6285818 },
+	{ 661, 17, { 35.002817, 6.4405983, 10.499056, 11.000676, 3.1763147, 0, 0 }, 0.23327093 },
+	{ 678, 15, { 0, 0, 0, 0, 0, 0, 0 }, 2.6285818 }
+};
+
+#endif /* MPCTABLE_H_ */
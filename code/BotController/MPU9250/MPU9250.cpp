@@ -513,6 +513,39 @@ float MPU9250::getMagZ_uT() {
   return _hz;
 }
 
+/* returns the accelerometer counts of the last readSensor */
+void MPU9250::getAccelCounts(int16_t counts[3]) {
+  counts[0] = _axcounts;
+  counts[1] = _aycounts;
+  counts[2] = _azcounts;
+}
+
+/* returns the gyroscope counts of the last readSensor */
+void MPU9250::getGyroCounts(int16_t counts[3]) {
+  counts[0] = _gxcounts;
+  counts[1] = _gycounts;
+  counts[2] = _gzcounts;
+}
+
+/* returns the accelerometer scale, m/s/s per count */
+float MPU9250::getAccelScale() {
+  return _accelScale;
+}
+
+/* returns the gyroscope scale, rad/s per count */
+float MPU9250::getGyroScale() {
+  return _gyroScale;
+}
+
+/* returns the transformation of the accel and gyro axes to the magnetometer axes */
+void MPU9250::getTransform(int16_t transform[3][3]) {
+  for (int i = 0; i < 3; i++) {
+    transform[0][i] = tX[i];
+    transform[1][i] = tY[i];
+    transform[2][i] = tZ[i];
+  }
+}
+
 /* returns the die temperature, C */
 float MPU9250::getTemperature_C() {
   return _t;
@@ -89,6 +89,13 @@ class MPU9250{
     float getMagY_uT();
     float getMagZ_uT();
     float getTemperature_C();
+
+    /* raw counts of the last readSensor and the factors readSensor converts them with */
+    void getAccelCounts(int16_t counts[3]);
+    void getGyroCounts(int16_t counts[3]);
+    float getAccelScale();
+    float getGyroScale();
+    void getTransform(int16_t transform[3][3]);
     
     int calibrateGyro();
     float getGyroBiasX_rads();
@@ -0,0 +1,65 @@
+/*
+ * MotorConfig.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <MotorConfig.h>
+
+void MotorConfig::initDefaultValues() {
+	// at slow speeds PID controller is aggressively keeping the position
+	pid_position.Kp = 0.5;
+	pid_position.Ki = 0.2;
+	pid_position.Kd = 0.0000;
+
+	pid_speed.Kp = 0.1;
+	pid_speed.Ki = 0.1;
+	pid_speed.Kd = 0.001;
+
+	pid_lifter.Kp = 0.01;
+	pid_lifter.Ki = 0.005;
+	pid_lifter.Kd = 0.0;
+
+	phaseAAngle[0] = radians(229.4);
+	phaseAAngle[1] = radians(234.3);
+	phaseAAngle[2] = radians(126.8);
+}
+
+void MotorConfig::print() {
+	loggingln("motor controller configuration:");
+	logging("   PID (speed=0)  : ");
+	logging("(");
+	logging(pid_position.Kp,3);
+	logging(",");
+	logging(pid_position.Ki,3);
+	logging(",");
+	logging(pid_position.Kd,4);
+	loggingln(")");
+	logging("   PID (speed=max): ");
+	logging("(");
+	logging(pid_speed.Kp,3);
+	logging(",");
+	logging(pid_speed.Ki,3);
+	logging(",");
+	logging(pid_speed.Kd,4);
+	loggingln(")");
+	logging("   rotorAngle=(");
+	logging(degrees(phaseAAngle[0]),1);
+	logging(",");
+	logging(degrees(phaseAAngle[1]),1);
+	logging(",");
+	logging(degrees(phaseAAngle[2]),1);
+	loggingln(")");
+	loggingln("lifter controller configuration:");
+	logging("   PID (speed=max): ");
+	logging("(");
+	logging(pid_lifter.Kp);
+	logging(",");
+	logging(pid_lifter.Ki);
+	logging(",");
+	logging(pid_lifter.Kd);
+	loggingln(")");
+}
@@ -0,0 +1,35 @@
+/*
+ * MotorConfig.h
+ *
+ * Persistent configuration of the motor controllers. Separated from BrushlessMotorDriver.h,
+ * so the configuration can be used without the motor and encoder drivers.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef MOTORCONFIG_H_
+#define MOTORCONFIG_H_
+
+#include <Arduino.h>
+#include <libraries/PIDController.h>
+
+const float GearBoxRatio = 18.0/54.0*18.0/54.0; 	// two timing belts with 54/18*54/18 pulleys = 1:9
+
+class MotorConfig {
+public:
+	void initDefaultValues();
+	void print();
+
+	// PID values for control at 0 rev/s
+	PIDControllerConfig pid_position;
+	PIDControllerConfig pid_speed;
+	PIDControllerConfig pid_lifter;
+
+	// mounting property: differing angle between rotor and encoder.
+	// Needs to be calibrated after assembly to ake into account that
+	// the magnet gets a random position to the rotor
+	float phaseAAngle[3];
+};
+
+#endif /* MOTORCONFIG_H_ */
@@ -0,0 +1,41 @@
+/*
+ * ObserverGains.h
+ *
+ * Model and gains of the StateObserver, generated by Host/tools/control_design out of
+ * the linearised model with the constants of setup.h. Do not edit, run control_design instead:
+ *     control_design -o LQRGains.h -e ObserverGains.h
+ * measurement noise: tilt 0.100deg, angular velocity 1.00deg/s, pos 0.0010m, speed 0.0100m/s,
+ * disturbances: angular accel 5.00rad/s^2, accel 2.00m/s^2. Spectral radius of the observer is 0.970404
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef OBSERVERGAINS_H_
+#define OBSERVERGAINS_H_
+
+// model and gains are valid for this sample frequency only
+const int ObserverSampleFrequency = 333;
+
+// discrete model x(k+1) = ObserverModel·x(k) + ObserverInput·a(k) with x = (tilt, angular velocity, pos, speed)
+constexpr float ObserverModel[4][4] = {
+	{ 1.0001001, 0.0030031032, 0, 0 },
+	{ 0.066645733, 1.0001001, 0, 0 },
+	{ 0, 0, 1, 0.0030030031 },
+	{ 0, 0, 0, 1 }
+};
+
+constexpr float ObserverInput[4] = { -3.9411717e-05, -0.013124977, 9.0180275e-06, 0.0030030031 };
+
+// steady state Kalman gain, x += ObserverGain·(measurement - x)
+constexpr float ObserverGain[4][4] = {
+	{ 0.029273723, 0.0020577265, 0, 0 },
+	{ 0.20577265, 0.56600793, 0, 0 },
+	{ 0, 0, 0.029239603, 0.002184295 },
+	{ 0, 0, 0.2184295, 0.44602834 }
+};
+
+// angular acceleration [rad/s^2] = ObserverAngularAccel · (tilt, a)
+constexpr float ObserverAngularAccel[2] = { 22.192288, -4.37018 };
+
+#endif /* OBSERVERGAINS_H_ */
@@ -0,0 +1,42 @@
+/*
+ * Odometry.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <Odometry.h>
+#include <Profiler.h>
+
+void Odometry::setup(Kinematix* kinematics) {
+	this->kinematics = kinematics;
+}
+
+void Odometry::reset(const BotMovement& current) {
+	lastSpeedX = current.x.speed;
+	lastSpeedY = current.y.speed;
+}
+
+void Odometry::update(float dT, const float wheelAngleChange[3], const IMUSample &sample, BotMovement &current) {
+	float currentWheelSpeed[3];
+	// @TODO bug: wheelspeed = (angleChange / (TWO_PI*dT))
+	currentWheelSpeed[0] = wheelAngleChange[0]  / dT;	// compute wheel speed out of delta-angle
+	currentWheelSpeed[1] = wheelAngleChange[1]  / dT;
+	currentWheelSpeed[2] = wheelAngleChange[2]  / dT;
+
+	// apply inverse kinematics to get { speed (x,y), omega } out of wheel speed
+	{
+		ProfileScope scope(PROFILE_KINEMATICS);
+		kinematics->computeActualSpeed(  currentWheelSpeed,
+										sample.plane[X].angle, sample.plane[Y].angle,
+										current.x.speed, current.y.speed, current.omega);
+	}
+
+	current.x.pos += dT*current.x.speed;
+	current.y.pos += dT*current.y.speed;
+	current.x.accel = (current.x.speed - lastSpeedX)/dT;
+	current.y.accel = (current.y.speed - lastSpeedY)/dT;
+	lastSpeedX = current.x.speed;
+	lastSpeedY = current.y.speed;
+}
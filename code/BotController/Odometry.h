@@ -0,0 +1,37 @@
+/*
+ * Odometry.h
+ *
+ * Computes the movement of the bot (position, speed and acceleration in x and y, omega) out of
+ * the change of the wheel angles as measured by the encoders. Used by BallDrive, and by the
+ * simulator on the host, which provides the wheel angles of its model instead of the encoders.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef ODOMETRY_H_
+#define ODOMETRY_H_
+
+#include <types.h>
+#include <IMUSample.h>
+#include <Kinematics.h>
+
+class Odometry {
+public:
+	Odometry() {};
+
+	// kinematics is shared with the caller, since its tilt compensation is cached per tilt angle
+	void setup(Kinematix* kinematics);
+
+	// start from the passed movement, e.g. without motion
+	void reset(const BotMovement& current);
+
+	// update current movement by the wheel angle change [rad] since the last call dT [s] ago
+	void update(float dT, const float wheelAngleChange[3], const IMUSample &sample, BotMovement &current);
+private:
+	Kinematix* kinematics = NULL;
+	float lastSpeedX = 0;
+	float lastSpeedY = 0;
+};
+
+#endif /* ODOMETRY_H_ */
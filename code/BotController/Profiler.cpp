@@ -0,0 +1,100 @@
+/*
+ * Profiler.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <Profiler.h>
+
+#if defined(TEENSYDUINO)
+Profiler profiler;
+#else
+thread_local Profiler profiler;
+#endif
+
+static const char* ProfileStageName[NumberOfProfileStages] = {
+		"imu read", "kalman", "get speed", "state update", "kinematics",
+		"motor 0", "motor 1", "motor 2", "menu" };
+
+void StageStatistics::reset() {
+	count = 0;
+	minCycles = 0;
+	maxCycles = 0;
+	sumCycles = 0;
+	for (int i = 0;i<HistogramSize;i++)
+		histogram[i] = 0;
+}
+
+void StageStatistics::add(uint32_t cycles) {
+	if ((count == 0) || (cycles < minCycles))
+		minCycles = cycles;
+	if (cycles > maxCycles)
+		maxCycles = cycles;
+	sumCycles += cycles;
+	count++;
+
+	// bucket is the position of the highest bit
+	int bucket = (cycles == 0)?0:(31 - __builtin_clz(cycles));
+	histogram[bucket]++;
+}
+
+void StageStatistics::print(const char* name) {
+	float cyclesPerUs = Profiler::cyclesPerMicrosecond();
+	logging("   ");
+	logging(name);
+	logging(" n=");
+	logging((int)count);
+	if (count > 0) {
+		logging(" min=");
+		logging(minCycles/cyclesPerUs,1);
+		logging("us mean=");
+		logging(((float)sumCycles)/count/cyclesPerUs,1);
+		logging("us max=");
+		logging(maxCycles/cyclesPerUs,1);
+		logging("us hist=");
+		for (int i = 0;i<HistogramSize;i++) {
+			if (histogram[i] > 0) {
+				logging(" 2^");
+				logging(i);
+				logging(":");
+				logging((int)histogram[i]);
+			}
+		}
+	}
+	loggingln();
+}
+
+void Profiler::setup() {
+#if defined(TEENSYDUINO)
+	// enable trace and the cycle counter of the DWT unit
+	ARM_DEMCR |= ARM_DEMCR_TRCENA;
+	ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+#endif
+	reset();
+}
+
+float Profiler::cyclesPerMicrosecond() {
+#if defined(TEENSYDUINO)
+	return F_CPU/1000000.0;
+#else
+	return 1000.0; // std::chrono is used with ns
+#endif
+}
+
+void Profiler::reset() {
+	for (int i = 0;i<NumberOfProfileStages;i++)
+		stages[i].reset();
+}
+
+void Profiler::print() {
+	loggingln("profile:");
+	for (int i = 0;i<NumberOfProfileStages;i++)
+		stages[i].print(ProfileStageName[i]);
+}
+
+ProfileScope::~ProfileScope() {
+	profiler.add(stage, Profiler::cycles() - start);
+}
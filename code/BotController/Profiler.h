@@ -0,0 +1,110 @@
+/*
+ * Profiler.h
+ *
+ * Measures the cycles spent in each stage of the balancing loop. On the Teensy the
+ * cycle counter of the Cortex-M4 (DWT) is used, on other platforms std::chrono with a
+ * resolution of 1ns per "cycle".
+ * Per stage min, max, mean and a histogram with log2 buckets is kept.
+ *
+ * use:
+ * 		{
+ * 			ProfileScope scope(PROFILE_KALMAN);		// measures until the end of the block
+ * 			<do the kalman thing>
+ * 		}
+ *		profiler.print();
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include <Arduino.h>
+
+#if !defined(TEENSYDUINO)
+#include <chrono>
+#endif
+
+enum ProfileStage {
+	PROFILE_IMU_READ = 0,		// read the raw values from MPU9250
+	PROFILE_KALMAN,				// kalman filter of all three planes
+	PROFILE_GET_SPEED,			// BallDrive::getSpeed
+	PROFILE_STATE_UPDATE,		// StateController::update
+	PROFILE_KINEMATICS,			// forward and inverse kinematics
+	PROFILE_MOTOR_0,			// BrushlessMotorDriver::loop of wheel 0..2
+	PROFILE_MOTOR_1,
+	PROFILE_MOTOR_2,
+	PROFILE_MENU,				// MenuController::loop
+	NumberOfProfileStages
+};
+
+class StageStatistics {
+public:
+	static const int HistogramSize = 32;
+
+	void reset();
+	void add(uint32_t cycles);
+	void print(const char* name);
+
+	uint32_t count = 0;
+	uint32_t minCycles = 0;
+	uint32_t maxCycles = 0;
+	uint64_t sumCycles = 0;
+	uint32_t histogram[HistogramSize];		// histogram[i] counts all measurements within [2^i, 2^(i+1))
+};
+
+class Profiler {
+public:
+	Profiler() {};
+	virtual ~Profiler() {};
+
+	// enable the cycle counter
+	void setup();
+
+	// return current cycle counter
+	static inline uint32_t cycles() {
+#if defined(TEENSYDUINO)
+		return ARM_DWT_CYCCNT;
+#else
+		return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	// number of cycles per microsecond
+	static float cyclesPerMicrosecond();
+
+	void add(ProfileStage stage, uint32_t cycles) {
+		stages[stage].add(cycles);
+	}
+
+	StageStatistics& get(ProfileStage stage) { return stages[stage]; };
+
+	void reset();
+	void print();
+private:
+	StageStatistics stages[NumberOfProfileStages];
+};
+
+// measures the cycles from construction to destruction and adds them to the given stage
+class ProfileScope {
+public:
+	ProfileScope(ProfileStage stage) {
+		this->stage = stage;
+		start = Profiler::cycles();
+	}
+	~ProfileScope();
+private:
+	ProfileStage stage;
+	uint32_t start;
+};
+
+#if defined(TEENSYDUINO)
+extern Profiler profiler;
+#else
+// on the host the control code runs in several threads, e.g. in the autotuner
+extern thread_local Profiler profiler;
+#endif
+
+#endif /* PROFILER_H_ */
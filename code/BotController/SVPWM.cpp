@@ -0,0 +1,72 @@
+/*
+ * SVPWM.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <setup.h>
+#include <libraries/Util.h>
+#include <SVPWM.h>
+
+// array to store pre-computed values of space vector wave form (SVPWM)
+// array size is choosen by having a maximum difference of 1% in two subsequent table items,
+// i.e. we have a precision of 1%. The rest is compensated by the optical
+// encoder with a precision of 0.1%
+#define svpwmArraySize 244 // manually set such that two adjacent items have a difference of 2 of 255 at most (approx. 1%)
+int svpwmTable[svpwmArraySize];
+
+void setPwmTable(int i, int value) {
+	if ((i<0) || (i>= svpwmArraySize))
+		fatalError("pwmTable:Idx out of bound");
+	svpwmTable[i] = value;
+}
+
+int getPwmTable(int i) {
+	if ((i<0) || (i>= svpwmArraySize))
+		fatalError("pwmTable:Idx out of bound");
+	return svpwmTable[i];
+}
+
+void precomputeSVPMWave() {
+	const int maxPWMValue = (1<<pwmResolutionBits)-1;
+	const float spaceVectorScaleUpFactor = 1.15; // empiric value to reach full pwm scale
+	static boolean initialized = false;
+	if (!initialized) {
+		for (int i = 0;i<svpwmArraySize;i++) {
+			float angle = float(i) / float(svpwmArraySize) * (TWO_PI);
+			float phaseA = sin(angle);
+			float phaseB = sin(angle + M_PI*2.0/3.0);
+			float phaseC = sin(angle + M_PI*4.0/3.0);
+
+			// trick to avoid the switch of 6 phases everyone else is doing, neat, huh?
+			float voff = (min(phaseA, min(phaseB, phaseC)) + max(phaseA, max(phaseB, phaseC)))/2.0;
+			setPwmTable(i,(phaseA - voff)/2.0*spaceVectorScaleUpFactor*maxPWMValue);
+
+			// if you want to use plain sin waves:
+			setPwmTable(i,(phaseA/2.0 + 0.5)*maxPWMValue);
+		}
+		initialized = true;
+	}
+}
+
+int getPWMValue(float torque, float angle_rad) {
+	// map input angle to 0..2*PI
+
+	// clear negative angles (fmod does not do this)
+	if (angle_rad < 0)
+		angle_rad += ((int)(-angle_rad/TWO_PI + 1.0))*TWO_PI;
+
+	angle_rad = fmod(angle_rad, TWO_PI);
+
+	// compute index in precomputed pwm array
+	// fmod may return a value that rounds up to the end of the table
+	int angleIndex = ((int)(angle_rad / TWO_PI * svpwmArraySize));
+	if (angleIndex == svpwmArraySize)
+		angleIndex = 0;
+	if ((angleIndex < 0) || (angleIndex >= svpwmArraySize))
+		fatalError("getPWMValue: idx out of bounds");
+
+	return  torque * getPwmTable(angleIndex);
+}
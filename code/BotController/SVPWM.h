@@ -0,0 +1,21 @@
+/*
+ * SVPWM.h
+ *
+ * Precomputed wave form of the PWM of the brushless motors, and the lookup of the
+ * PWM value of one winding for a given angle of the magnetic field. Independent of the
+ * hardware, so it can be compiled and benchmarked on the host as well.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef SVPWM_H_
+#define SVPWM_H_
+
+// fill the table, first invocation does the initialization
+void precomputeSVPMWave();
+
+// PWM value of a winding with the magnetic field at angle_rad, scaled by torque [0..1]
+int getPWMValue(float torque, float angle_rad);
+
+#endif /* SVPWM_H_ */
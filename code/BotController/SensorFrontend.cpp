@@ -0,0 +1,77 @@
+/*
+ * SensorFrontend.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <SensorFrontend.h>
+#include <MotorConfig.h>
+#include <Encoder/AS5047D.h>
+
+void IMUFrontend::setup(const IMUCalibration& newCalibration, IMUConfig* newConfig) {
+	calibration = newCalibration;
+	config = newConfig;
+
+	// initialize Kalman filter
+	for (int i = 0;i<3;i++) {
+		kalman[i].setup(0);
+		kalman[i].setNoiseVariance(config->kalmanNoiseVariance);
+	}
+}
+
+void IMUFrontend::setNoiseVariance(float noiseVariance) {
+	for (int i = 0;i<3;i++)
+		kalman[i].setNoiseVariance(noiseVariance);
+}
+
+void IMUFrontend::update(const int16_t accelCounts[3], const int16_t gyroCounts[3], float dT, IMUSample& sample) {
+	// transform and convert to float values, same as MPU9250::readSensor
+	const IMUCalibration& c = calibration;
+	float accel[3];
+	float gyro[3];
+	for (int i = 0;i<3;i++) {
+		accel[i] = (((float)(c.transform[i][0]*accelCounts[0] + c.transform[i][1]*accelCounts[1] + c.transform[i][2]*accelCounts[2]) * c.accelScale) - c.accelBias[i])*c.accelScaleFactor[i];
+		gyro[i] = ((float)(c.transform[i][0]*gyroCounts[0] + c.transform[i][1]*gyroCounts[1] + c.transform[i][2]*gyroCounts[2]) * c.gyroScale) - c.gyroBias[i];
+	}
+
+	// turn the coordinate system of the IMU into that one of the bot:
+	// front wheel points to the x-axis, y-axis is
+	// for use of the kalman filter, we need to break the convention and
+	// denote the coordsystem for angualr velocity in the direction of the according axis
+	// I.e. the angular velocity in the x-axis denotes the speed of the tilt angle in direction of x
+	float accelX = accel[0];
+	float accelY = accel[1];
+	float accelZ = accel[2];
+
+	tilt[Dimension::X] = atan2( accelX, sqrt(accelZ*accelZ + accelY*accelY)) - config->nullOffsetX;
+	tilt[Dimension::Y] = atan2(-accelY, sqrt(accelZ*accelZ + accelX*accelX)) - config->nullOffsetY;
+	tilt[Dimension::Z] = accelZ;
+
+	angularVelocity[Dimension::X] = gyro[1];
+	angularVelocity[Dimension::Y] = gyro[0];
+	angularVelocity[Dimension::Z] = gyro[2];
+
+	for (int i = 0;i<3;i++) {
+		// invoke kalman filter separately per plane
+		kalman[i].update(tilt[i], angularVelocity[i], dT);
+		sample.plane[i].angle = kalman[i].getAngle();
+		sample.plane[i].angularVelocity = kalman[i].getRate();
+	}
+}
+
+void IMUFrontend::getState(float state[3][KalmanFilter::StateSize]) {
+	for (int i = 0;i<3;i++)
+		kalman[i].getState(state[i]);
+}
+
+void IMUFrontend::setState(const float state[3][KalmanFilter::StateSize]) {
+	for (int i = 0;i<3;i++)
+		kalman[i].setState(state[i]);
+}
+
+float wheelAngleFromEncoder(int32_t counts, float phaseAAngle, bool reverse) {
+	// same as BrushlessMotorDriver::getIntegratedMotorAngle, times the gear box
+	float motorAngle = (reverse?-1.0:1.0)*(AS5047D::countsToAngle(counts) - phaseAAngle);
+	return motorAngle*GearBoxRatio;
+}
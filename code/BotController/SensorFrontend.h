@@ -0,0 +1,65 @@
+/*
+ * SensorFrontend.h
+ *
+ * Conversion of the raw sensor readings into what the balancing loop works with, without any
+ * access to the hardware: the counts of the MPU9250 into the tilt of the bot (Kalman filter per
+ * plane), and the counts of the AS5047D encoders into wheel angles. IMU and BrushlessMotorDriver
+ * use it on the bot, the replay of a sensor recording (SensorRecording.h) uses it on the host,
+ * so both compute the same values out of the same counts.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef SENSORFRONTEND_H_
+#define SENSORFRONTEND_H_
+
+#include <Arduino.h>
+#include <types.h>
+#include <IMUSample.h>
+#include <Filter/KalmanFilter.h>
+
+// factors the MPU9250 converts its counts with, as set during its setup and calibration
+struct IMUCalibration {
+	int16_t transform[3][3];		// accel and gyro axes to the magnetometer axes
+	float accelScale;				// [m/s^2] per count
+	float accelBias[3];				// [m/s^2]
+	float accelScaleFactor[3];
+	float gyroScale;				// [rad/s] per count
+	float gyroBias[3];				// [rad/s]
+};
+
+class IMUFrontend {
+public:
+	IMUFrontend() {};
+
+	void setup(const IMUCalibration& calibration, IMUConfig* config);
+	void setNoiseVariance(float noiseVariance);
+
+	// convert counts into tilt and angular velocity of the bot's coordinate system and run the
+	// Kalman filter of each plane with it. dT [s] is the time since the last update
+	void update(const int16_t accelCounts[3], const int16_t gyroCounts[3], float dT, IMUSample& sample);
+
+	// unfiltered values of the last update
+	float getTilt(Dimension dim) { return tilt[dim]; };					// [rad]
+	float getAngularVelocity(Dimension dim) { return angularVelocity[dim]; };	// [rad/s]
+
+	float getFilteredAngle(Dimension dim) { return kalman[dim].getAngle(); };
+
+	const IMUCalibration& getCalibration() { return calibration; };
+
+	// state of the Kalman filters, to continue elsewhere
+	void getState(float state[3][KalmanFilter::StateSize]);
+	void setState(const float state[3][KalmanFilter::StateSize]);
+private:
+	IMUCalibration calibration;
+	IMUConfig* config = NULL;
+	KalmanFilter kalman[3]; 		// one kalman filter per dimension
+	float tilt[3] = { 0,0,0 };
+	float angularVelocity[3] = { 0,0,0 };
+};
+
+// integrated angle of a wheel [rad] out of the unwrapped counts of its encoder, incl. gear box
+float wheelAngleFromEncoder(int32_t counts, float phaseAAngle /* [rad] */, bool reverse);
+
+#endif /* SENSORFRONTEND_H_ */
@@ -0,0 +1,65 @@
+/*
+ * SensorRecording.h
+ *
+ * Records of a sensor recording, i.e. the raw readings of IMU and encoders of every balancing
+ * tick, so a balancing run of the bot can be repeated on the host (tools/sensor_replay). The
+ * recording starts with the start of balancing, when StateController and Odometry have
+ * just been reset. The header carries everything else the replay needs to continue where the
+ * bot started: persistent memory, calibration of the IMU, and the state of the Kalman filters.
+ *
+ * The records are sent as frames like the telemetry (see Telemetry.h), the first byte tells
+ * the type. A target record is sent whenever the target movement changes.
+ *
+ * Unlike the telemetry, the records are not packed but ordered so that all members are aligned,
+ * so they can be passed by pointer on the Teensy. The layout is the same on the host.
+ * The version needs to be increased whenever the layout of a record changes.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef SENSORRECORDING_H_
+#define SENSORRECORDING_H_
+
+#include <stdint.h>
+#include <BotMemory.h>
+#include <SensorFrontend.h>
+
+const uint8_t SensorRecordingVersion = 1;
+
+enum SensorRecordType { SENSOR_RECORD_HEADER = 'H', SENSOR_RECORD_SAMPLE = 'S', SENSOR_RECORD_TARGET = 'T' };
+
+struct SensorRecordingHeader {
+	uint8_t type;						// SENSOR_RECORD_HEADER
+	uint8_t version;					// SensorRecordingVersion
+	uint16_t layoutVersion;				// PersistentMemLayoutVersion
+	IMUCalibration imuCalibration;
+	float kalman[3][KalmanFilter::StateSize];
+	float imuSample[3][2];				// angle and angular velocity of the current sample
+	float imuDT;						// [s] time between the last two IMU samples
+	uint32_t imuUpdate_us;				// tick of the last IMU sample
+	uint32_t odometryUpdate_us;			// tick of the last call of BallDrive::getSpeed
+	float lastWheelAngle[3];			// [rad] as of the last call of BallDrive::getSpeed
+	uint8_t reverse[3];					// direction of the motors
+	uint8_t persistentMem[sizeof(BotMemory::persistentMem)];
+};
+
+struct SensorRecordingSample {
+	uint8_t type;						// SENSOR_RECORD_SAMPLE
+	uint8_t imuUpdated;					// 1 if the IMU delivered a new sample in this tick
+	uint16_t sequence;					// increased with every sample, wraps around
+	uint32_t tick_us;					// time of the balancing tick
+	uint32_t timestamp_us;				// time of the IMU sample
+	int16_t accel[3];					// counts of the MPU9250
+	int16_t gyro[3];
+	int32_t encoder[3];					// unwrapped counts of the AS5047D per wheel
+};
+
+struct SensorRecordingTarget {
+	uint8_t type;						// SENSOR_RECORD_TARGET
+	uint8_t reserved[3];
+	float state[2][3];					// pos, speed, accel in x and y
+	float omega;
+};
+
+#endif /* SENSORRECORDING_H_ */
@@ -8,12 +8,18 @@
 #include "Arduino.h"
 #include <BotMemory.h>
 #include <libraries/Util.h>
-#include <Setup.h>
+#include <setup.h>
 
 #include <libraries/MenuController.h>
 #include <StateController.h>
-#include <BotController.h>
+#include <LQRGains.h>
+#include <Profiler.h>
+#include <LoadGovernor.h>
+#include <libraries/DeferredLog.h>
+#include <DebugLog.h>
 
+static_assert(LQRSampleFrequency == SampleFrequency, "LQRGains.h has been designed for another sample frequency, run control_design");
+static_assert(sizeof(LQRGain)/sizeof(LQRGain[0]) == LQRStates, "LQRGains.h does not fit to LQRState, run control_design");
 
 void StateControllerConfig::print() {
 	StateControllerConfig defValue;
@@ -73,6 +79,114 @@ void StateControllerConfig::initDefaultValues() {
 }
 
 
+// all weights of StateControllerConfig, used where speed does not matter
+static float StateControllerConfig::* const Weights[] = {
+		&StateControllerConfig::angleWeight, &StateControllerConfig::angularSpeedWeight,
+		&StateControllerConfig::ballPosIntegratedWeight, &StateControllerConfig::ballPositionWeight,
+		&StateControllerConfig::ballVelocityWeight, &StateControllerConfig::ballAccelWeight,
+		&StateControllerConfig::omegaWeight };
+const int NumberOfWeights = sizeof(Weights)/sizeof(Weights[0]);
+static_assert(sizeof(StateControllerConfig) == NumberOfWeights*sizeof(float), "Weights does not cover StateControllerConfig");
+
+void StateControllerSchedule::initDefaultValues() {
+	// all sets are equal to the default configuration, i.e. the schedule has no effect
+	// until the sets at the breakpoints are tuned
+	active = false;
+	const float defaultBreakpoint[ScheduleAxes][ScheduleBreakpoints] = {
+			{ 0.3, 0.9 },						// [m/s] ball speed
+			{ radians(3), radians(8) },			// [rad] tilt
+			{ radians(360), radians(720) } };	// [rad] lifter motor, to be adapted in the menu to the lifter's travel
+	for (int axis = 0;axis<ScheduleAxes;axis++)
+		for (int i = 0;i<ScheduleBreakpoints;i++) {
+			breakpoint[axis][i] = defaultBreakpoint[axis][i];
+			config[axis][i].initDefaultValues();
+		}
+}
+
+bool StateControllerSchedule::isValid() {
+	for (int axis = 0;axis<ScheduleAxes;axis++) {
+		float previous = 0;
+		for (int i = 0;i<ScheduleBreakpoints;i++) {
+			// written such that NaN is invalid as well
+			if (!(breakpoint[axis][i] > previous))
+				return false;
+			previous = breakpoint[axis][i];
+		}
+	}
+	return true;
+}
+
+void StateControllerSchedule::print() {
+	static const char* axisName[ScheduleAxes] = { "speed ", "tilt  ", "lifter" };
+	logging("gain schedule:");
+	loggingln(active?"active":"inactive");
+	for (int axis = 0;axis<ScheduleAxes;axis++)
+		for (int i = 0;i<ScheduleBreakpoints;i++) {
+			logging("   ");
+			logging(axisName[axis]);
+			logging("@");
+			logging(breakpoint[axis][i],2,3);
+			logging(" PD(angle)=(");
+			logging(config[axis][i].angleWeight,2,2);
+			logging(",");
+			logging(config[axis][i].angularSpeedWeight,2,2);
+			logging(") PID(pos)=(");
+			logging(config[axis][i].ballPositionWeight,2,2);
+			logging(",");
+			logging(config[axis][i].ballPosIntegratedWeight,2,2);
+			logging(",");
+			logging(config[axis][i].ballVelocityWeight,2,2);
+			logging(",");
+			logging(config[axis][i].ballAccelWeight,2,2);
+			logging(") P(omega)=(");
+			logging(config[axis][i].omegaWeight,2,2);
+			loggingln(")");
+		}
+}
+
+void GainSchedule::setup(const StateControllerConfig& base, const StateControllerSchedule& schedule) {
+	this->base = base;
+	memcpy(breakpoint, schedule.breakpoint, sizeof(breakpoint));
+	for (int axis = 0;axis<ScheduleAxes;axis++) {
+		// segment k runs from the previous breakpoint (resp. 0) to breakpoint k, the last one is constant
+		float fromX = 0;
+		const StateControllerConfig* from = &base;
+		for (int k = 0;k<=ScheduleBreakpoints;k++) {
+			const StateControllerConfig& to = (k < ScheduleBreakpoints)?schedule.config[axis][k]:*from;
+			float width = (k < ScheduleBreakpoints)?schedule.breakpoint[axis][k] - fromX:0;
+			for (int w = 0;w<NumberOfWeights;w++) {
+				float s = (width > 0)?(to.*Weights[w] - from->*Weights[w])/width:0;
+				slope[axis][k].*Weights[w] = s;
+				offset[axis][k].*Weights[w] = (width > 0)?from->*Weights[w] - base.*Weights[w] - s*fromX
+														  :to.*Weights[w] - base.*Weights[w];
+			}
+			if (k < ScheduleBreakpoints) {
+				fromX = schedule.breakpoint[axis][k];
+				from = &schedule.config[axis][k];
+			}
+		}
+	}
+}
+
+void GainSchedule::interpolate(const float operatingPoint[ScheduleAxes], StateControllerConfig& weights) const {
+	weights = base;
+	for (int axis = 0;axis<ScheduleAxes;axis++) {
+		float x = max(operatingPoint[axis], 0.0f);
+		int k = 0;
+		while ((k < ScheduleBreakpoints) && (x >= breakpoint[axis][k]))
+			k++;
+		const StateControllerConfig& o = offset[axis][k];
+		const StateControllerConfig& s = slope[axis][k];
+		weights.angleWeight 			+= o.angleWeight + s.angleWeight*x;
+		weights.angularSpeedWeight 		+= o.angularSpeedWeight + s.angularSpeedWeight*x;
+		weights.ballPosIntegratedWeight += o.ballPosIntegratedWeight + s.ballPosIntegratedWeight*x;
+		weights.ballPositionWeight 		+= o.ballPositionWeight + s.ballPositionWeight*x;
+		weights.ballVelocityWeight 		+= o.ballVelocityWeight + s.ballVelocityWeight*x;
+		weights.ballAccelWeight 		+= o.ballAccelWeight + s.ballAccelWeight*x;
+		weights.omegaWeight 			+= o.omegaWeight + s.omegaWeight*x;
+	}
+}
+
 void ControlPlane::reset () {
 			lastTargetAngle = 0;
 			lastAngle = 0;
@@ -80,10 +194,17 @@ void ControlPlane::reset () {
 			lastBallSpeed = 0;
 			lastTargetBodyPos = 0;
 			lastTargetBallPos = 0;
+			lastBodyPos = 0;
+			lastBodySpeed = 0;
+			lastBodyAccel = 0;
 			filteredSpeed = 0;
 			speed = 0;
 			accel = 0;
 			error = 0;
+			errorTilt = 0;
+			errorAngularSpeed = 0;
+			errorPos = 0;
+			errorSpeed = 0;
 			posErrorIntegrated = 0;
 
 			// add an FIR Filter with 15Hz to the output of the controller in order to increase gain of state controller
@@ -91,14 +212,16 @@ void ControlPlane::reset () {
 					         1.0e-3f  			/* allowed ripple in passband in amplitude is 0.1% */,
 							 1.0e-4f 			/* supression in stop band is -40db */,
 							 SampleFrequency, 	/* 200 Hz */
-							 15.0f  			/* low pass cut off frequency */);
+							 outputSpeedCutOff	/* low pass cut off frequency, 15Hz */);
             posFilter.init(FIR::LOWPASS,
                              1.0e-3f              /* allowed ripple in passband in amplitude is 0.1% */,
                              1.0e-4f             /* supression in stop band is -40db */,
                              SampleFrequency,     /* 200 Hz */
-                             5.0f                /* low pass cut off frequency */);
+                             posCutOff           /* low pass cut off frequency, 5Hz */);
 
-            outputSpeedFilter2.init(15.0, SampleFrequency);
+            outputSpeedFilter2.init(outputSpeedCutOff, SampleFrequency);
+            observer.reset();
+            mpc.reset();
 }
 
 float ControlPlane::getBodyPos() {
@@ -114,7 +237,7 @@ float ControlPlane::getAccel() {
 }
 
 
-void ControlPlane::update(bool doLogging, float dT,
+void ControlPlane::update(bool doLogging, float dT, const StateControllerConfig& config,
 		const State& current, const State& target,
 		float currentOmega, float targetOmega,
 		const IMUSamplePlane &sensor) {
@@ -127,55 +250,112 @@ void ControlPlane::update(bool doLogging, float dT,
 	// F = -kPθ·θ - kDθ·ω + kPx·x + kIx·∫xdt + kDx·v
 
 	if (dT) {
-		StateControllerConfig& config = memory.persistentMem.ctrlConfig;
-
 		// target angle out of acceleration, assume tan(x) = x
 		float targetAngle = target.accel/Gravity;
 
 		// compute current state variables angle, angular velocity, position, speed, accelst arget angularVelocity out of acceleration
-		float targetAngularVelocity = (targetAngle - lastTargetAngle)*dT;
+		float targetAngularVelocity = (targetAngle - lastTargetAngle)/dT;
+		float angle				= sensor.angle;
+		float angularVelocity	= sensor.angularVelocity;
 		float absBallPos   		= current.pos;
 		float absBallSpeed 		= current.speed;
-		float bodyPos = absBallPos + sensor.angle * CentreOfGravityHeight;
-		float bodySpeed = (bodyPos - lastBodyPos)/dT;
-		float bodyAccel = (bodySpeed - lastBodySpeed)/dT;
+		float bodyPos;
+		float bodySpeed;
+		float bodyAccel;
+		if (estimation == ESTIMATE_OBSERVER) {
+			// state out of the observer, speed and acceleration of the body out of the model
+			observer.correct(sensor, current);
+			angle 				= observer.getTilt();
+			angularVelocity		= observer.getAngularVelocity();
+			absBallPos			= observer.getPos();
+			absBallSpeed		= observer.getSpeed();
+			bodyPos = absBallPos + angle * CentreOfGravityHeight;
+			bodySpeed = absBallSpeed + angularVelocity * CentreOfGravityHeight;
+			bodyAccel = observer.getAccel() + observer.getAngularAccel() * CentreOfGravityHeight;
+		} else {
+			bodyPos = absBallPos + angle * CentreOfGravityHeight;
+			bodySpeed = (bodyPos - lastBodyPos)/dT;
+			bodyAccel = (bodySpeed - lastBodySpeed)/dT;
+		}
 
 		float targetBallPos	 	= target.pos - targetAngle * CentreOfGravityHeight;
 		float targetBallSpeed 	= (targetBallPos - lastTargetBallPos)/dT;
 
-		// compute errors for PD(angle) and PID(position)
-		float error_tilt			= (sensor.angle-targetAngle);
-		float gradient = 10.0;
-		error_tilt = error_tilt + sgn(error_tilt)*abs(error_tilt*error_tilt*gradient);
-		float error_angular_speed	= (sensor.angularVelocity-targetAngularVelocity);
-
-		float posError 	= (absBallPos - targetBallPos);
-		posError = posFilter.update(posError);
 		const float posErrorLimitAngle = radians(3);
-		posError = constrain (posError,
-								-posErrorLimitAngle*config.angleWeight / config.ballPositionWeight,
-								+posErrorLimitAngle*config.angleWeight / config.ballPositionWeight);
-		posErrorIntegrated 			+= posError*dT;
-		posErrorIntegrated 			=
-					constrain(posErrorIntegrated,
-								-posErrorLimitAngle*config.angleWeight / config.ballPosIntegratedWeight,
-								+posErrorLimitAngle*config.angleWeight / config.ballPosIntegratedWeight);
-		float speedError 		= (bodySpeed - targetBallSpeed);
-		float accelError 	    = (bodyAccel - target.accel);
-
-		float error_centripedal     = targetOmega * target.speed;
-
-		// sum up all weighted errors
-		error =	+ config.angleWeight*error_tilt + config.angularSpeedWeight*error_angular_speed
-						+ config.ballPositionWeight*posError + config.ballPosIntegratedWeight*posErrorIntegrated  + config.ballVelocityWeight*speedError+  + config.ballAccelWeight*accelError
-						+ config.omegaWeight * error_centripedal;
-
-
+		if (mode != CONTROL_WEIGHTS) {
+			// full state feedback, either with the gains of the Riccati solution or with the law of the
+			// region of the explicit MPC. The state is that of the odometry, so neither the body's speed
+			// nor the position filter are needed. The errors are limited by the gains of the LQR resp.
+			// of the unconstrained region of the MPC
+			float tiltGain 			= (mode == CONTROL_LQR)?LQRGain[LQR_TILT]:ExplicitMPC::getGain(LQR_TILT);
+			float posGain 			= (mode == CONTROL_LQR)?LQRGain[LQR_POS]:ExplicitMPC::getGain(LQR_POS);
+			float posIntegratedGain = (mode == CONTROL_LQR)?LQRGain[LQR_POS_INTEGRATED]:ExplicitMPC::getGain(LQR_POS_INTEGRATED);
+			float posError 		= (absBallPos - targetBallPos);
+			posError = constrain (posError,
+									-posErrorLimitAngle*abs(tiltGain / posGain),
+									+posErrorLimitAngle*abs(tiltGain / posGain));
+			posErrorIntegrated 			+= posError*dT;
+			posErrorIntegrated 			=
+						constrain(posErrorIntegrated,
+									-posErrorLimitAngle*abs(tiltGain / posIntegratedGain),
+									+posErrorLimitAngle*abs(tiltGain / posIntegratedGain));
+
+			errorTilt = (angle-targetAngle);
+			errorAngularSpeed = (angularVelocity-targetAngularVelocity);
+			errorPos = posError;
+			errorSpeed = (absBallSpeed - targetBallSpeed);
+
+			if (mode == CONTROL_LQR)
+				accel = LQRGain[LQR_TILT]*errorTilt + LQRGain[LQR_ANGULAR_VELOCITY]*errorAngularSpeed
+						+ LQRGain[LQR_POS]*errorPos + LQRGain[LQR_SPEED]*errorSpeed
+						+ LQRGain[LQR_POS_INTEGRATED]*posErrorIntegrated;
+			else {
+				// the target angle and speed are required by the limits of tilt and speed
+				float parameter[MPCParameters] = { errorTilt, errorAngularSpeed, errorPos, errorSpeed, posErrorIntegrated,
+												   targetAngle, targetBallSpeed };
+				accel = mpc.evaluate(parameter);
+			}
 
-		// outcome of controller is force to be applied to the ball
-		// F = m*a,
-		float force = error;
-		accel = force / BallWeight;
+			// keep the force for the flight recorder, comparable to the weights mode
+			error = accel * BallWeight;
+		} else {
+			// compute errors for PD(angle) and PID(position)
+			float error_tilt			= (angle-targetAngle);
+			float gradient = 10.0;
+			error_tilt = error_tilt + sgn(error_tilt)*abs(error_tilt*error_tilt*gradient);
+			float error_angular_speed	= (angularVelocity-targetAngularVelocity);
+
+			float posError 	= (absBallPos - targetBallPos);
+			posError = posFilter.update(posError);
+			posError = constrain (posError,
+									-posErrorLimitAngle*config.angleWeight / config.ballPositionWeight,
+									+posErrorLimitAngle*config.angleWeight / config.ballPositionWeight);
+			posErrorIntegrated 			+= posError*dT;
+			posErrorIntegrated 			=
+						constrain(posErrorIntegrated,
+									-posErrorLimitAngle*config.angleWeight / config.ballPosIntegratedWeight,
+									+posErrorLimitAngle*config.angleWeight / config.ballPosIntegratedWeight);
+			float speedError 		= (bodySpeed - targetBallSpeed);
+			float accelError 	    = (bodyAccel - target.accel);
+
+			float error_centripedal     = targetOmega * target.speed;
+
+			// keep the single terms for the flight recorder
+			errorTilt = error_tilt;
+			errorAngularSpeed = error_angular_speed;
+			errorPos = posError;
+			errorSpeed = speedError;
+
+			// sum up all weighted errors
+			error =	+ config.angleWeight*error_tilt + config.angularSpeedWeight*error_angular_speed
+							+ config.ballPositionWeight*posError + config.ballPosIntegratedWeight*posErrorIntegrated  + config.ballVelocityWeight*speedError+  + config.ballAccelWeight*accelError
+							+ config.omegaWeight * error_centripedal;
+
+			// outcome of controller is force to be applied to the ball
+			// F = m*a,
+			float force = error;
+			accel = force / BallWeight;
+		}
 
 		accel = constrain(accel,-MaxBotAccel, MaxBotAccel);
 
@@ -186,30 +366,23 @@ void ControlPlane::update(bool doLogging, float dT,
 			speed = constrain(speed, -MaxBotSpeed, + MaxBotSpeed);
 		}
 
-		// get rid of trembling by a FIR filter 4th order with 15Hz
-		// filteredSpeed = speed;
-		filteredSpeed = outputSpeedFilter.update(speed);
-		// filteredSpeed = outputSpeedFilter2.update(speed);
+		if (estimation == ESTIMATE_OBSERVER) {
+			// the observer does not amplify noise like the finite differences, so the output filter
+			// and its lag are not needed. The change of speed is the input of the observer's model
+			observer.predict((speed - filteredSpeed)/dT);
+			filteredSpeed = speed;
+		} else {
+			// get rid of trembling by a FIR filter 4th order with 15Hz
+			// filteredSpeed = speed;
+			filteredSpeed = outputSpeedFilter.update(speed);
+			// filteredSpeed = outputSpeedFilter2.update(speed);
+		}
 
 		if (doLogging) {
-				if (memory.persistentMem.logConfig.debugStateLog) {
-					logging("imu=(");
-					logging(sensor.angle,2,3);
-					logging(",");
-					logging(sensor.angularVelocity,2,3);
-					logging(") ");
-
-					logging(" p(");
-					logging(current.pos,2,3);
-					logging(",");
-					logging(current.speed,2,3);
-					logging(")");
-
-					logging(" error=");
-					logging(error,3,3);
-					logging(")");
-				}
-			}
+			LogCost cost(LOG_STATE);
+			deferredLog.log("imu=({2.3},{2.3})  p({2.3},{2.3}) error={3.3})",
+							sensor.angle, sensor.angularVelocity, current.pos, current.speed, error);
+		}
 		lastTargetAngle = targetAngle;
 		lastAngle = sensor.angle;
 
@@ -222,21 +395,20 @@ void ControlPlane::update(bool doLogging, float dT,
 		lastBodyAccel = bodyAccel;
 
 
-		if (doLogging)
-			if (memory.persistentMem.logConfig.debugStateLog) {
-				logging(" output=(");
-				logging(accel,3,3);
-				logging(",");
-				logging(speed,3,3);
-				logging(",");
-				logging(filteredSpeed,3,3);
-				logging(")");
-			}
+		if (doLogging) {
+			LogCost cost(LOG_STATE);
+			deferredLog.log(" output=({3.3},{3.3},{3.3})", accel, speed, filteredSpeed);
+		}
 	};
 }
 
-void StateController::setup(MenuController* menuCtrl) {
+void StateController::setup(MenuController* menuCtrl, BalanceToggle balanceToggle) {
 	registerMenuController(menuCtrl);
+	this->balanceToggle = balanceToggle;
+	if (config == NULL)
+		config = &memory.persistentMem.ctrlConfig;
+	if (schedule == NULL)
+		schedule = &memory.persistentMem.ctrlSchedule;
 	reset();
 }
 
@@ -244,6 +416,56 @@ void StateController::reset() {
 	planeX.reset();
 	planeY.reset();
 	rampedTargetMovement.reset();
+	updateSchedule();
+}
+
+void StateController::updateSchedule() {
+	if (!schedule->isValid()) {
+		loggingln("gain schedule with invalid breakpoints, reset to defaults");
+		schedule->initDefaultValues();
+	}
+	gainSchedule.setup(*config, *schedule);
+}
+
+StateControllerConfig& StateController::getEditedConfig() {
+	if (editedSet < 0)
+		return *config;
+	return schedule->config[editedSet / ScheduleBreakpoints][editedSet % ScheduleBreakpoints];
+}
+
+void StateController::printEditedSet() {
+	static const char* axisName[ScheduleAxes] = { "speed", "tilt", "lifter" };
+	if (editedSet < 0) {
+		logging("configuration");
+		return;
+	}
+	int axis = editedSet / ScheduleBreakpoints;
+	logging(axisName[axis]);
+	logging("@");
+	logging(schedule->breakpoint[axis][editedSet % ScheduleBreakpoints],2,3);
+}
+
+void StateController::setFilterCutOff(float posCutOff, float outputSpeedCutOff) {
+	ControlPlane* plane[2] = { &planeX, &planeY };
+	for (int i = 0;i<2;i++) {
+		plane[i]->posCutOff = posCutOff;
+		plane[i]->outputSpeedCutOff = outputSpeedCutOff;
+	}
+	reset();
+}
+
+void StateController::setControlMode(ControlMode mode) {
+	planeX.mode = mode;
+	planeY.mode = mode;
+
+	// the integral and the filters of the other algorithm are meaningless
+	reset();
+}
+
+void StateController::setStateEstimation(StateEstimation estimation) {
+	planeX.estimation = estimation;
+	planeY.estimation = estimation;
+	reset();
 }
 
 void StateController::update(float dT,
@@ -251,30 +473,41 @@ void StateController::update(float dT,
 							 const BotMovement& currentMovement,
 							 const BotMovement& targetBotMovement) {
 
-	uint32_t start = millis();
+	ProfileScope scope(PROFILE_STATE_UPDATE);
+
 	// ramp up target speed and omega with a trapezoid profile of constant acceleration
 	rampedTargetMovement.rampUp(targetBotMovement, dT);
-	bool doLogging = logTimer.isDue_ms(1000,millis());
-	if (doLogging && memory.persistentMem.logConfig.debugStateLog)
-		logging("   planeX:");
-	planeX.update(doLogging, dT,
+	// log once a second, unless the category is not compiled or the load governor suspended debug logging
+	bool doLogging = LOG_ENABLED(LOG_LEVEL_DEBUG, LOG_STATE) &&
+					 !loadGovernor.sheds(LOAD_SHED_DEBUG_LOG) && logTimer.isDue_ms(1000,millis());
+	// interpolate the weights at the operating point of each plane
+	const StateControllerConfig* configX = config;
+	const StateControllerConfig* configY = config;
+	StateControllerConfig scheduledX, scheduledY;
+	if (schedule->active && (getControlMode() == CONTROL_WEIGHTS)) {
+		float operatingPointX[ScheduleAxes] = { abs(currentMovement.x.speed), abs(sensorSample.plane[Dimension::X].angle), lifterPosition };
+		float operatingPointY[ScheduleAxes] = { abs(currentMovement.y.speed), abs(sensorSample.plane[Dimension::Y].angle), lifterPosition };
+		gainSchedule.interpolate(operatingPointX, scheduledX);
+		gainSchedule.interpolate(operatingPointY, scheduledY);
+		configX = &scheduledX;
+		configY = &scheduledY;
+	}
+
+	if (doLogging)
+		deferredLog.log("   planeX:");
+	planeX.update(doLogging, dT, *configX,
 					currentMovement.x, rampedTargetMovement.x,
 					currentMovement.omega, rampedTargetMovement.omega,
 					sensorSample.plane[Dimension::X]);
 
-	if (doLogging && memory.persistentMem.logConfig.debugStateLog) {
-		loggingln();
-		logging("   planeY:");
-	}
-	planeY.update(doLogging, dT,
+	if (doLogging)
+		deferredLog.log("\n   planeY:");
+	planeY.update(doLogging, dT, *configY,
 					currentMovement.y, rampedTargetMovement.y,
 					currentMovement.omega, rampedTargetMovement.omega,
 					sensorSample.plane[Dimension::Y]);
-	if (doLogging && memory.persistentMem.logConfig.debugStateLog) {
-		loggingln();
-	}
-	uint32_t end = millis();
-	avrLoopTime = (avrLoopTime + ((float)(end - start)*0.001))*0.5;
+	if (doLogging)
+		deferredLog.log("\n");
 }
 
 float StateController::getSpeedX() {
@@ -304,12 +537,27 @@ void StateController::printHelp() {
 	loggingln();
 	loggingln("z/Z - omega weight");
 	loggingln("b   - balance on/off");
+	logging("l   - control mode weights/LQR/MPC [");
+	logging((getControlMode() == CONTROL_LQR)?"LQR":(getControlMode() == CONTROL_MPC)?"MPC":"weights");
+	loggingln("]");
+	logging("o   - state estimation differences/observer [");
+	logging((getStateEstimation() == ESTIMATE_OBSERVER)?"observer":"differences");
+	loggingln("]");
+
+	logging("g   - gain schedule on/off [");
+	logging(schedule->active?"on":"off");
+	loggingln("]");
+	logging("k   - select set of the weight keys [");
+	printEditedSet();
+	loggingln("]");
+	loggingln("x/X - move breakpoint of the selected set");
 
 	loggingln("0   - set null");
 	loggingln();
 	loggingln("ESC");
 	loggingln();
-	memory.persistentMem.ctrlConfig.print();
+	config->print();
+	schedule->print();
 	loggingln();
 }
 
@@ -317,20 +565,72 @@ void StateController::printHelp() {
 void StateController::menuLoop(char ch, bool continously) {
 
 		bool cmd = true;
-		StateControllerConfig& config = memory.persistentMem.ctrlConfig;
+		StateControllerConfig& config = getEditedConfig();
 		switch (ch) {
 		case 'h':
 			printHelp();
 			break;
 		case 'b':
-			BotController::getInstance().balanceMode(BotController::getInstance().isBalancing()?
-											BotController::BotMode::OFF:
-											BotController::BotMode::BALANCING);
-			if (BotController::getInstance().isBalancing())
+			if (balanceToggle == NULL)
+				break;
+			if (balanceToggle())
 				loggingln("balancing mode on");
 			else
 				loggingln("balancing mode off");
 			break;
+		case 'l':
+			setControlMode((getControlMode() == CONTROL_WEIGHTS)?CONTROL_LQR:
+						   (getControlMode() == CONTROL_LQR)?CONTROL_MPC:CONTROL_WEIGHTS);
+			if (getControlMode() == CONTROL_LQR)
+				loggingln("LQR mode");
+			else if (getControlMode() == CONTROL_MPC)
+				loggingln("MPC mode");
+			else
+				loggingln("weights mode");
+			break;
+		case 'g':
+			schedule->active = !schedule->active;
+			if (schedule->active)
+				loggingln("gain schedule on");
+			else
+				loggingln("gain schedule off");
+			break;
+		case 'k':
+			// cycle through the configuration and the sets of the schedule
+			editedSet++;
+			if (editedSet >= ScheduleAxes*ScheduleBreakpoints)
+				editedSet = -1;
+			logging("weight keys edit ");
+			printEditedSet();
+			loggingln();
+			getEditedConfig().print();
+			break;
+		case 'x':
+		case 'X': {
+			if (editedSet < 0) {
+				loggingln("select a set of the schedule with k first");
+				break;
+			}
+			// steps along speed [m/s], tilt [rad] and lifter [rad]
+			const float breakpointStep[ScheduleAxes] = { 0.05, radians(0.5), radians(30) };
+			int axis = editedSet / ScheduleBreakpoints;
+			float& breakpoint = schedule->breakpoint[axis][editedSet % ScheduleBreakpoints];
+			float previous = breakpoint;
+			breakpoint += ((ch == 'X')?1.0:-1.0)*(continously?5.0:1.0)*breakpointStep[axis];
+			if (!schedule->isValid()) {
+				breakpoint = previous;
+				loggingln("breakpoints need to be positive and ascending");
+			}
+			schedule->print();
+			break;
+		}
+		case 'o':
+			setStateEstimation((getStateEstimation() == ESTIMATE_OBSERVER)?ESTIMATE_DIFFERENCES:ESTIMATE_OBSERVER);
+			if (getStateEstimation() == ESTIMATE_OBSERVER)
+				loggingln("state observer");
+			else
+				loggingln("finite differences");
+			break;
 		case '0':
 			config.angleWeight = 0.0;
 			config.angularSpeedWeight = 0.0;
@@ -406,6 +706,8 @@ void StateController::menuLoop(char ch, bool continously) {
 			break;
 		}
 		if (cmd) {
+			// the weights at 0 are the base of the schedule
+			updateSchedule();
 			logging(">");
 		}
 }
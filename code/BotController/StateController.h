@@ -14,10 +14,25 @@
 
 #include <types.h>
 #include <setup.h>
-#include <IMU.h>
+#include <IMUSample.h>
+#include <StateObserver.h>
+#include <ExplicitMPC.h>
+#include <libraries/MenuController.h>
 #include <TimePassedBy.h>
 
 
+// algorithm of the ControlPlane, either the weights of StateControllerConfig, the gains of a
+// linear quadratic regulator computed offline (LQRGains.h), or the explicit MPC (MPCTable.h)
+enum ControlMode { CONTROL_WEIGHTS = 0, CONTROL_LQR = 1, CONTROL_MPC = 2 };
+
+// order of the state vector of the LQR mode
+enum LQRState { LQR_TILT = 0, LQR_ANGULAR_VELOCITY = 1, LQR_POS = 2, LQR_SPEED = 3, LQR_POS_INTEGRATED = 4 };
+const int LQRStates = 5;
+
+// source of the state of the ControlPlane, either the measurement with speed and acceleration of the body
+// as finite differences, or the estimation of the StateObserver
+enum StateEstimation { ESTIMATE_DIFFERENCES = 0, ESTIMATE_OBSERVER = 1 };
+
 class StateControllerConfig {
 public:
 	void null();
@@ -34,6 +49,46 @@ public:
 	float omegaWeight;
 };
 
+// axes of the operating point of a plane the weights are scheduled by: absolute ball speed [m/s],
+// absolute tilt [rad], and the position of the lifter as angle of its motor [rad]
+enum ScheduleAxis { SCHEDULE_BALL_SPEED = 0, SCHEDULE_TILT = 1, SCHEDULE_LIFTER = 2 };
+const int ScheduleAxes = 3;
+const int ScheduleBreakpoints = 2;
+
+// persistent gain schedule of the weights. Along each axis the weights are interpolated linearly
+// from StateControllerConfig at 0 to the sets at the ascending breakpoints, beyond the last one
+// they are constant. The deviations of all axes from StateControllerConfig add up.
+// The sets and breakpoints are edited in the menu of the StateController.
+class StateControllerSchedule {
+public:
+	void null();
+	void initDefaultValues();
+	void print();
+
+	// true if the breakpoints of all axes are positive and ascending, which interpolation relies on
+	bool isValid();
+	bool active;
+	float breakpoint[ScheduleAxes][ScheduleBreakpoints];
+	StateControllerConfig config[ScheduleAxes][ScheduleBreakpoints];
+};
+
+// schedule with precomputed slopes of its segments, so interpolating costs one multiply-add
+// per weight and axis
+class GainSchedule {
+public:
+	// to be called after each change of the configuration or the schedule
+	void setup(const StateControllerConfig& base, const StateControllerSchedule& schedule);
+
+	// weights at the operating point, indexed by ScheduleAxis
+	void interpolate(const float operatingPoint[ScheduleAxes], StateControllerConfig& weights) const;
+private:
+	StateControllerConfig base;
+	float breakpoint[ScheduleAxes][ScheduleBreakpoints];
+	// deviation from base within segment k is offset + slope·x
+	StateControllerConfig offset[ScheduleAxes][ScheduleBreakpoints+1];
+	StateControllerConfig slope[ScheduleAxes][ScheduleBreakpoints+1];
+};
+
 
 
 class ControlPlane {
@@ -49,6 +104,10 @@ class ControlPlane {
 		float lastBodySpeed;
 		float lastBodyAccel;
 		float error;
+		float errorTilt;			// single error terms of the last update, summed up weighted in error
+		float errorAngularSpeed;
+		float errorPos;
+		float errorSpeed;
 		float accel;
 		float speed;			// speed in x direction [m/s]
 		float filteredSpeed;
@@ -57,10 +116,19 @@ class ControlPlane {
 		FIR::Filter  posFilter;
 		FIR::Filter outputSpeedFilter;
 
+		// cut off frequencies of the filters [Hz], set up in reset()
+		float posCutOff = 5.0;
+		float outputSpeedCutOff = 15.0;
+
 		LowPassFilter1stOrder outputSpeedFilter2;
 
+		ControlMode mode = CONTROL_WEIGHTS;
+		StateEstimation estimation = ESTIMATE_DIFFERENCES;
+		StateObserver observer;
+		ExplicitMPC mpc;
+
 		// compute new speed in the given pane, i.e. returns the error correction that keeps the bot balanced and on track
-		void update(bool log,float dT,
+		void update(bool log,float dT, const StateControllerConfig& config,
 					const State& current, const State& target,
 						float pActualOmega, float pToBeOmega,
 					const IMUSamplePlane &sensor);
@@ -71,15 +139,46 @@ class ControlPlane {
 };
 
 
+// switches balancing on or off, returns true if the bot is balancing afterwards
+typedef bool (*BalanceToggle)();
+
 class StateController : public Menuable {
 public:
 	StateController() {};
 	virtual ~StateController() {};
 
-	void setup(MenuController* menuCtrl);
+	void setup(MenuController* menuCtrl, BalanceToggle balanceToggle = NULL);
+
+	// use a configuration other than the persistent one, e.g. in the simulator
+	void setConfig(StateControllerConfig* config) { this->config = config; };
+	StateControllerConfig& getConfig() { return *config; };
+
+	// use a schedule other than the persistent one. The weights are scheduled in the weights mode
+	// only, and only if the schedule is active
+	void setSchedule(StateControllerSchedule* schedule) { this->schedule = schedule; };
+	StateControllerSchedule& getSchedule() { return *schedule; };
+
+	// precompute the slopes of the schedule again, after changing the configuration or the schedule.
+	// An invalid schedule, e.g. out of an old EEPROM image, is reset to its default values
+	void updateSchedule();
+
+	// position of the lifter, the operating point of the schedule along SCHEDULE_LIFTER
+	void setLifterPosition(float angle) { lifterPosition = angle; };
 	void loop();
 
 	void reset();
+
+	// change the cut off frequencies [Hz] of the filters of both planes, e.g. to analyse the loop on the host
+	void setFilterCutOff(float posCutOff, float outputSpeedCutOff);
+
+	// switch the algorithm of both planes, not persistent, balancing starts with the weights
+	void setControlMode(ControlMode mode);
+	ControlMode getControlMode() { return planeX.mode; };
+
+	// switch the state estimation of both planes, not persistent, to compare with the finite differences
+	void setStateEstimation(StateEstimation estimation);
+	StateEstimation getStateEstimation() { return planeX.estimation; };
+
 	virtual void printHelp();
 	virtual void menuLoop(char ch, bool continously);
 
@@ -107,17 +206,26 @@ public:
 		return planeY.getAccel();
 	}
 
-	// return average time consumed by update in [s]
-	float getAvrLoopTime() { return avrLoopTime; };
+	const ControlPlane& getPlaneX() { return planeX; };
+	const ControlPlane& getPlaneY() { return planeY; };
 
 private:
 	ControlPlane planeX;
 	ControlPlane planeY;
 
 	BotMovement rampedTargetMovement;
-	float avrLoopTime = 0;
 	TimePassedBy logTimer;
-
+	BalanceToggle balanceToggle = NULL;
+	StateControllerConfig* config = NULL;
+	StateControllerSchedule* schedule = NULL;
+	GainSchedule gainSchedule;
+	float lifterPosition = 0;
+
+	// set edited by the weight keys of the menu, -1 is the configuration, otherwise the
+	// set at breakpoint editedSet % ScheduleBreakpoints of axis editedSet / ScheduleBreakpoints
+	int editedSet = -1;
+	StateControllerConfig& getEditedConfig();
+	void printEditedSet();
 };
 
 #endif /* STATECONTROLLER_H_ */
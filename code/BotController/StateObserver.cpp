@@ -0,0 +1,54 @@
+/*
+ * StateObserver.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <setup.h>
+#include <StateObserver.h>
+#include <ObserverGains.h>
+
+static_assert(ObserverSampleFrequency == SampleFrequency, "ObserverGains.h has been designed for another sample frequency, run control_design");
+
+void StateObserver::reset() {
+	for (int i = 0;i<ObserverStates;i++)
+		estimate[i] = 0;
+	accel = 0;
+	initialised = false;
+}
+
+void StateObserver::correct(const IMUSamplePlane& sensor, const State& current) {
+	float measurement[ObserverStates] = { sensor.angle, sensor.angularVelocity, current.pos, current.speed };
+
+	// without a prediction the measurement is the best estimate
+	if (!initialised) {
+		for (int i = 0;i<ObserverStates;i++)
+			estimate[i] = measurement[i];
+		initialised = true;
+		return;
+	}
+
+	float innovation[ObserverStates];
+	for (int i = 0;i<ObserverStates;i++)
+		innovation[i] = measurement[i] - estimate[i];
+	for (int i = 0;i<ObserverStates;i++)
+		for (int j = 0;j<ObserverStates;j++)
+			estimate[i] += ObserverGain[i][j]*innovation[j];
+}
+
+void StateObserver::predict(float accel) {
+	float prediction[ObserverStates];
+	for (int i = 0;i<ObserverStates;i++) {
+		prediction[i] = ObserverInput[i]*accel;
+		for (int j = 0;j<ObserverStates;j++)
+			prediction[i] += ObserverModel[i][j]*estimate[j];
+	}
+	for (int i = 0;i<ObserverStates;i++)
+		estimate[i] = prediction[i];
+	this->accel = accel;
+}
+
+float StateObserver::getAngularAccel() {
+	return ObserverAngularAccel[0]*estimate[0] + ObserverAngularAccel[1]*accel;
+}
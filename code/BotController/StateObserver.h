@@ -0,0 +1,52 @@
+/*
+ * StateObserver.h
+ *
+ * Steady state Kalman observer of one plane. Estimates tilt, angular velocity, position and
+ * speed of the ball out of the IMU and the odometry, using the linearised model of the bot
+ * with the acceleration set by the controller as input. Model and gains are computed offline
+ * by control_design (ObserverGains.h), so one tick costs two fixed small matrix-vector products.
+ *
+ * Replaces the finite differences of ControlPlane, the speed and acceleration of the body
+ * come out of the estimated state instead of differentiating the body's position twice.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef STATEOBSERVER_H_
+#define STATEOBSERVER_H_
+
+#include <types.h>
+#include <IMUSample.h>
+
+// the observer estimates the state of LQRState without the integrated position
+const int ObserverStates = 4;
+
+class StateObserver {
+public:
+	StateObserver() {};
+
+	// start with the next measurement
+	void reset();
+
+	// correct the prediction with the measurement of this tick
+	void correct(const IMUSamplePlane& sensor, const State& current);
+
+	// predict the next tick out of the acceleration [m/s^2] that has been set in this tick
+	void predict(float accel);
+
+	float getTilt() { return estimate[0]; };
+	float getAngularVelocity() { return estimate[1]; };
+	float getPos() { return estimate[2]; };
+	float getSpeed() { return estimate[3]; };
+
+	// angular acceleration [rad/s^2] out of the model with the acceleration of the last tick
+	float getAngularAccel();
+	float getAccel() { return accel; };
+private:
+	float estimate[ObserverStates] = { 0, 0, 0, 0 };
+	float accel = 0;
+	bool initialised = false;
+};
+
+#endif /* STATEOBSERVER_H_ */
@@ -9,6 +9,7 @@
 #include <Trajectory.h>
 #include <libraries/Util.h>
 #include <BotController.h>
+#include <MicroClock.h>
 
 void Trajectory::setup(MenuController* menuCtrl) {
 	// register out menu
@@ -41,13 +42,12 @@ void Trajectory::printHelp() {
 	logger->println("ESC");
 }
 
-void Trajectory::loop() {
-	uint32_t now = millis();
-	if (lastLoopTime > 0) {
-		float dT = ((float)(now - lastLoopTime))/1000.0;
+void Trajectory::loop(uint64_t now_us) {
+	if (lastLoopTime_us > 0) {
+		float dT = MicroClock::seconds(now_us - lastLoopTime_us);
 
 		// end of target, set target speed, no acceleration
-		if (millis() > targetTime ) {
+		if (now_us/1000 > targetTime ) {
 			current.x.speed = targetSpeed.x;
 			current.y.speed = targetSpeed.y;
 			current.x.accel= 0;
@@ -67,7 +67,7 @@ void Trajectory::loop() {
 		BotController::getInstance().setTarget(current);
 	}
 
-	lastLoopTime = now;
+	lastLoopTime_us = now_us;
 }
 
 void Trajectory::menuLoop(char ch, bool continously) {
@@ -22,7 +22,8 @@ public:
 	virtual ~Trajectory() {};
 
 	void setup(MenuController* menuCtrl);
-	void loop();
+	// to be called with the time of the current tick [us]
+	void loop(uint64_t now_us);
 
 	void setSpeed(const Speed3D& speed);
 	void setOdom(const Pose& pose, uint32_t approachingTime, const Speed& targetSpeed);
@@ -44,7 +45,7 @@ private:
 	uint32_t targetTime = 0;;
 	BotMovement current;
 
-	uint32_t lastLoopTime = 0;
+	uint64_t lastLoopTime_us = 0;
 };
 
 #endif /* BALLDRIVE_H_ */
@@ -0,0 +1,118 @@
+/*
+ * BufferedSerial.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <libraries/BufferedSerial.h>
+
+void BufferedSerial::loop() {
+	// only one caller moves the tail. A write from an interrupt never calls loop(), but
+	// flush() of the main loop might have been interrupted by the serial task
+	if (sending)
+		return;
+	sending = true;
+	int n = port.availableForWrite();
+	while ((n > 0) && (tail != head)) {
+		// send the contiguous part up to the end of the ring buffer in one go
+		uint16_t t = tail;
+		uint16_t h = head;
+		int len = ((h > t)?h:TxBufferSize) - t;
+		if (len > n)
+			len = n;
+		port.write(&txBuffer[t], len);
+		tail = (t + len) & (TxBufferSize-1);
+		n -= len;
+	}
+	sending = false;
+}
+
+bool BufferedSerial::inInterrupt() {
+	// a write while sending can only come from an interrupt that landed in loop()
+	if (sending)
+		return true;
+#ifdef SCB_ICSR
+	// number of the active exception, 0 in thread mode
+	return (SCB_ICSR & 0xFF) != 0;
+#else
+	return false;
+#endif
+}
+
+void BufferedSerial::flush() {
+	while (tail != head) {
+		loop();
+		yield();
+	}
+	port.flush();
+}
+
+size_t BufferedSerial::write(const uint8_t *buffer, size_t size) {
+	// output comes from the main loop and from interrupts (i2c), so the buffer is locked while writing
+
+	// when blocking, wait until the UART made enough space, longer writes are split. An interrupt
+	// must not wait for the UART and must not send, so its output is dropped if the buffer is full
+	if ((policy == BLOCK_ON_FULL) && !inInterrupt()) {
+		size_t written = 0;
+		while (written < size) {
+			noInterrupts();
+			size_t chunk = min((size_t)availableForWrite(), size - written);
+			enqueue(buffer + written, chunk);
+			interrupts();
+			written += chunk;
+			if (chunk == 0) {
+				loop();
+				yield();
+			}
+		}
+		return written;
+	}
+
+	noInterrupts();
+	if ((int)size > availableForWrite()) {
+		droppedWrites++;
+		droppedBytes += size;
+		interrupts();
+		return 0;
+	}
+	enqueue(buffer, size);
+	interrupts();
+	return size;
+}
+
+void BufferedSerial::enqueue(const uint8_t *buffer, size_t size) {
+	uint16_t h = head;
+	for (size_t i = 0;i<size;i++) {
+		txBuffer[h] = buffer[i];
+		h = (h + 1) & (TxBufferSize-1);
+	}
+	head = h;
+	int u = used();
+	if (u > maxUsed)
+		maxUsed = u;
+}
+
+void BufferedSerial::resetStatistics() {
+	droppedWrites = 0;
+	droppedBytes = 0;
+	maxUsed = 0;
+}
+
+void BufferedSerial::printStatistics() {
+	// goes into the buffer itself, so the numbers are taken before
+	uint32_t writes = droppedWrites;
+	uint32_t bytes = droppedBytes;
+	int maxBytes = maxUsed;
+	print("serial: max=");
+	print(maxBytes);
+	print("/");
+	print(TxBufferSize);
+	print(" dropped=");
+	print(writes);
+	print(" writes ");
+	print(bytes);
+	println(" bytes");
+}
@@ -0,0 +1,87 @@
+/*
+ * BufferedSerial.h
+ *
+ * Stream that puts all output into a large ring buffer instead of waiting until the UART
+ * has space in its (small) transmit buffer. loop() moves as many bytes as the UART accepts
+ * without blocking, the UART's transmit interrupt does the rest.
+ * When the ring buffer is full, the policy decides:
+ * 		BLOCK_ON_FULL	wait until the UART has sent enough (used unless balancing, so menus,
+ * 						help texts and dumps are complete)
+ * 		DROP_ON_FULL	drop the complete write and count it (used while balancing)
+ * A write is either buffered or dropped as a whole, but a line printed in several writes
+ * (print(float) even writes digit by digit) may lose some of its parts. Output while balancing
+ * should therefore be written in one go, like DeferredLog does.
+ * Output written from an interrupt (e.g. the i2c receive event) is always dropped if the buffer
+ * is full, since an interrupt must neither wait for the UART nor send itself.
+ * Reading is passed through to the underlying stream.
+ *
+ * use:
+ * 		Serial5.begin(230400);
+ * 		BufferedSerial bufferedSerial(Serial5);
+ * 		bufferedSerial.print("hello");			// returns immediately
+ * 		bufferedSerial.loop();					// to be called frequently
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef BUFFEREDSERIAL_H_
+#define BUFFEREDSERIAL_H_
+
+#include <Arduino.h>
+
+class BufferedSerial : public Stream {
+public:
+	static const int TxBufferSize = 4096;		// power of 2
+
+	enum Policy { BLOCK_ON_FULL, DROP_ON_FULL };
+
+	BufferedSerial(Stream& port) : port(port) {};
+	virtual ~BufferedSerial() {};
+
+	void setPolicy(Policy policy) { this->policy = policy; };
+
+	// send as many bytes to the UART as it accepts without blocking
+	void loop();
+
+	// wait until the buffer is empty
+	virtual void flush();
+
+	virtual size_t write(uint8_t c) { return write(&c, 1); };
+	virtual size_t write(const uint8_t *buffer, size_t size);
+	using Print::write;
+	virtual int availableForWrite() { return TxBufferSize - 1 - used(); };
+
+	virtual int available() { return port.available(); };
+	virtual int read() { return port.read(); };
+	virtual int peek() { return port.peek(); };
+
+	uint32_t getDroppedWrites() { return droppedWrites; };
+	uint32_t getDroppedBytes() { return droppedBytes; };
+	int getMaxUsed() { return maxUsed; };		// high-water mark of the buffer [bytes]
+
+	void resetStatistics();
+	void printStatistics();
+private:
+	int used() { return (head - tail) & (TxBufferSize-1); };
+
+	// copy into the ring buffer, the caller checked the space and holds the lock
+	void enqueue(const uint8_t *buffer, size_t size);
+
+	// true if write() has been called by an interrupt
+	bool inInterrupt();
+
+	Stream& port;
+	Policy policy = BLOCK_ON_FULL;
+	uint8_t txBuffer[TxBufferSize];
+	volatile uint16_t head = 0;			// next byte to be written
+	volatile uint16_t tail = 0;			// next byte to be sent
+	volatile bool sending = false;		// loop() is moving bytes to the UART
+	uint32_t droppedWrites = 0;
+	uint32_t droppedBytes = 0;
+	int maxUsed = 0;
+};
+
+extern BufferedSerial bufferedSerial;
+
+#endif /* BUFFEREDSERIAL_H_ */
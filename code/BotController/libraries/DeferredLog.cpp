@@ -0,0 +1,67 @@
+/*
+ * DeferredLog.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <libraries/DeferredLog.h>
+
+DeferredLog deferredLog;
+
+int DeferredLog::flush(int maxEntries) {
+	int n = 0;
+	while ((tail != head) && (n < maxEntries)) {
+		uint8_t t = tail;
+		print(buffer[t]);
+		tail = (t + 1) & (BufferSize-1);
+		n++;
+	}
+	return n;
+}
+
+void DeferredLog::print(const Entry& e) {
+	const char* c = e.format;
+	int arg = 0;
+	while (*c) {
+		if (*c == '\n') {
+			loggingln();
+			c++;
+		} else if (*c == '{') {
+			// parse {} or {b.a}
+			c++;
+			uint8_t digitsBefore = 0;
+			uint8_t digitsAfter = 2;
+			bool withDigits = false;
+			if (*c != '}') {
+				withDigits = true;
+				digitsBefore = 0;
+				while ((*c >= '0') && (*c <= '9'))
+					digitsBefore = digitsBefore*10 + (*c++ - '0');
+				if (*c == '.') {
+					c++;
+					digitsAfter = 0;
+					while ((*c >= '0') && (*c <= '9'))
+						digitsAfter = digitsAfter*10 + (*c++ - '0');
+				}
+			}
+			if (*c == '}')
+				c++;
+
+			float x = (arg < e.numberOfArgs)?e.args[arg]:0.0;
+			arg++;
+			if (withDigits)
+				logging(x, digitsBefore, digitsAfter);
+			else
+				logging(x, digitsAfter);
+		} else {
+			// print the text up to the next placeholder or newline in one go
+			const char* start = c;
+			while (*c && (*c != '{') && (*c != '\n'))
+				c++;
+			logger->write((const uint8_t*)start, c-start);
+		}
+	}
+}
@@ -0,0 +1,84 @@
+/*
+ * DeferredLog.h
+ *
+ * Logging that takes the formatting of floats out of the time critical path. A call
+ * just stores the pointer to the format string and the raw arguments in a ring buffer,
+ * formatting and output happens later in flush(), which is called by a low priority task.
+ * The ring buffer is lock-free with a single producer and a single consumer. If it is full,
+ * the entry is dropped and counted.
+ *
+ * The format string has to be a string literal, since only its pointer is stored. Placeholders:
+ * 		{}		float with 2 digits after the comma (like print(float))
+ * 		{b.a}	float with b digits before and a digits after the comma (like logging(x,b,a))
+ * 		\n		new line
+ *
+ * use:
+ * 		deferredLog.log("imu=({2.3},{2.3})\n", angle, angularVelocity);	// in the control loop
+ * 		deferredLog.flush();												// in the idle task
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef DEFERREDLOG_H_
+#define DEFERREDLOG_H_
+
+#include <Arduino.h>
+
+class DeferredLog {
+public:
+	static const int MaxArguments = 8;
+	static const int BufferSize = 64;		// number of entries, power of 2
+
+	DeferredLog() {};
+	virtual ~DeferredLog() {};
+
+	// enqueue a log entry, arguments are converted to float
+	template<typename... Args>
+	void log(const char* format, Args... args) {
+		static_assert(sizeof...(Args) <= MaxArguments, "too many arguments for deferred log");
+		uint8_t h = head;
+		uint8_t nextHead = (h + 1) & (BufferSize-1);
+		if (nextHead == tail) {
+			dropped++;
+			return;
+		}
+		Entry& e = buffer[h];
+		e.format = format;
+		e.numberOfArgs = sizeof...(Args);
+		store(e.args, args...);
+		__asm__ volatile("" ::: "memory");	// entry needs to be complete before the consumer sees it
+		head = nextHead;
+	}
+
+	// format and print at most maxEntries entries, returns the number of printed entries
+	int flush(int maxEntries = BufferSize);
+
+	// number of entries that did not fit into the buffer
+	uint32_t getDropped() { return dropped; };
+
+private:
+	struct Entry {
+		const char* format;
+		uint8_t numberOfArgs;
+		float args[MaxArguments];
+	};
+
+	static void store(float* dst) {};
+	template<typename T, typename... Rest>
+	static void store(float* dst, T first, Rest... rest) {
+		*dst = (float)first;
+		store(dst+1, rest...);
+	}
+
+	void print(const Entry& e);
+
+	Entry buffer[BufferSize];
+	volatile uint8_t head = 0;		// next entry to be written, changed by producer only
+	volatile uint8_t tail = 0;		// next entry to be printed, changed by consumer only
+	uint32_t dropped = 0;
+};
+
+extern DeferredLog deferredLog;
+
+#endif /* DEFERREDLOG_H_ */
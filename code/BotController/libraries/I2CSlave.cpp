@@ -19,25 +19,33 @@ void I2CSlave::setup() {
 		webServerComm->onReceive([](unsigned int howMany){ i2cSlave->webServerCommReceiveEvent(howMany);});
 
 		requestBytes = 0;
+		receivedLength = 0;
+		receivedCommand[0] = 0;
 }
 
 void I2CSlave::loop() {
-	if (reveiveEvent.length() != 0) {
+	if (receivedLength != 0) {
+		// take the command out of the buffer the interrupt writes into
+		char cmd[MaxCommandLength+1];
+		noInterrupts();
+		int adr = receiveAdr;
+		memcpy(cmd, receivedCommand, receivedLength+1);
+		receivedLength = 0;
+		interrupts();
+
 		logger->print("execute (");
-		logger->print(receiveAdr);
+		logger->print(adr);
 		logger->print(")=[");
-		logger->print(reveiveEvent);
+		logger->print(cmd);
 		logger->println("]");
 
-		reveiveEvent = "";
-
-		switch (receiveAdr) {
+		switch (adr) {
 			case BotCtrlCmd_SerialCommand:
 
 				break;
 			default:
 				logger->print("invalid i2c register");
-				logger->println(receiveAdr);
+				logger->println(adr);
 		}
 	}
 }
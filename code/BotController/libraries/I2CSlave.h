@@ -27,21 +27,27 @@ public:
 		logger->println();
 	}
 
+	// called within the interrupt, so the command goes into a buffer of fixed size,
+	// longer commands are truncated
 	void webServerCommReceiveEvent(unsigned int numBytes) {
 		requestBytes = numBytes;
-		reveiveEvent = "";
+		receivedLength = 0;
 		// first byte is register
 		receiveAdr = webServerComm->read();
 
-
 		while (0 < webServerComm->available()) { // loop through all
 			char c = webServerComm->read(); // receive byte as a character
-			reveiveEvent += c;
+			if (receivedLength < MaxCommandLength)
+				receivedCommand[receivedLength++] = c;
 		}
+		if ((int)numBytes > receivedLength + 1)
+			truncatedCommands++;
+		receivedCommand[receivedLength] = 0;
 		if (receiveAdr == -1) {
 			// empty transaction
 			receiveAdr = 0;
-			reveiveEvent = "";
+			receivedLength = 0;
+			receivedCommand[0] = 0;
 		}
 		{
 			logger->print("i2cRec(");
@@ -49,19 +55,23 @@ public:
 			logger->print(",");
 			logger->print(receiveAdr);
 			logger->print("):[");
-			logger->print(reveiveEvent);
+			logger->print(receivedCommand);
 			logger->println("]");
 		}
 	}
 
 	void setup();
 	void loop();
+
+	uint32_t getTruncatedCommands() { return truncatedCommands; };
+	static const int MaxCommandLength = 64;
 private:
 	i2c_t3* webServerComm = NULL;
 	int requestBytes = 0;
-	int receiveAdr = 0;
-	String reveiveEvent;
-
+	volatile int receiveAdr = 0;
+	char receivedCommand[MaxCommandLength+1];
+	volatile int receivedLength = 0;
+	uint32_t truncatedCommands = 0;
 };
 
 extern I2CSlave* i2cSlave;
@@ -14,7 +14,8 @@
 void* magicMemoryNumberAddress = (void*)0;  	// my birthday is stored at this address
 void* memoryAddress = (void*)sizeof(int16_t);	// address of user-defined EEPROM area
 
-MemoryBase::MemoryBase (void *pMem_RAM, size_t pLen) {
+MemoryBase::MemoryBase (void *pMem_RAM, size_t pLen, uint16_t pLayoutVersion) {
+	layoutVersion = pLayoutVersion;
 	somethingToSave = false;
 	memRAM = pMem_RAM;
 	len = pLen;
@@ -75,9 +76,9 @@ int MemoryBase::EEPROMVersion() {
 }
 
 boolean MemoryBase::isEEPROMInitialized() {
-	return (eeprom_read_word((const uint16_t *)magicMemoryNumberAddress) == EEMEM_MAGICNUMBER);
+	return (eeprom_read_word((const uint16_t *)magicMemoryNumberAddress) == EEMEM_MAGICNUMBER + layoutVersion);
 }		
 
 void  MemoryBase::markEEPROMInitialized() {
-	eeprom_write_word((uint16_t *)magicMemoryNumberAddress, EEMEM_MAGICNUMBER);
+	eeprom_write_word((uint16_t *)magicMemoryNumberAddress, EEMEM_MAGICNUMBER + layoutVersion);
 }
@@ -32,8 +32,10 @@
 
 class MemoryBase {
 	protected:
-		// initialize by passing the persistent block of derived class
-		MemoryBase (void *pMem_RAM, size_t pMemSize);
+		// initialize by passing the persistent block of derived class. The layout version
+		// needs to be increased whenever the layout of the block changes, the EEPROM is
+		// initialized with the default values then instead of reading garbage.
+		MemoryBase (void *pMem_RAM, size_t pMemSize, uint16_t layoutVersion = 0);
 	public:
 		// initializes and reads the persistent memory from eeprom.
 		// returns true, if this is the first call 
@@ -63,7 +65,8 @@ class MemoryBase {
 		boolean somethingToSave;
 		boolean saveJustHappened;
 		void* memRAM;
-		uint8_t len;
+		uint16_t len;
+		uint16_t layoutVersion;
 };
 
 #endif /* MEMORY_H_ */
@@ -19,7 +19,7 @@ public:
 		Kd = 0;
 	};
 
-	virtual ~PIDControllerConfig() {};
+	// no virtual destructor, this is part of the persistent memory and needs to be plain data
 	PIDControllerConfig (float Kp, float Ki, float Kd) {
 		set(Kp,Ki,Kd);
 	}
@@ -0,0 +1,116 @@
+/*
+ * TaskScheduler.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <libraries/Util.h>
+#include <libraries/TaskScheduler.h>
+
+void Task::reset() {
+	executions = 0;
+	overruns = 0;
+	deadlineMisses = 0;
+	maxDuration_us = 0;
+	lastDuration_us = 0;
+}
+
+void Task::print() {
+	logging("   ");
+	logging(name);
+	logging(" T=");
+	logging((int)period_us);
+	logging("us prio=");
+	logging((int)priority);
+	logging(" n=");
+	logging((int)executions);
+	logging(" max=");
+	logging((int)maxDuration_us);
+	logging("/");
+	logging((int)budget_us);
+	logging("us overruns=");
+	logging((int)overruns);
+	logging(" missed=");
+	loggingln((int)deadlineMisses);
+}
+
+void TaskScheduler::setup(ClockFunction clock) {
+	this->clock = clock;
+	numberOfTasks = 0;
+	busy_us = 0;
+}
+
+int TaskScheduler::addTask(const char* name, uint32_t period_us, uint8_t priority, uint32_t budget_us, TaskFunction function) {
+	if (numberOfTasks >= MaxNumberOfTasks) {
+		fatalError("too many tasks");
+		return -1;
+	}
+	int id = numberOfTasks++;
+	Task& task = tasks[id];
+	task.name = name;
+	task.function = function;
+	task.period_us = period_us;
+	task.priority = priority;
+	task.budget_us = budget_us;
+	task.nextDue_us = clock();
+	task.reset();
+
+	// insert id into the list sorted by priority, tasks with same priority are executed in sequence of registration
+	int pos = id;
+	while ((pos > 0) && (tasks[taskOrder[pos-1]].priority > priority)) {
+		taskOrder[pos] = taskOrder[pos-1];
+		pos--;
+	}
+	taskOrder[pos] = id;
+
+	return id;
+}
+
+bool TaskScheduler::loop() {
+	uint64_t now_us = clock();
+	for (int i = 0;i<numberOfTasks;i++) {
+		Task& task = tasks[taskOrder[i]];
+
+		// the clock has 64 bits and does not wrap
+		if (now_us >= task.nextDue_us) {
+			// keep the phase of the task unless we missed a complete period,
+			// then restart from now and do not try to catch up
+			if (now_us - task.nextDue_us >= task.period_us) {
+				if (task.executions > 0)
+					task.deadlineMisses++;
+				task.nextDue_us = now_us + task.period_us;
+			} else
+				task.nextDue_us += task.period_us;
+
+			task.function(now_us);
+
+			uint32_t duration_us = (uint32_t)(clock() - now_us);
+			busy_us += duration_us;
+			task.executions++;
+			task.lastDuration_us = duration_us;
+			if (duration_us > task.maxDuration_us)
+				task.maxDuration_us = duration_us;
+			if (duration_us > task.budget_us)
+				task.overruns++;
+			return true;
+		}
+	}
+	return false;
+}
+
+void TaskScheduler::setPeriod(int taskId, uint32_t period_us) {
+	tasks[taskId].period_us = period_us;
+}
+
+void TaskScheduler::resetStatistics() {
+	for (int i = 0;i<numberOfTasks;i++)
+		tasks[i].reset();
+}
+
+void TaskScheduler::print() {
+	loggingln("tasks:");
+	for (int i = 0;i<numberOfTasks;i++)
+		tasks[taskOrder[i]].print();
+}
@@ -0,0 +1,92 @@
+/*
+ * TaskScheduler.h
+ *
+ * Time triggered scheduler that replaces the free running main loop.
+ * Each task is registered with a period, a priority and a budget. Every call of loop()
+ * executes the most important task that is due, so a low priority task is never started
+ * while a more important one is waiting. Per task, the number of budget overruns and
+ * missed deadlines is counted.
+ *
+ * use:
+ *     TaskScheduler scheduler;
+ *     scheduler.setup();													// uses MicroClock as clock
+ *     scheduler.addTask("motor", 1000 [us], 1 [prio], 300 [us], [](uint64_t now_us) { ... });
+ *     while (true) {
+ *         scheduler.loop();
+ *     }
+ *
+ * The clock is sampled once per loop() and passed to the task, so the task should use
+ * that time instead of reading the clock again.
+ * The clock can be replaced in setup() to drive the scheduler with a fake clock.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef TASKSCHEDULER_H_
+#define TASKSCHEDULER_H_
+
+#include <Arduino.h>
+#include <MicroClock.h>
+
+typedef void (*TaskFunction)(uint64_t now_us);
+typedef uint64_t (*ClockFunction)();
+
+class Task {
+public:
+	void reset();
+	void print();
+
+	const char* name = NULL;
+	TaskFunction function = NULL;
+	uint32_t period_us = 0;			// [us] the task is due every period_us
+	uint8_t priority = 0;			// 0 is the most important priority
+	uint32_t budget_us = 0;			// [us] execution time the task is supposed to stay within
+	uint64_t nextDue_us = 0;		// [us] next point in time the task is due
+
+	// statistics
+	uint32_t executions = 0;		// number of invocations
+	uint32_t overruns = 0;			// number of invocations that took longer than budget_us
+	uint32_t deadlineMisses = 0;	// number of invocations that started more than one period too late
+	uint32_t maxDuration_us = 0;	// [us] longest execution time
+	uint32_t lastDuration_us = 0;	// [us] execution time of the last invocation
+};
+
+class TaskScheduler {
+public:
+	static const int MaxNumberOfTasks = 10;
+
+	TaskScheduler() {};
+	virtual ~TaskScheduler() {};
+
+	// initialize the scheduler with the clock that returns the current time in [us]
+	void setup(ClockFunction clock = MicroClock::now_us);
+
+	// register a new task, returns the id of the task to be used in getTask/setPeriod
+	int addTask(const char* name, uint32_t period_us, uint8_t priority, uint32_t budget_us, TaskFunction function);
+
+	// to be called as often as possible. Executes the most important due task.
+	// Returns true, if a task has been executed
+	bool loop();
+
+	// change the period of a task, takes effect after its next execution
+	void setPeriod(int taskId, uint32_t period_us);
+
+	Task& getTask(int taskId) { return tasks[taskId]; };
+	int getNumberOfTasks() { return numberOfTasks; };
+
+	// accumulated execution time of all tasks since setup [us], the rest is idle time
+	uint64_t getBusyTime() { return busy_us; };
+
+	void resetStatistics();
+	void print();
+
+private:
+	Task tasks[MaxNumberOfTasks];			// in the sequence of registration, index is the id of a task
+	int taskOrder[MaxNumberOfTasks];		// task ids sorted by priority
+	int numberOfTasks = 0;
+	uint64_t busy_us = 0;
+	ClockFunction clock = NULL;
+};
+
+#endif /* TASKSCHEDULER_H_ */
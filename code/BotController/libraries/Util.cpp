@@ -8,10 +8,19 @@
 #include "Arduino.h"
 #include <libraries/Util.h>
 
+static FatalErrorHook fatalErrorHook = NULL;
+
+void setFatalErrorHook(FatalErrorHook hook) {
+	fatalErrorHook = hook;
+}
+
 void fatalError(const char s[]) {
+	if (fatalErrorHook)
+		fatalErrorHook(s);
 	if (logger) {
 		logger->print("FATAL:");
 		logger->println(s);
+		logger->flush();
 	}
 	delay(100); // wait until serial sent that before crashing
 }
@@ -14,6 +14,10 @@
 void fatalError(const char s[]);
 void warnMsg(const char s[]);
 
+// function that is called by fatalError, e.g. to freeze the flight recorder
+typedef void (*FatalErrorHook)(const char s[]);
+void setFatalErrorHook(FatalErrorHook hook);
+
 template <typename T> int sgn(T val) {
     return (T(0) < val) - (val < T(0));
 }
@@ -34,7 +38,7 @@ void loggingln(String s);
 void logging(int s);
 void loggingln(int s);
 
-extern HardwareSerial* logger;
-extern HardwareSerial* command;
+extern Stream* logger;
+extern Stream* command;
 
 #endif /* UTIL_H_ */
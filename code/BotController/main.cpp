@@ -10,13 +10,15 @@
 #include <BotMemory.h>
 
 #include <common.h>
+#include <libraries/BufferedSerial.h>
 
 static uint8_t DefaultPattern[3] = { 0b11001000, 0b00001100, 0b10000000 };	// nice!
 
 PatternBlinker ledBlinker(LED_PIN, 50 /* ms */); // one bit in the patterns above is active for 100ms
 
-HardwareSerial* logger = &Serial5;			// UART used to log
-HardwareSerial* command = &Serial5;			// UART used to log
+BufferedSerial bufferedSerial(Serial5);		// output to UART does not block, but goes into a buffer
+Stream* logger = &bufferedSerial;			// UART used to log
+Stream* command = &bufferedSerial;			// UART used to log
 
 BotController& botController = BotController::getInstance();
 
@@ -28,7 +30,10 @@ I2CSlave* i2cSlave = new I2CSlave(&Wire1);
 void setup()
 {
 	// command input comes via UART or I2C from ESP86266
-	command->begin(230400);
+	// wait if the buffer is full, so the complete output arrives. Only while balancing, output
+	// is dropped instead of blocking the loop (see BotController::balanceMode)
+	Serial5.begin(230400);
+	bufferedSerial.setPolicy(BufferedSerial::BLOCK_ON_FULL);
 	uint32_t now = millis();
 	// let the LED blink two times to indicate that setup is starting now
 	digitalWrite(LED_PIN,LOW);
@@ -63,7 +68,6 @@ void loop()
 {
 	uint32_t now = millis();
 	ledBlinker.loop(now);    	// LED on Teensy board and LED on power switch
-	botController.loop();		// do the balancing business
+	botController.loop();		// do the balancing business, runs the motors, the menu and the eeprom
 	i2cSlave->loop();			// execute commands from webserver that came in via I2C
-	memory.loop(now);
 }
@@ -16,6 +16,8 @@ const float WheelRadius = 0.035;									// [m]
 const float BallRadius = 0.090;										// [m]
 const float WheelAngleRad= radians(45.0);							// [rad] 	mounting angle of wheels against horizontal base platform
 const float CentreOfGravityHeight = 0.200; 							// [m] 		center of gravity height from ground
+const float BodyWeight = 1.2;										// [kg] 	everything but the ball
+const float BodyInertia = 0.009;									// [kg m^2] of the body around its centre of gravity
 const float MaxBotSpeed = 1.8; 										// [m/s] 	max speed of bot
 const float MaxBotOmega= 6.0; 										// [rad/s] 	max vertical turn speed of bot
 const float MaxBotOmegaAccel= 0.1; 									// [rad/s^2] max omega aceleration of bot
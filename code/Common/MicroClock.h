@@ -0,0 +1,66 @@
+/*
+ * MicroClock.h
+ *
+ * Monotonic time base in [us] with 64 bit, so it does not wrap like micros() after 71 minutes.
+ * The clock is meant to be sampled once per tick, the time is passed down to all modules
+ * that compute a dT, so they all see the same point in time.
+ *
+ * use:
+ *     uint64_t now_us = MicroClock::now_us();				// sample once per tick
+ *     float dT = MicroClock::seconds(now_us - lastCall_us);	// [s]
+ *
+ * On the host, the source can be replaced with a fake clock to test the timing:
+ *     MicroClock::setSource([]() -> uint32_t { return fakeTime_us; });
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef MICROCLOCK_H_
+#define MICROCLOCK_H_
+
+#include <Arduino.h>
+
+typedef uint32_t (*MicrosSource)();
+
+class MicroClock {
+public:
+	// return the time since start in [us]. The wrap of the 32 bit source is detected by comparing with the
+	// last call, so this needs to be called at least once every 71 minutes (which the main loop does)
+	// Not to be called from an interrupt.
+	static uint64_t now_us() {
+		State& s = state();
+		uint32_t now = s.source();
+		if (now < s.lastLow)
+			s.high++;
+		s.lastLow = now;
+		return (((uint64_t)s.high) << 32) | now;
+	}
+
+	// replace the source of the clock (default is micros()), and start over
+	static void setSource(MicrosSource source) {
+		State& s = state();
+		s.source = source;
+		s.high = 0;
+		s.lastLow = 0;
+	}
+
+	// convert a duration in [us] to [s]
+	static float seconds(uint64_t duration_us) {
+		return ((float)duration_us)/1000000.0;
+	}
+
+private:
+	struct State {
+		MicrosSource source = micros;
+		uint32_t high = 0;				// number of wraps of the source
+		uint32_t lastLow = 0;			// value of the source at the last call
+	};
+
+	static State& state() {
+		static State s;
+		return s;
+	}
+};
+
+#endif /* MICROCLOCK_H_ */
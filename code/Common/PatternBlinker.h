@@ -67,7 +67,7 @@ class PatternBlinker {
 	}
 
 	void loop(uint32_t now) {
-		uint16_t passed_ms;
+		uint32_t passed_ms;
 		if ((timer.isDue_ms(mDuration,passed_ms, now))) {
 			if (mPattern != NULL) {
 				uint8_t pos,bitpos;
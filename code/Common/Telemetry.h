@@ -0,0 +1,169 @@
+/*
+ * Telemetry.h
+ *
+ * Binary telemetry record that is sent by the bot controller with every balancing tick,
+ * and the framing used on the serial line. Shared by the firmware and the host decoder.
+ *
+ * A frame is the record followed by its CRC16 (CCITT, little endian), encoded with COBS,
+ * so the frame contains no 0 bytes, and delimited by a 0 byte before and after. Text output on
+ * the same line ends up in frames with a wrong CRC and is skipped by the decoder.
+ * Values are fixed point int16, i.e. the float is multiplied with the scale below. Every record
+ * carries a sequence number, so the decoder can count dropped frames.
+ *
+ * The version needs to be increased whenever the layout of TelemetryRecord changes.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+const uint8_t TelemetryVersion = 1;
+
+// fixed point scales, i.e. the int16 value is the float multiplied by the scale
+const float TelemetryAngleScale 			= 10000.0;	// [rad] 	-> [0.1 mrad]
+const float TelemetryAngularVelocityScale 	= 1000.0;	// [rad/s] 	-> [mrad/s]
+const float TelemetryPosScale 				= 1000.0;	// [m] 		-> [mm]
+const float TelemetrySpeedScale 			= 1000.0;	// [m/s] 	-> [mm/s]
+const float TelemetryAccelScale 			= 1000.0;	// [m/s^2] 	-> [mm/s^2]
+const float TelemetryOmegaScale 			= 1000.0;	// [rad/s] 	-> [mrad/s]
+const float TelemetryWheelSpeedScale 		= 100.0;	// [rev/s] 	-> [rev/100s]
+
+struct TelemetryPlane {
+	int16_t angle;				// tilt angle of IMU
+	int16_t angularVelocity;	// angular velocity of IMU
+	int16_t ballPos;			// current position of the ball
+	int16_t ballSpeed;			// current speed of the ball
+	int16_t ballAccel;			// current acceleration of the ball
+	int16_t outputAccel;		// acceleration computed by the controller
+	int16_t outputSpeed;		// speed set by the controller (filtered)
+} __attribute__((packed));
+
+struct TelemetryRecord {
+	uint8_t version;
+	uint16_t sequence;			// increased with every record, wraps around
+	uint32_t time_us;			// time of the IMU sample
+	TelemetryPlane plane[2];	// x and y
+	int16_t omega;				// angular velocity around z set by the controller
+	int16_t wheelSpeed[3];		// setpoint of all wheels
+} __attribute__((packed));
+
+// worst case size of a frame, COBS adds one byte per 254 bytes plus one, plus two delimiters
+const size_t TelemetryMaxFrameSize = sizeof(TelemetryRecord) + 2 + (sizeof(TelemetryRecord) + 2)/254 + 1 + 2;
+
+// convert to fixed point and saturate instead of overflowing
+inline int16_t telemetryFixed(float x, float scale) {
+	float v = x*scale;
+	if (v > 32767.0f)
+		return 32767;
+	if (v < -32768.0f)
+		return -32768;
+	return (int16_t)v;
+}
+
+// CRC16 CCITT, polynomial 0x1021, initial value 0xFFFF. Computed per nibble with a small table
+inline uint16_t telemetryCRC16(const uint8_t* data, size_t len) {
+	static const uint16_t table[16] = {
+		0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+		0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF };
+	uint16_t crc = 0xFFFF;
+	for (size_t i = 0;i<len;i++) {
+		crc = (crc << 4) ^ table[(crc >> 12) ^ (data[i] >> 4)];
+		crc = (crc << 4) ^ table[(crc >> 12) ^ (data[i] & 0x0F)];
+	}
+	return crc;
+}
+
+// COBS encoding of len bytes from src into dst, returns the number of bytes written (without delimiter).
+// dst needs to have space for len + len/254 + 1 bytes
+inline size_t cobsEncode(const uint8_t* src, size_t len, uint8_t* dst) {
+	size_t codePos = 0;			// position of the current code byte
+	size_t out = 1;
+	uint8_t code = 1;
+	for (size_t i = 0;i<len;i++) {
+		if (src[i] == 0) {
+			dst[codePos] = code;
+			codePos = out++;
+			code = 1;
+		} else {
+			dst[out++] = src[i];
+			code++;
+			if (code == 0xFF) {
+				dst[codePos] = code;
+				codePos = out++;
+				code = 1;
+			}
+		}
+	}
+	dst[codePos] = code;
+	return out;
+}
+
+// COBS decoding of len bytes (without delimiter) from src into dst.
+// Returns the number of decoded bytes, or 0 if the input is not valid COBS
+inline size_t cobsDecode(const uint8_t* src, size_t len, uint8_t* dst) {
+	size_t in = 0;
+	size_t out = 0;
+	while (in < len) {
+		uint8_t code = src[in++];
+		if (code == 0)
+			return 0;
+		for (uint8_t i = 1;i<code;i++) {
+			if ((in >= len) || (src[in] == 0))
+				return 0;
+			dst[out++] = src[in++];
+		}
+		// a code of 0xFF is not followed by a 0
+		if ((code != 0xFF) && (in < len))
+			dst[out++] = 0;
+	}
+	return out;
+}
+
+// worst case size of a frame of a record, like TelemetryMaxFrameSize
+template<typename Record> constexpr size_t telemetryFrameSize() {
+	return sizeof(Record) + 2 + (sizeof(Record) + 2)/254 + 1 + 2;
+}
+
+// create a complete frame out of a record, returns the length of the frame.
+// Used for TelemetryRecord and for other packed records sent on the same line (SensorRecording.h)
+template<typename Record>
+inline size_t telemetryEncodeFrame(const Record& record, uint8_t* frame /* telemetryFrameSize<Record>() */) {
+	uint8_t raw[sizeof(Record) + 2];
+	const uint8_t* r = (const uint8_t*)&record;
+	for (size_t i = 0;i<sizeof(Record);i++)
+		raw[i] = r[i];
+	uint16_t crc = telemetryCRC16(raw, sizeof(Record));
+	raw[sizeof(Record)] = crc & 0xFF;
+	raw[sizeof(Record)+1] = crc >> 8;
+
+	frame[0] = 0;
+	size_t len = cobsEncode(raw, sizeof(raw), frame+1);
+	frame[len+1] = 0;
+	return len + 2;
+}
+
+// decode the content between two delimiters into a record.
+// Returns false if the frame has the wrong size or CRC
+template<typename Record>
+inline bool telemetryDecodeFrame(const uint8_t* encoded, size_t len, Record& record) {
+	uint8_t raw[sizeof(Record) + 2 + 2];
+	if (len > sizeof(raw))
+		return false;
+	size_t n = cobsDecode(encoded, len, raw);
+	if (n != sizeof(Record) + 2)
+		return false;
+	uint16_t crc = telemetryCRC16(raw, sizeof(Record));
+	if ((raw[sizeof(Record)] != (crc & 0xFF)) || (raw[sizeof(Record)+1] != (crc >> 8)))
+		return false;
+	uint8_t* r = (uint8_t*)&record;
+	for (size_t i = 0;i<sizeof(Record);i++)
+		r[i] = raw[i];
+	return true;
+}
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,186 @@
+/*
+ * microbench.cpp
+ *
+ * Microbenchmarks of the kernels of the control path, compiled natively from the production
+ * sources (Google Benchmark). Each benchmark cycles through a small table of inputs, so the
+ * compiler cannot fold the computation, and branches are exercised like in a balancing run.
+ * The results are machine readable, so they can be tracked over time:
+ *
+ * use:
+ *     microbench --benchmark_out=microbench.json --benchmark_out_format=json
+ *     microbench --benchmark_filter=Kalman --benchmark_repetitions=10
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <benchmark/benchmark.h>
+#include <Arduino.h>
+#include <setup.h>
+#include <types.h>
+#include <Kinematics.h>
+#include <StateController.h>
+#include <SpeedProfile.h>
+#include <SVPWM.h>
+#include <Filter/KalmanFilter.h>
+#include <Filter/FIRFilter.h>
+#include <Filter/IIRFilter.h>
+#include <BotMemory.h>
+#include <HostConsole.h>
+
+// inputs of the benchmarks, a slowly varying signal plus some jitter like a sensor delivers
+const int NumberOfInputs = 256;			// power of 2
+static float input[NumberOfInputs];
+
+static void setupInputs() {
+	for (int i = 0;i<NumberOfInputs;i++)
+		input[i] = sin(i*TWO_PI/NumberOfInputs) + 0.1*sin(i*17.0);
+}
+
+static inline float nextInput(int& i) {
+	i = (i + 1) & (NumberOfInputs-1);
+	return input[i];
+}
+
+static void BM_KinematixComputeWheelSpeed(benchmark::State& state) {
+	Kinematix kinematics;
+	kinematics.setup();
+	int i = 0;
+	float wheelSpeed[3];
+	for (auto _ : state) {
+		float x = nextInput(i);
+		kinematics.computeWheelSpeed(0.2*x, -0.1*x, 0.5*x, radians(2.0)*x, radians(-1.0)*x, wheelSpeed);
+		benchmark::DoNotOptimize(wheelSpeed);
+	}
+}
+BENCHMARK(BM_KinematixComputeWheelSpeed);
+
+static void BM_KinematixComputeActualSpeed(benchmark::State& state) {
+	Kinematix kinematics;
+	kinematics.setup();
+	int i = 0;
+	float vx, vy, omega;
+	for (auto _ : state) {
+		float x = nextInput(i);
+		float wheelSpeed[3] = { 0.5f*x, -0.3f*x, 0.2f*x };
+		kinematics.computeActualSpeed(wheelSpeed, radians(2.0)*x, radians(-1.0)*x, vx, vy, omega);
+		benchmark::DoNotOptimize(vx);
+		benchmark::DoNotOptimize(vy);
+		benchmark::DoNotOptimize(omega);
+	}
+}
+BENCHMARK(BM_KinematixComputeActualSpeed);
+
+static void BM_KalmanFilterUpdate(benchmark::State& state) {
+	KalmanFilter kalman;
+	kalman.setup(0);
+	int i = 0;
+	for (auto _ : state) {
+		float x = nextInput(i);
+		kalman.update(radians(2.0)*x, radians(10.0)*x, SamplingTime);
+		benchmark::DoNotOptimize(kalman.getAngle());
+	}
+}
+BENCHMARK(BM_KalmanFilterUpdate);
+
+// same filters as ControlPlane::reset
+static void BM_FIRFilterUpdate(benchmark::State& state) {
+	FIR::Filter filter;
+	filter.init(FIR::LOWPASS, 1.0e-3f, 1.0e-4f, SampleFrequency, state.range(0));
+	int i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(filter.update(nextInput(i)));
+	state.counters["taps"] = filter.get_no_of_taps();
+}
+BENCHMARK(BM_FIRFilterUpdate)->Arg(5)->Arg(15);
+
+static void BM_IIRFilterUpdate(benchmark::State& state) {
+	IIR::Filter filter;
+	filter.init(15.0, SamplingTime, (IIR::ORDER)state.range(0));
+	int i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(filter.update(nextInput(i)));
+}
+BENCHMARK(BM_IIRFilterUpdate)->Arg((int)IIR::ORDER::OD1)->Arg((int)IIR::ORDER::OD2)->Arg((int)IIR::ORDER::OD4);
+
+static void BM_ControlPlaneUpdate(benchmark::State& state) {
+	StateControllerConfig config;
+	config.initDefaultValues();
+	ControlPlane plane;
+	plane.mode = (ControlMode)state.range(0);
+	plane.estimation = (StateEstimation)state.range(1);
+	plane.reset();
+	State target;
+	int i = 0;
+	for (auto _ : state) {
+		float x = nextInput(i);
+		State current(0.01*x, 0.05*x, 0.1*x);
+		IMUSamplePlane sensor;
+		sensor.angle = radians(1.0)*x;
+		sensor.angularVelocity = radians(5.0)*x;
+		plane.update(false, SamplingTime, config, current, target, 0, 0, sensor);
+		benchmark::DoNotOptimize(plane.filteredSpeed);
+	}
+}
+BENCHMARK(BM_ControlPlaneUpdate)
+	->Args({CONTROL_WEIGHTS, ESTIMATE_DIFFERENCES})->Args({CONTROL_LQR, ESTIMATE_DIFFERENCES})->Args({CONTROL_MPC, ESTIMATE_DIFFERENCES})
+	->Args({CONTROL_WEIGHTS, ESTIMATE_OBSERVER})->Args({CONTROL_LQR, ESTIMATE_OBSERVER})->Args({CONTROL_MPC, ESTIMATE_OBSERVER});
+
+static void BM_GetPWMValue(benchmark::State& state) {
+	precomputeSVPMWave();
+	int i = 0;
+	for (auto _ : state) {
+		float x = nextInput(i);
+		benchmark::DoNotOptimize(getPWMValue(0.8, 10.0*x));
+	}
+}
+BENCHMARK(BM_GetPWMValue);
+
+static void BM_Sigmoid(benchmark::State& state) {
+	int i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(sigmoid(40.0, nextInput(i)));
+}
+BENCHMARK(BM_Sigmoid);
+
+static void BM_SpeedProfileApply(benchmark::State& state) {
+	SpeedProfile profile;
+	float startSpeed = 0.1;
+	float endSpeed = 0.3;
+	float duration = 1000;
+	profile.computeSpeedProfile(startSpeed, endSpeed, 200.0, duration);
+	int i = 0;
+	for (auto _ : state) {
+		float t = 0.5 + 0.45*nextInput(i);
+		benchmark::DoNotOptimize(profile.apply(SpeedProfile::TRAPEZOIDAL, t));
+	}
+}
+BENCHMARK(BM_SpeedProfileApply);
+
+static void BM_BotMovementRampUp(benchmark::State& state) {
+	BotMovement current;
+	int i = 0;
+	for (auto _ : state) {
+		float x = nextInput(i);
+		BotMovement target(State(0, 0.3*x, 0), State(0, -0.2*x, 0), 0.5*x);
+		current.rampUp(target, SamplingTime);
+		benchmark::DoNotOptimize(current);
+	}
+}
+BENCHMARK(BM_BotMovementRampUp);
+
+int main(int argc, char** argv) {
+	setupInputs();
+
+	// the control code must not log into the results
+	memory.setup();
+	memory.persistentMem.logConfig.null();
+	hostConsole.enable(false);
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,40 @@
+/*
+ * GeneratedHeader.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <GeneratedHeader.h>
+
+FILE* openHeader(const char* name, const char* tool, const char* title, const char* content, int argc, char* argv[]) {
+	FILE* out = fopen(name, "w");
+	if (out == NULL) {
+		perror(name);
+		return NULL;
+	}
+	fprintf(out, "/*\n");
+	fprintf(out, " * %s\n", title);
+	fprintf(out, " *\n");
+	fprintf(out, " * %s, generated by Host/tools/%s out of\n", content, tool);
+	fprintf(out, " * the linearised model with the constants of setup.h. Do not edit, run %s instead:\n", tool);
+	fprintf(out, " *     %s", tool);
+	for (int i = 1;i<argc;i++)
+		fprintf(out, " %s", argv[i]);
+	fprintf(out, "\n");
+	return out;
+}
+
+void beginHeader(FILE* out, const char* guard) {
+	fprintf(out, " *\n");
+	fprintf(out, " *  Created on: 16.10.2026\n");
+	fprintf(out, " *      Author: JochenAlt\n");
+	fprintf(out, " */\n\n");
+	fprintf(out, "#ifndef %s\n", guard);
+	fprintf(out, "#define %s\n\n", guard);
+}
+
+void closeHeader(FILE* out, const char* guard) {
+	fprintf(out, "#endif /* %s */\n", guard);
+	fclose(out);
+}
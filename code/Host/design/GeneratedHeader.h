@@ -0,0 +1,24 @@
+/*
+ * GeneratedHeader.h
+ *
+ * Frame of the headers the design tools write into the bot controller, i.e. the comment with
+ * the command line that reproduces the header and the include guard.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef GENERATEDHEADER_H_
+#define GENERATEDHEADER_H_
+
+#include <stdio.h>
+
+// first lines of the comment of a generated header, the caller adds the design parameters
+FILE* openHeader(const char* name, const char* tool, const char* title, const char* content, int argc, char* argv[]);
+
+// end of the comment and start of the include guard
+void beginHeader(FILE* out, const char* guard);
+
+void closeHeader(FILE* out, const char* guard);
+
+#endif /* GENERATEDHEADER_H_ */
@@ -0,0 +1,112 @@
+/*
+ * LinearModel.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <setup.h>
+#include <LinearModel.h>
+
+// matrix exponential by scaling and squaring of a Taylor series
+static void exponential(const Matrix& a, Matrix& result) {
+	int squarings = max(0, (int)ceil(log2(maxAbs(a)*N)) + 1);
+	double scale = 1.0/pow(2.0, squarings);
+	Matrix term, sum;
+	for (int i = 0;i<N;i++)
+		for (int j = 0;j<N;j++)
+			sum[i][j] = term[i][j] = (i == j)?1.0:0.0;
+	for (int k = 1;k<=20;k++) {
+		multiply(term, a, term);
+		for (int i = 0;i<N;i++)
+			for (int j = 0;j<N;j++) {
+				term[i][j] *= scale/k;
+				sum[i][j] += term[i][j];
+			}
+	}
+	for (int i = 0;i<squarings;i++)
+		multiply(sum, sum, sum);
+	memcpy(result, sum, sizeof(Matrix));
+}
+
+void discreteModel(LinearModel& model) {
+	const double M = BodyWeight;
+	const double r = BallRadius;
+	const double l = CentreOfGravityHeight - BallRadius;
+	const double Ia = 5.0/3.0*BallWeight*r*r;
+	const double A0 = Ia + BodyInertia + M*(r + l)*(r + l);
+	const double B0 = Ia + M*r*(r + l);
+	model.angularAccelTilt = M*Gravity*l/A0;
+	model.angularAccelInput = -B0/(A0*r);
+
+	Matrix Ac;
+	memset(Ac, 0, sizeof(Matrix));
+	Ac[LQR_TILT][LQR_ANGULAR_VELOCITY] = 1.0;
+	Ac[LQR_ANGULAR_VELOCITY][LQR_TILT] = model.angularAccelTilt;
+	Ac[LQR_POS][LQR_SPEED] = 1.0;
+	Ac[LQR_POS_INTEGRATED][LQR_POS] = 1.0;
+	for (int i = 0;i<N;i++)
+		for (int j = 0;j<N;j++)
+			Ac[i][j] *= SamplingTime;
+	exponential(Ac, model.A);
+
+	Vector jump;
+	memset(jump, 0, sizeof(Vector));
+	jump[LQR_ANGULAR_VELOCITY] = model.angularAccelInput*SamplingTime;
+	jump[LQR_SPEED] = SamplingTime;
+	multiply(model.A, jump, model.B);
+}
+
+void DesignWeights::costs(Vector& Q, double& R) const {
+	Q[LQR_TILT] = 1.0/(tilt*tilt);
+	Q[LQR_ANGULAR_VELOCITY] = 1.0/(angularVelocity*angularVelocity);
+	Q[LQR_POS] = 1.0/(pos*pos);
+	Q[LQR_SPEED] = 1.0/(speed*speed);
+	Q[LQR_POS_INTEGRATED] = 1.0/(posIntegrated*posIntegrated);
+	R = 1.0/(accel*accel);
+}
+
+bool solveRiccati(const Matrix& A, const Vector& B, const Vector& Q, double R, Vector& K, Matrix& P) {
+	Matrix At;
+	memset(P, 0, sizeof(Matrix));
+	for (int i = 0;i<N;i++)
+		P[i][i] = Q[i];
+	transpose(A, At);
+
+	const int MaxIterations = 1000000;
+	for (int iteration = 0;iteration<MaxIterations;iteration++) {
+		// K = (R + B'PB)^-1 B'PA, the input is a scalar
+		Vector PB;
+		multiply(P, B, PB);
+		double BPB = 0;
+		for (int i = 0;i<N;i++)
+			BPB += B[i]*PB[i];
+		Vector BPA;
+		multiply(At, PB, BPA);
+		for (int i = 0;i<N;i++)
+			K[i] = BPA[i]/(R + BPB);
+
+		// P = Q + (A-BK)'P(A-BK) + K'RK, which is A'PA - A'PB·K + Q but stays
+		// symmetric and positive definite despite of rounding
+		Matrix closedLoop, closedLoopT, next;
+		for (int i = 0;i<N;i++)
+			for (int j = 0;j<N;j++)
+				closedLoop[i][j] = A[i][j] - B[i]*K[j];
+		transpose(closedLoop, closedLoopT);
+		multiply(P, closedLoop, next);
+		multiply(closedLoopT, next, next);
+		for (int i = 0;i<N;i++) {
+			next[i][i] += Q[i];
+			for (int j = 0;j<N;j++)
+				next[i][j] += K[i]*R*K[j];
+		}
+		double change = 0;
+		for (int i = 0;i<N;i++)
+			for (int j = 0;j<N;j++)
+				change = max(change, fabs(next[i][j] - P[i][j]));
+		memcpy(P, next, sizeof(Matrix));
+		if (change < 1.0e-12*maxAbs(P))
+			return true;
+	}
+	return false;
+}
@@ -0,0 +1,155 @@
+/*
+ * LinearModel.h
+ *
+ * Linearised model of one plane of the bot for the offline design of controllers (control_design,
+ * mpc_design), and the small dense matrix operations these need. The ball balancer is linearised
+ * around the upright position, with the constants of setup.h (bodies of BotModel):
+ *     A0·θ'' = M·g·l·θ - B0·ψ''   with A0 = Ia + I + M(r+l)^2, B0 = Ia + M·r(r+l), Ia = 5/3·m·r^2
+ * ψ is the rotation of the ball relative to the body, i.e. what the odometry measures as
+ * position p = r·ψ and speed s = r·ψ'. The state is that of LQRState
+ *     e = (θ, θ', p, s, ∫p)
+ * and the input is the acceleration a of the ControlPlane. The controller integrates a into
+ * the speed once per tick, so the speed jumps by a·dT at the beginning of a tick and stays
+ * constant, which makes the discretisation exact: the jump kicks θ' by -B0/(A0·r)·a·dT, and
+ * the rest of the tick is the free motion exp(Ac·dT). Motor lag and the output filter are not
+ * modelled.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef LINEARMODEL_H_
+#define LINEARMODEL_H_
+
+#include <string.h>
+#include <math.h>
+#include <utility>
+#include <vector>
+#include <Arduino.h>
+#include <StateController.h>
+
+const int N = LQRStates;
+typedef double Matrix[N][N];
+typedef double Vector[N];
+
+struct LinearModel {
+	Matrix A;								// discrete model x(k+1) = A·x(k) + B·a(k) of one tick
+	Vector B;
+	double angularAccelTilt;				// continuous model θ'' = angularAccelTilt·θ + angularAccelInput·a
+	double angularAccelInput;
+};
+
+// max values of the states and the input of Bryson's rule, i.e. Q and R are diagonal with 1/(max value)^2
+struct DesignWeights {
+	double tilt = radians(2.0);				// [rad]
+	double angularVelocity = radians(30.0);	// [rad/s]
+	double pos = 0.1;						// [m]
+	double speed = 0.25;					// [m/s]
+	double posIntegrated = 0.2;				// [m s]
+	double accel = 1.5;						// [m/s^2] keeps a tilt of 2° within MaxBotAccel
+
+	void costs(Vector& Q, double& R) const;
+};
+
+// discrete model of one plane with the constants of setup.h
+void discreteModel(LinearModel& model);
+
+// solve the discrete algebraic Riccati equation of a single input by iteration,
+// returns the gains K of a = -K·x and the cost matrix P
+bool solveRiccati(const Matrix& A, const Vector& B, const Vector& Q, double R, Vector& K, Matrix& P);
+
+template<int n> void multiply(const double (&a)[n][n], const double (&b)[n][n], double (&result)[n][n]) {
+	double r[n][n];
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<n;j++) {
+			r[i][j] = 0;
+			for (int k = 0;k<n;k++)
+				r[i][j] += a[i][k]*b[k][j];
+		}
+	memcpy(result, r, sizeof(r));
+}
+
+template<int n> void multiply(const double (&a)[n][n], const double (&v)[n], double (&result)[n]) {
+	double r[n];
+	for (int i = 0;i<n;i++) {
+		r[i] = 0;
+		for (int k = 0;k<n;k++)
+			r[i] += a[i][k]*v[k];
+	}
+	memcpy(result, r, sizeof(r));
+}
+
+template<int n> void transpose(const double (&a)[n][n], double (&result)[n][n]) {
+	double r[n][n];
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<n;j++)
+			r[i][j] = a[j][i];
+	memcpy(result, r, sizeof(r));
+}
+
+template<int n> double maxAbs(const double (&a)[n][n]) {
+	double m = 0;
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<n;j++)
+			m = max(m, fabs(a[i][j]));
+	return m;
+}
+
+// Gauss-Jordan with pivoting of a n x n matrix in row major order, returns false if the matrix is singular
+inline bool invert(int n, const double* a, double* result) {
+	std::vector<double> m(n*2*n);
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<n;j++) {
+			m[i*2*n+j] = a[i*n+j];
+			m[i*2*n+n+j] = (i == j)?1.0:0.0;
+		}
+	for (int col = 0;col<n;col++) {
+		int pivot = col;
+		for (int row = col+1;row<n;row++)
+			if (fabs(m[row*2*n+col]) > fabs(m[pivot*2*n+col]))
+				pivot = row;
+		if (fabs(m[pivot*2*n+col]) < 1.0e-12)
+			return false;
+		for (int j = 0;j<2*n;j++)
+			std::swap(m[col*2*n+j], m[pivot*2*n+j]);
+		double f = m[col*2*n+col];
+		for (int j = 0;j<2*n;j++)
+			m[col*2*n+j] /= f;
+		for (int row = 0;row<n;row++)
+			if (row != col) {
+				double g = m[row*2*n+col];
+				for (int j = 0;j<2*n;j++)
+					m[row*2*n+j] -= g*m[col*2*n+j];
+			}
+	}
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<n;j++)
+			result[i*n+j] = m[i*2*n+n+j];
+	return true;
+}
+
+template<int n> bool invert(const double (&a)[n][n], double (&result)[n][n]) {
+	return invert(n, &a[0][0], &result[0][0]);
+}
+
+// spectral radius as limit of |A^n|^1/n, the matrix is squared and normalised
+template<int n> double spectralRadius(const double (&a)[n][n]) {
+	const int Squarings = 16;
+	double power[n][n];
+	memcpy(power, a, sizeof(power));
+	double logScale = 0;
+	for (int i = 0;i<=Squarings;i++) {
+		if (i > 0) {
+			multiply(power, power, power);
+			logScale *= 2.0;
+		}
+		double s = maxAbs(power);
+		for (int j = 0;j<n;j++)
+			for (int k = 0;k<n;k++)
+				power[j][k] /= s;
+		logScale += log(s);
+	}
+	return exp(logScale/pow(2.0, Squarings));
+}
+
+#endif /* LINEARMODEL_H_ */
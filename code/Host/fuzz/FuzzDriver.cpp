@@ -0,0 +1,151 @@
+/*
+ * FuzzDriver.cpp
+ *
+ * Standalone driver of a libFuzzer target for compilers without libFuzzer (gcc). It runs the
+ * inputs of the given corpus files and directories, and then random inputs, without coverage
+ * feedback. Understands a subset of libFuzzer's flags:
+ * 		-runs=N			number of random inputs, default 100000 (0 if a corpus is given)
+ * 		-seed=N			seed of the random inputs, default 1
+ * 		-max_len=N		maximum length of a random input, default 256
+ * If the target crashes, the input is written to crash-<n>.bin, so it can be replayed by
+ * passing it as corpus file.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <signal.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <random>
+#include <vector>
+#include <string>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv) __attribute__((weak));
+extern "C" void __sanitizer_set_death_callback(void (*callback)(void)) __attribute__((weak));
+
+static std::vector<uint8_t> currentInput;
+static uint64_t currentRun = 0;
+static volatile bool inTarget = false;
+
+// write the input that crashed, called by the signal handler or the sanitizer. Not if the
+// sanitizer reports something after all inputs, e.g. leaks at exit
+static void writeCrashInput() {
+	if (!inTarget)
+		return;
+	char name[64];
+	snprintf(name, sizeof(name), "crash-%llu.bin", (unsigned long long)currentRun);
+	int fd = creat(name, 0644);
+	if (fd >= 0) {
+		if (write(fd, currentInput.data(), currentInput.size()) < 0) {}
+		close(fd);
+		const char msg[] = "input written to crash file\n";
+		if (write(2, msg, sizeof(msg)-1) < 0) {}
+	}
+}
+
+static void crashHandler(int sig) {
+	writeCrashInput();
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
+
+static bool readFile(const std::string& name, std::vector<uint8_t>& data) {
+	FILE* f = fopen(name.c_str(), "rb");
+	if (f == NULL)
+		return false;
+	data.clear();
+	uint8_t buf[4096];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+		data.insert(data.end(), buf, buf + n);
+	fclose(f);
+	return true;
+}
+
+static void collectFiles(const std::string& name, std::vector<std::string>& files) {
+	struct stat st;
+	if (stat(name.c_str(), &st) != 0)
+		return;
+	if (!S_ISDIR(st.st_mode)) {
+		files.push_back(name);
+		return;
+	}
+	DIR* dir = opendir(name.c_str());
+	if (dir == NULL)
+		return;
+	while (struct dirent* entry = readdir(dir))
+		if (entry->d_name[0] != '.')
+			collectFiles(name + "/" + entry->d_name, files);
+	closedir(dir);
+}
+
+static void run(const std::vector<uint8_t>& data) {
+	currentInput = data;
+	inTarget = true;
+	LLVMFuzzerTestOneInput(currentInput.data(), currentInput.size());
+	inTarget = false;
+	currentRun++;
+}
+
+int main(int argc, char* argv[]) {
+	if (LLVMFuzzerInitialize)
+		LLVMFuzzerInitialize(&argc, &argv);
+
+	long runs = -1;
+	unsigned long seed = 1;
+	size_t maxLength = 256;
+	std::vector<std::string> files;
+	for (int i = 1;i<argc;i++) {
+		if (strncmp(argv[i], "-runs=", 6) == 0)
+			runs = atol(argv[i] + 6);
+		else if (strncmp(argv[i], "-seed=", 6) == 0)
+			seed = strtoul(argv[i] + 6, NULL, 10);
+		else if (strncmp(argv[i], "-max_len=", 9) == 0)
+			maxLength = atol(argv[i] + 9);
+		else if (argv[i][0] == '-') {
+			fprintf(stderr, "usage: %s [-runs=N] [-seed=N] [-max_len=N] [corpus files or directories]\n", argv[0]);
+			return 1;
+		} else
+			collectFiles(argv[i], files);
+	}
+	if (runs < 0)
+		runs = files.empty()?100000:0;
+
+	signal(SIGSEGV, crashHandler);
+	signal(SIGABRT, crashHandler);
+	signal(SIGFPE, crashHandler);
+	if (__sanitizer_set_death_callback)
+		__sanitizer_set_death_callback(writeCrashInput);
+
+	std::vector<uint8_t> data;
+	for (const std::string& name : files) {
+		if (!readFile(name, data)) {
+			perror(name.c_str());
+			return 1;
+		}
+		run(data);
+	}
+	fprintf(stderr, "%zu corpus inputs executed\n", files.size());
+
+	// random inputs, mostly printable characters, since that is what the parsers look at
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<size_t> length(0, maxLength);
+	std::uniform_int_distribution<int> byte(0, 255);
+	std::uniform_int_distribution<int> printable(' ', '~');
+	for (long r = 0;r<runs;r++) {
+		data.resize(length(random));
+		for (uint8_t& b : data)
+			b = (byte(random) < 128)?printable(random):byte(random);
+		run(data);
+	}
+	fprintf(stderr, "%ld random inputs executed, seed %lu\n", runs, seed);
+	return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * command_fuzz.cpp
+ *
+ * Fuzzing of the command input of the bot controller, i.e. of the menus (MenuController and
+ * the menu of the StateController) and of the commands coming from the webserver via I2C
+ * (I2CSlave). Every input is a sequence of operations:
+ * 		0x00..0xEF		a key typed into the menu, dispatched by one call of MenuController::loop
+ * 		0xF0 n data		an i2c write of n bytes (register and command) followed by an empty one,
+ * 						executed by I2CSlave::loop
+ * 		0xF1			a pause of 250ms, i.e. the next key does not count as continuous key press
+ * Between two operations the clock advances by one sample of the balancing loop. Log output
+ * goes through the production BufferedSerial into a port that discards it.
+ *
+ * Besides crashes (fatalError aborts), the duration of every dispatch is measured, since the
+ * menu and the i2c commands are executed within the balancing loop. At exit, the distribution
+ * is printed together with the slowest input, which is written to slow-unit.bin if it exceeds
+ * DispatchBudget. Sanitizers slow down everything, so measure with HOST_FUZZ_SANITIZE=OFF.
+ * A single outlier may be the scheduler of the host, replaying slow-unit.bin tells.
+ *
+ * use:
+ *     command_fuzz [-runs=N] [-seed=N] [-max_len=N] [corpus files or directories]
+ *
+ * Built with clang this is a libFuzzer target, otherwise FuzzDriver.cpp provides a standalone
+ * random driver with the same command line.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <Arduino.h>
+#include <setup.h>
+#include <BotMemory.h>
+#include <StateController.h>
+#include <libraries/MenuController.h>
+#include <libraries/I2CSlave.h>
+#include <libraries/BufferedSerial.h>
+#include <libraries/Util.h>
+
+const uint8_t OpI2CWrite = 0xF0;
+const uint8_t OpPause = 0xF1;
+const uint8_t FirstOp = 0xF0;
+
+const uint64_t DispatchBudget_ns = 100000;		// what the balancing loop can afford for a command
+
+// port of BufferedSerial that accepts everything and discards it
+class NullPort : public Stream {
+public:
+	virtual size_t write(uint8_t c) { return 1; };
+	virtual size_t write(const uint8_t* buffer, size_t size) { return size; };
+	using Print::write;
+	virtual int availableForWrite() { return 1024; };
+	virtual int available() { return 0; };
+	virtual int read() { return -1; };
+	virtual int peek() { return -1; };
+};
+
+// menu input out of the fuzzer's data
+class KeyInput : public Stream {
+public:
+	void set(char c) { key = c; valid = true; };
+	virtual size_t write(uint8_t c) { return 1; };
+	virtual int available() { return valid?1:0; };
+	virtual int read() { if (!valid) return -1; valid = false; return key; };
+	virtual int peek() { return valid?key:-1; };
+private:
+	char key = 0;
+	bool valid = false;
+};
+
+// root menu of the harness that opens the menu of the state controller like BotController does
+class RootMenu : public Menuable {
+public:
+	virtual void menuLoop(char ch, bool continously) {
+		if (ch == 's')
+			state->pushMenu();
+	}
+	StateController* state = NULL;
+};
+
+static NullPort nullPort;
+BufferedSerial bufferedSerial(nullPort);
+static KeyInput keyInput;
+static MenuController menuController;
+static RootMenu rootMenu;
+static StateController stateController;
+static bool balancing = false;
+I2CSlave* i2cSlave = new I2CSlave(&Wire1);
+
+static uint64_t clock_us = 0;
+static uint64_t fuzzClock() { return clock_us; }
+
+// statistics of the dispatch durations, per kind of operation
+enum OpKind { MENU_KEY, I2C_COMMAND, NumberOfOpKinds };
+static const char* opName[NumberOfOpKinds] = { "menu key", "i2c command" };
+static std::vector<uint32_t> duration_ns[NumberOfOpKinds];
+static uint64_t slowest_ns = 0;
+static std::vector<uint8_t> slowestInput;
+
+static void printStatistics() {
+	fprintf(stderr, "dispatch duration (budget %.0fus):\n", DispatchBudget_ns/1000.0);
+	for (int k = 0;k<NumberOfOpKinds;k++) {
+		std::vector<uint32_t>& d = duration_ns[k];
+		if (d.empty())
+			continue;
+		std::sort(d.begin(), d.end());
+		fprintf(stderr, "    %-12s %9zu  p50 %7.2fus  p99 %7.2fus  p99.99 %7.2fus  max %7.2fus\n", opName[k], d.size(),
+				d[d.size()/2]/1000.0, d[(d.size()*99)/100]/1000.0, d[(d.size()*9999)/10000]/1000.0, d.back()/1000.0);
+	}
+	fprintf(stderr, "    slowest input has %zu bytes\n", slowestInput.size());
+	if (slowest_ns > DispatchBudget_ns) {
+		FILE* f = fopen("slow-unit.bin", "wb");
+		if (f != NULL) {
+			fwrite(slowestInput.data(), 1, slowestInput.size(), f);
+			fclose(f);
+			fprintf(stderr, "    exceeds the budget, written to slow-unit.bin\n");
+		}
+	}
+}
+
+static void abortOnFatalError(const char s[]) {
+	fprintf(stderr, "fatal error: %s\n", s);
+	abort();
+}
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv) {
+	setHostClock(fuzzClock);
+	setFatalErrorHook(abortOnFatalError);
+	logger = &bufferedSerial;
+	command = &keyInput;
+	bufferedSerial.setPolicy(BufferedSerial::DROP_ON_FULL);
+	memory.setup();
+	i2cSlave->setup();
+	atexit(printStatistics);
+	return 0;
+}
+
+// dispatch one operation within the loop and measure it
+template<typename F> static uint64_t dispatch(OpKind kind, F f) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	f();
+	uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	duration_ns[kind].push_back((uint32_t)min(ns, (uint64_t)UINT32_MAX));
+	bufferedSerial.loop();
+	clock_us += SamplingTime*1000000;
+	return ns;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	// every input starts in the root menu with the default configuration
+	menuController.setup();
+	rootMenu.registerMenuController(&menuController);
+	rootMenu.state = &stateController;
+	stateController.setup(&menuController, []() { balancing = !balancing; return balancing; });
+	memory.persistentMem.ctrlConfig.initDefaultValues();
+	clock_us += 1000000;
+
+	uint64_t slowest = 0;
+	size_t i = 0;
+	while (i < size) {
+		uint8_t op = data[i++];
+		if (op < FirstOp) {
+			keyInput.set(op);
+			slowest = max(slowest, dispatch(MENU_KEY, []() { menuController.loop(); }));
+		} else if (op == OpI2CWrite) {
+			size_t n = (i < size)?data[i++]:0;
+			n = min(n, size - i);
+			const uint8_t* command = &data[i];
+			i += n;
+			slowest = max(slowest, dispatch(I2C_COMMAND, [command, n]() {
+				// the webserver sends an empty transmission after each command
+				Wire1.hostWrite(command, n);
+				Wire1.hostWrite(command, 0);
+				i2cSlave->loop();
+			}));
+		} else if (op == OpPause)
+			clock_us += 250000;
+	}
+
+	// configuration stays within what the menu can set
+	StateControllerConfig& config = memory.persistentMem.ctrlConfig;
+	if (!std::isfinite(config.angleWeight) || !std::isfinite(config.angularSpeedWeight) ||
+		!std::isfinite(config.ballPositionWeight) || !std::isfinite(config.ballPosIntegratedWeight) ||
+		!std::isfinite(config.ballVelocityWeight) || !std::isfinite(config.ballAccelWeight))
+		fatalError("configuration is not finite");
+
+	if (slowest > slowest_ns) {
+		slowest_ns = slowest;
+		slowestInput.assign(data, data + size);
+	}
+	return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Arduino.cpp
+ *
+ * Implementation of the host replacement of the Teensy core.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <chrono>
+#include <thread>
+
+static uint64_t steadyClock_us() {
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static HostClock hostClock = steadyClock_us;
+
+void setHostClock(HostClock clock) {
+	hostClock = (clock == NULL)?steadyClock_us:clock;
+}
+
+uint32_t micros() {
+	return (uint32_t)hostClock();
+}
+
+uint32_t millis() {
+	return (uint32_t)(hostClock()/1000);
+}
+
+void delay(uint32_t ms) {
+	// a simulated clock does not advance while waiting
+	if (hostClock == steadyClock_us)
+		std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+	if (hostClock == steadyClock_us)
+		std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+String::String(float x, int digits) {
+	char buf[64];
+	snprintf(buf, sizeof(buf), "%.*f", digits, x);
+	assign(buf);
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+	size_t n = 0;
+	while (size--)
+		n += write(*buffer++);
+	return n;
+}
+
+size_t Print::printSigned(long long x, int base) {
+	if ((x < 0) && (base == DEC))
+		return print('-') + printNumber(-(unsigned long long)x, base);
+	return printNumber((unsigned long long)x, base);
+}
+
+size_t Print::printNumber(unsigned long long x, int base) {
+	char buf[8*sizeof(x)+1];
+	char* s = &buf[sizeof(buf)-1];
+	*s = 0;
+	if (base < 2)
+		base = 10;
+	do {
+		char digit = x % base;
+		x /= base;
+		*--s = (digit < 10)?('0' + digit):('A' + digit - 10);
+	} while (x);
+	return write(s);
+}
+
+size_t Print::printFloat(double x, int digits) {
+	if (std::isnan(x))
+		return write("nan");
+	if (std::isinf(x))
+		return write("inf");
+	char buf[64];
+	snprintf(buf, sizeof(buf), "%.*f", digits, x);
+	return write(buf);
+}
+
+uint8_t hostEEPROM[HostEEPROMSize];
+static bool eepromErased = false;		// erased lazily, constructors of globals may already access it
+
+void hostEEPROMErase() {
+	memset(hostEEPROM, 0xFF, sizeof(hostEEPROM));
+	eepromErased = true;
+}
+
+static uint8_t* eepromAddress(const void* addr, uint32_t len) {
+	if (!eepromErased)
+		hostEEPROMErase();
+	uintptr_t a = (uintptr_t)addr;
+	if (a + len > HostEEPROMSize)
+		abort();
+	return &hostEEPROM[a];
+}
+
+void eeprom_read_block(void* buf, const void* addr, uint32_t len) {
+	memcpy(buf, eepromAddress(addr, len), len);
+}
+
+void eeprom_write_block(const void* buf, void* addr, uint32_t len) {
+	memcpy(eepromAddress(addr, len), buf, len);
+}
+
+uint16_t eeprom_read_word(const uint16_t* addr) {
+	uint16_t value;
+	eeprom_read_block(&value, addr, sizeof(value));
+	return value;
+}
+
+void eeprom_write_word(uint16_t* addr, uint16_t value) {
+	eeprom_write_block(&value, addr, sizeof(value));
+}
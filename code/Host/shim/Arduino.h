@@ -0,0 +1,150 @@
+/*
+ * Arduino.h
+ *
+ * Thin replacement of the Teensy core for the host build of the control core. It provides
+ * what the control code actually uses: integer types, the math macros, constrain/min/max,
+ * millis/micros, String, and Print/Stream, so logging via logger->print works as on the bot.
+ * Everything that touches hardware (pins, interrupts) is a no-op.
+ *
+ * The clock is the monotonic clock of the host. A simulation that runs faster than real time
+ * replaces it with setHostClock().
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <cmath>
+#include <string>
+
+using std::abs;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PI 			3.1415926535897932384626433832795
+#define HALF_PI 	1.5707963267948966192313216916398
+#define TWO_PI 		6.283185307179586476925286766559
+#define DEG_TO_RAD 	0.017453292519943295769236907684886
+#define RAD_TO_DEG 	57.295779513082320876798154814105
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 4
+#define FALLING 2
+#define RISING 3
+
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define sq(x) ((x)*(x))
+
+template<class A, class B, class C> inline auto constrain(A a, B low, C high) -> decltype(a+low+high) {
+	return (a < low)?low:((a > high)?high:a);
+}
+template<class A, class B> inline auto min(A a, B b) -> decltype(a+b) { return (a < b)?a:b; }
+template<class A, class B> inline auto max(A a, B b) -> decltype(a+b) { return (a > b)?a:b; }
+
+// time since start of the program, or the time of the clock set by setHostClock
+typedef uint64_t (*HostClock)();
+void setHostClock(HostClock clock);
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+inline void yield() {};
+
+// hardware is not there
+inline void noInterrupts() {};
+inline void interrupts() {};
+inline void pinMode(int, int) {};
+inline void digitalWrite(int, int) {};
+inline int digitalRead(int) { return LOW; };
+inline int analogRead(int) { return 0; };
+inline void analogWrite(int, int) {};
+
+// strings live in RAM anyway
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper*)(s))
+
+class String : public std::string {
+public:
+	String() {};
+	String(const char* s) : std::string(s) {};
+	String(const std::string& s) : std::string(s) {};
+	String(char c) : std::string(1, c) {};
+	String(int x) : std::string(std::to_string(x)) {};
+	String(unsigned int x) : std::string(std::to_string(x)) {};
+	String(long x) : std::string(std::to_string(x)) {};
+	String(unsigned long x) : std::string(std::to_string(x)) {};
+	String(float x, int digits = 2);
+	String(double x, int digits = 2) : String((float)x, digits) {};
+
+	unsigned int length() const { return size(); };
+	const char* c_str() const { return std::string::c_str(); };
+	int indexOf(char c) const { size_t p = find(c); return (p == npos)?-1:(int)p; };
+	int indexOf(const char* s) const { size_t p = find(s); return (p == npos)?-1:(int)p; };
+	String substring(unsigned int from) const { return (from >= size())?String():String(substr(from)); };
+	String substring(unsigned int from, unsigned int to) const { return (from >= size())?String():String(substr(from, to-from)); };
+	char charAt(unsigned int i) const { return (i < size())?at(i):0; };
+	int toInt() const { return atoi(c_str()); };
+	float toFloat() const { return atof(c_str()); };
+	bool equals(const char* s) const { return compare(s) == 0; };
+	String& concat(const String& s) { append(s); return *this; };
+};
+
+// same formatting as the Arduino core, so the host output looks like the bot's
+class Print {
+public:
+	virtual ~Print() {};
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	size_t write(const char* s) { return (s == NULL)?0:write((const uint8_t*)s, strlen(s)); };
+	size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); };
+	virtual int availableForWrite() { return 0; };
+	virtual void flush() {};
+
+	size_t print(const __FlashStringHelper* s) { return write((const char*)s); };
+	size_t print(const String& s) { return write(s.c_str(), s.size()); };
+	size_t print(const char s[]) { return write(s); };
+	size_t print(char c) { return write((uint8_t)c); };
+	size_t print(unsigned char x, int base = DEC) { return printNumber(x, base); };
+	size_t print(int x, int base = DEC) { return printSigned(x, base); };
+	size_t print(unsigned int x, int base = DEC) { return printNumber(x, base); };
+	size_t print(long x, int base = DEC) { return printSigned(x, base); };
+	size_t print(unsigned long x, int base = DEC) { return printNumber(x, base); };
+	size_t print(long long x, int base = DEC) { return printSigned(x, base); };
+	size_t print(unsigned long long x, int base = DEC) { return printNumber(x, base); };
+	size_t print(double x, int digits = 2) { return printFloat(x, digits); };
+
+	size_t println() { return write("\r\n"); };
+	template<class T> size_t println(const T& x) { size_t n = print(x); return n + println(); };
+	template<class T> size_t println(const T& x, int format) { size_t n = print(x, format); return n + println(); };
+private:
+	size_t printSigned(long long x, int base);
+	size_t printNumber(unsigned long long x, int base);
+	size_t printFloat(double x, int digits);
+};
+
+class Stream : public Print {
+public:
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+};
+
+#endif /* HOST_ARDUINO_H_ */
@@ -0,0 +1,27 @@
+/*
+ * EEPROM.h
+ *
+ * EEPROM of the host build, kept in RAM. It starts erased (0xFF) like a new Teensy, so
+ * MemoryBase initializes the persistent memory with the default values.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_EEPROM_H_
+#define HOST_EEPROM_H_
+
+#include <Arduino.h>
+
+const size_t HostEEPROMSize = 4096;		// same as the Teensy 3.5
+extern uint8_t hostEEPROM[HostEEPROMSize];
+
+// erase the EEPROM, i.e. the next MemoryBase::setup() starts with the default values
+void hostEEPROMErase();
+
+void eeprom_read_block(void* buf, const void* addr, uint32_t len);
+void eeprom_write_block(const void* buf, void* addr, uint32_t len);
+uint16_t eeprom_read_word(const uint16_t* addr);
+void eeprom_write_word(uint16_t* addr, uint16_t value);
+
+#endif /* HOST_EEPROM_H_ */
@@ -0,0 +1,30 @@
+/*
+ * HostConsole.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <HostConsole.h>
+
+HostConsole hostConsole;
+
+Stream* logger = &hostConsole;
+Stream* command = &hostConsole;
+
+size_t HostConsole::write(uint8_t c) {
+	if (enabled)
+		fputc(c, stdout);
+	return 1;
+}
+
+size_t HostConsole::write(const uint8_t* buffer, size_t size) {
+	if (enabled)
+		fwrite(buffer, 1, size, stdout);
+	return size;
+}
+
+void HostConsole::flush() {
+	fflush(stdout);
+}
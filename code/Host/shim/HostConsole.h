@@ -0,0 +1,41 @@
+/*
+ * HostConsole.h
+ *
+ * Stream on stdout/stdin that replaces the UART of the bot in the host build. logger and
+ * command point to it by default, a tool may point them to its own stream, e.g. to silence
+ * the output of the control core.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_CONSOLE_H_
+#define HOST_CONSOLE_H_
+
+#include <Arduino.h>
+
+class HostConsole : public Stream {
+public:
+	HostConsole() {};
+	virtual ~HostConsole() {};
+
+	// output is suppressed if not enabled
+	void enable(bool on) { enabled = on; };
+
+	virtual size_t write(uint8_t c);
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	using Print::write;
+	virtual int availableForWrite() { return 4096; };
+	virtual void flush();
+
+	// input is never available, the menu is not used on the host
+	virtual int available() { return 0; };
+	virtual int read() { return -1; };
+	virtual int peek() { return -1; };
+private:
+	bool enabled = true;
+};
+
+extern HostConsole hostConsole;
+
+#endif /* HOST_CONSOLE_H_ */
@@ -0,0 +1,43 @@
+/*
+ * HostI2CBus.h
+ *
+ * Virtual I2C bus between the host builds of the webserver (master, Wire.h) and of the bot
+ * controller (slave, i2c_t3). Both run as separate Linux processes connected by a Unix domain
+ * socket of type SOCK_SEQPACKET, one packet is one I2C transaction:
+ *
+ * 		master -> slave		'W' address data...		write transaction
+ * 		slave -> master		'A' status				0 = ok, 2 = address not acknowledged
+ * 		master -> slave		'R' address n			read transaction of n bytes
+ * 		slave -> master		'D' data...				slave may send less than requested
+ *
+ * The master waits for the answer, so a transaction takes as long as the slave needs to
+ * respond plus the time the bytes need on the wire at the bus clock.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_I2C_BUS_H_
+#define HOST_I2C_BUS_H_
+
+#include <stdint.h>
+
+const uint8_t HostI2CWrite 	= 'W';
+const uint8_t HostI2CAck 	= 'A';
+const uint8_t HostI2CRead 	= 'R';
+const uint8_t HostI2CData 	= 'D';
+
+const int HostI2CMaxPacket = 512;
+
+// I2C status codes as returned by Wire.endTransmission
+const uint8_t HostI2COk 		= 0;
+const uint8_t HostI2CAddressNack = 2;
+const uint8_t HostI2COther 		= 4;
+
+// time a transaction of n data bytes needs on the wire, i.e. address and data bytes
+// with 9 clocks each plus start and stop condition
+inline uint32_t hostI2CBusTime_us(int n, uint32_t clock) {
+	return (uint32_t)(((n + 1)*9 + 2)*1000000ULL/clock);
+}
+
+#endif /* HOST_I2C_BUS_H_ */
@@ -0,0 +1,85 @@
+/*
+ * HostSerial.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <HostSerial.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+void HostSerial::attach(int fd) {
+	this->fd = fd;
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+bool HostSerial::open(const char* path) {
+	int f = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (f < 0)
+		return false;
+	struct termios tio;
+	if (tcgetattr(f, &tio) == 0) {
+		cfmakeraw(&tio);
+		tcsetattr(f, TCSANOW, &tio);
+	}
+	attach(f);
+	return true;
+}
+
+void HostSerial::begin(uint32_t baud) {
+	// 8N1, i.e. 10 bits per byte
+	bytesPerSecond = baud/10.0;
+	fifoSpace = FifoSize;
+	lastRefill_us = micros();
+}
+
+void HostSerial::refill() {
+	uint32_t now = micros();
+	fifoSpace += (now - lastRefill_us)*bytesPerSecond/1000000.0;
+	if (fifoSpace > FifoSize)
+		fifoSpace = FifoSize;
+	lastRefill_us = now;
+}
+
+int HostSerial::availableForWrite() {
+	refill();
+	return (int)fifoSpace;
+}
+
+size_t HostSerial::write(const uint8_t* buffer, size_t size) {
+	refill();
+	size_t fits = min(size, (size_t)fifoSpace);
+	overrunBytes += size - fits;
+	fifoSpace -= fits;
+	if ((fd < 0) || (fits == 0))
+		return fits;
+
+	// the other end is not reading, bytes get lost like on a real line
+	ssize_t n = ::write(fd, buffer, fits);
+	if (n < (ssize_t)fits)
+		overrunBytes += fits - ((n < 0)?0:n);
+	return fits;
+}
+
+int HostSerial::available() {
+	if (rxIdx == rxLen) {
+		rxIdx = 0;
+		rxLen = 0;
+		if (fd >= 0) {
+			ssize_t n = ::read(fd, rxBuffer, sizeof(rxBuffer));
+			if (n > 0)
+				rxLen = n;
+		}
+	}
+	return rxLen - rxIdx;
+}
+
+int HostSerial::read() {
+	return available()?rxBuffer[rxIdx++]:-1;
+}
+
+int HostSerial::peek() {
+	return available()?rxBuffer[rxIdx]:-1;
+}
@@ -0,0 +1,65 @@
+/*
+ * HostSerial.h
+ *
+ * UART of the host build on a file descriptor, typically a pseudo terminal, so the bot
+ * controller and the webserver running as Linux processes are connected like on the bot.
+ * The pty itself is as fast as the host, so the UART limits the output to the baud rate: the
+ * transmit FIFO accepts at most baud/10 bytes per second, availableForWrite tells how many
+ * bytes fit right now. Bytes written beyond that are counted as overrun.
+ *
+ * use:
+ * 		HostSerial serial;
+ * 		serial.attach(fd);
+ * 		serial.begin(230400);
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_SERIAL_H_
+#define HOST_SERIAL_H_
+
+#include <Arduino.h>
+
+class HostSerial : public Stream {
+public:
+	static const int FifoSize = 64;			// transmit FIFO [bytes]
+	static const int RxBufferSize = 256;
+
+	HostSerial() {};
+	virtual ~HostSerial() {};
+
+	// use the file descriptor (non-blocking) as line
+	void attach(int fd);
+	int getFd() { return fd; };
+
+	// open the terminal device of the path in raw mode, returns false if that did not work
+	bool open(const char* path);
+
+	void begin(uint32_t baud);
+
+	virtual size_t write(uint8_t c) { return write(&c, 1); };
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	using Print::write;
+	virtual int availableForWrite();
+
+	virtual int available();
+	virtual int read();
+	virtual int peek();
+
+	uint32_t getOverrunBytes() { return overrunBytes; };
+private:
+	void refill();
+
+	int fd = -1;
+	float bytesPerSecond = 23040;
+	float fifoSpace = FifoSize;
+	uint32_t lastRefill_us = 0;
+	uint32_t overrunBytes = 0;
+
+	uint8_t rxBuffer[RxBufferSize];
+	int rxLen = 0;
+	int rxIdx = 0;
+};
+
+#endif /* HOST_SERIAL_H_ */
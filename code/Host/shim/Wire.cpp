@@ -0,0 +1,106 @@
+/*
+ * Wire.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <Wire.h>
+#include <HostI2CBus.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+
+TwoWire Wire;
+
+bool TwoWire::hostConnect(const char* path, int timeout_ms) {
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path, sizeof(addr.sun_path)-1);
+
+	uint32_t start = millis();
+	do {
+		fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+		if (fd < 0)
+			return false;
+		if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0)
+			return true;
+		close(fd);
+		fd = -1;
+		delay(10);
+	} while (millis() - start < (uint32_t)timeout_ms);
+	return false;
+}
+
+void TwoWire::hostDisconnect() {
+	if (fd >= 0)
+		close(fd);
+	fd = -1;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+	txAddress = address;
+	txLen = 0;
+}
+
+size_t TwoWire::write(uint8_t c) {
+	if (txLen >= BufferLength)
+		return 0;
+	txBuffer[txLen++] = c;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t* buffer, size_t size) {
+	size_t n = 0;
+	while ((n < size) && write(buffer[n]))
+		n++;
+	return n;
+}
+
+int TwoWire::transfer(const uint8_t* packet, int len, uint8_t* answer, int maxAnswerLen) {
+	if (fd < 0)
+		return -1;
+	if (send(fd, packet, len, MSG_NOSIGNAL) != len)
+		return -1;
+	struct pollfd p = { fd, POLLIN, 0 };
+	if (poll(&p, 1, timeout_ms) <= 0)
+		return -1;
+	int n = recv(fd, answer, maxAnswerLen, 0);
+	if (n <= 0)
+		return -1;
+	return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+	uint8_t packet[2 + BufferLength];
+	packet[0] = HostI2CWrite;
+	packet[1] = txAddress;
+	memcpy(&packet[2], txBuffer, txLen);
+	uint8_t answer[2];
+	int n = transfer(packet, 2 + txLen, answer, sizeof(answer));
+
+	// the wire is busy for the address and all data bytes
+	delayMicroseconds(hostI2CBusTime_us(txLen, clock));
+	txLen = 0;
+	if ((n != 2) || (answer[0] != HostI2CAck))
+		return HostI2COther;
+	return answer[1];
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity) {
+	if (quantity > BufferLength)
+		quantity = BufferLength;
+	uint8_t packet[3] = { HostI2CRead, (uint8_t)address, (uint8_t)quantity };
+	uint8_t answer[1 + BufferLength];
+	int n = transfer(packet, sizeof(packet), answer, sizeof(answer));
+	rxIdx = 0;
+	rxLen = 0;
+	if ((n >= 1) && (answer[0] == HostI2CData)) {
+		rxLen = min(n - 1, quantity);
+		memcpy(rxBuffer, &answer[1], rxLen);
+	}
+	delayMicroseconds(hostI2CBusTime_us(quantity, clock));
+	return rxLen;
+}
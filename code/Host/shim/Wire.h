@@ -0,0 +1,68 @@
+/*
+ * Wire.h
+ *
+ * I2C master of the ESP8266 core for the host build of the webserver. Transactions go over the
+ * virtual bus of HostI2CBus.h to the bot controller running in another process.
+ *
+ * use:
+ * 		Wire.hostConnect("/tmp/flowerpot-i2c.sock", 5000);
+ * 		Wire.begin(PIN_WIRE_SDA, PIN_WIRE_SCL);
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_WIRE_H_
+#define HOST_WIRE_H_
+
+#include <Arduino.h>
+
+#define PIN_WIRE_SDA 4
+#define PIN_WIRE_SCL 5
+
+class TwoWire : public Stream {
+public:
+	static const int BufferLength = 128;		// same as the ESP8266 core
+
+	TwoWire() {};
+	virtual ~TwoWire() {};
+
+	// connect to the bus of the slave, retry until timeout, returns false if that did not work
+	bool hostConnect(const char* path, int timeout_ms);
+	void hostDisconnect();
+
+	void begin(int sda, int scl) {};
+	void begin() {};
+	void setClock(uint32_t frequency) { clock = frequency; };
+
+	void beginTransmission(uint8_t address);
+	void beginTransmission(int address) { beginTransmission((uint8_t)address); };
+	uint8_t endTransmission(bool sendStop = true);
+	uint8_t requestFrom(int address, int quantity);
+
+	virtual size_t write(uint8_t c);
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	using Print::write;
+	virtual int available() { return rxLen - rxIdx; };
+	virtual int read() { return (rxIdx < rxLen)?rxBuffer[rxIdx++]:-1; };
+	virtual int peek() { return (rxIdx < rxLen)?rxBuffer[rxIdx]:-1; };
+private:
+	// send a packet and wait for the answer of the slave, returns the length of the answer or -1
+	int transfer(const uint8_t* packet, int len, uint8_t* answer, int maxAnswerLen);
+
+	int fd = -1;
+	uint32_t clock = 100000;
+	int timeout_ms = 25;
+
+	uint8_t txAddress = 0;
+	uint8_t txBuffer[BufferLength];
+	int txLen = 0;
+
+	uint8_t rxBuffer[BufferLength];
+	int rxLen = 0;
+	int rxIdx = 0;
+};
+
+extern TwoWire Wire;
+
+#endif /* HOST_WIRE_H_ */
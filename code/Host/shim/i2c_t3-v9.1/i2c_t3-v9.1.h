@@ -0,0 +1,86 @@
+/*
+ * i2c_t3-v9.1.h
+ *
+ * I2C slave of the i2c_t3 library for the host build of the bot controller. The master (the
+ * host build of the webserver) connects via the virtual bus of HostI2CBus.h. There are no
+ * interrupts, hostPoll() has to be called in the main loop and invokes the callbacks instead.
+ *
+ * Like i2c_t3 on the Kinetis chips, the end of a received write is not detected by its stop
+ * condition but by the start of the next transaction, i.e. onReceive of a write is called when
+ * the master begins the next one. That is why the webserver sends an empty transmission after
+ * each command.
+ *
+ * use:
+ * 		Wire1.hostListen("/tmp/flowerpot-i2c.sock");
+ * 		Wire1.begin(I2C_SLAVE, 0x17, 0, I2C_PINS_37_38, I2C_PULLUP_EXT, I2C_RATE_400);
+ * 		while (Wire1.hostPoll(1000)) { ... }
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOST_I2C_T3_H_
+#define HOST_I2C_T3_H_
+
+#include <Arduino.h>
+
+enum i2c_mode { I2C_MASTER, I2C_SLAVE };
+enum i2c_pins { I2C_PINS_18_19, I2C_PINS_37_38, I2C_PINS_3_4 };
+enum i2c_pullup { I2C_PULLUP_EXT, I2C_PULLUP_INT };
+const uint32_t I2C_RATE_100 = 100000;
+const uint32_t I2C_RATE_400 = 400000;
+
+class i2c_t3 : public Stream {
+public:
+	static const int BufferLength = 259;		// same as i2c_t3
+
+	i2c_t3() {};
+	virtual ~i2c_t3() {};
+
+	// create the socket of the bus, the master connects later on
+	bool hostListen(const char* path);
+
+	// wait up to timeout for transactions of the master and process them.
+	// Returns false once the master disconnected
+	bool hostPoll(uint32_t timeout_us);
+	bool hostConnected() { return fd >= 0; };
+
+	// write transaction of the master addressed to this slave, without the bus
+	void hostWrite(const uint8_t* data, int len);
+
+	void begin(i2c_mode mode, uint8_t address1, uint8_t address2, i2c_pins pins, i2c_pullup pullup, uint32_t rate) { address = address1; };
+	void setDefaultTimeout(uint32_t timeout) {};
+	void onRequest(void (*function)(void)) { user_onRequest = function; };
+	void onReceive(void (*function)(unsigned int)) { user_onReceive = function; };
+
+	virtual size_t write(uint8_t c);
+	using Print::write;
+	virtual int available() { return rxLen - rxIdx; };
+	virtual int read() { return (rxIdx < rxLen)?rxBuffer[rxIdx++]:-1; };
+	virtual int peek() { return (rxIdx < rxLen)?rxBuffer[rxIdx]:-1; };
+private:
+	void process(const uint8_t* packet, int len);
+	void deliverReceived();
+
+	int listenFd = -1;
+	int fd = -1;
+	uint8_t address = 0;
+	void (*user_onRequest)(void) = NULL;
+	void (*user_onReceive)(unsigned int) = NULL;
+
+	// write that has been received but not yet passed to onReceive
+	uint8_t pending[BufferLength];
+	int pendingLen = -1;
+
+	uint8_t rxBuffer[BufferLength];
+	int rxLen = 0;
+	int rxIdx = 0;
+	uint8_t txBuffer[BufferLength];
+	int txLen = 0;
+};
+
+extern i2c_t3 Wire;
+extern i2c_t3 Wire1;
+extern i2c_t3 Wire2;
+
+#endif /* HOST_I2C_T3_H_ */
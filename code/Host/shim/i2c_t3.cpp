@@ -0,0 +1,119 @@
+/*
+ * i2c_t3.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <i2c_t3-v9.1/i2c_t3-v9.1.h>
+#include <HostI2CBus.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+
+i2c_t3 Wire;
+i2c_t3 Wire1;
+i2c_t3 Wire2;
+
+bool i2c_t3::hostListen(const char* path) {
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path, sizeof(addr.sun_path)-1);
+
+	unlink(path);
+	listenFd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	if (listenFd < 0)
+		return false;
+	if ((bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) != 0) || (listen(listenFd, 1) != 0)) {
+		close(listenFd);
+		listenFd = -1;
+		return false;
+	}
+	return true;
+}
+
+bool i2c_t3::hostPoll(uint32_t timeout_us) {
+	struct pollfd p = { (fd >= 0)?fd:listenFd, POLLIN, 0 };
+	struct timespec timeout = { (time_t)(timeout_us/1000000), (long)(timeout_us % 1000000)*1000 };
+	if (ppoll(&p, 1, &timeout, NULL) <= 0)
+		return true;
+
+	// only one master on the bus
+	if (fd < 0) {
+		fd = accept(listenFd, NULL, NULL);
+		return true;
+	}
+
+	// process everything that came in meanwhile, like the interrupt would have done
+	uint8_t packet[HostI2CMaxPacket];
+	int n;
+	while ((n = recv(fd, packet, sizeof(packet), MSG_DONTWAIT)) > 0)
+		process(packet, n);
+	if (n == 0) {
+		close(fd);
+		fd = -1;
+		return false;
+	}
+	return true;
+}
+
+void i2c_t3::deliverReceived() {
+	if (pendingLen < 0)
+		return;
+	memcpy(rxBuffer, pending, pendingLen);
+	rxLen = pendingLen;
+	rxIdx = 0;
+	pendingLen = -1;
+	if (user_onReceive)
+		user_onReceive(rxLen);
+}
+
+void i2c_t3::hostWrite(const uint8_t* data, int len) {
+	deliverReceived();
+	pendingLen = min(len, BufferLength);
+	memcpy(pending, data, pendingLen);
+}
+
+void i2c_t3::process(const uint8_t* packet, int len) {
+	if (len < 2)
+		return;
+	uint8_t answer[1 + BufferLength];
+	int answerLen = 0;
+	bool addressed = (packet[1] == address);
+
+	// the start of this transaction ends the previous write
+	if (addressed)
+		deliverReceived();
+
+	switch (packet[0]) {
+		case HostI2CWrite:
+			answer[answerLen++] = HostI2CAck;
+			answer[answerLen++] = addressed?HostI2COk:HostI2CAddressNack;
+			if (addressed)
+				hostWrite(&packet[2], len - 2);
+			break;
+		case HostI2CRead:
+			answer[answerLen++] = HostI2CData;
+			if (addressed && (len >= 3)) {
+				txLen = 0;
+				if (user_onRequest)
+					user_onRequest();
+				int n = min(txLen, (int)packet[2]);
+				memcpy(&answer[answerLen], txBuffer, n);
+				answerLen += n;
+			}
+			break;
+		default:
+			return;
+	}
+	send(fd, answer, answerLen, MSG_NOSIGNAL);
+}
+
+size_t i2c_t3::write(uint8_t c) {
+	if (txLen >= BufferLength)
+		return 0;
+	txBuffer[txLen++] = c;
+	return 1;
+}
@@ -0,0 +1,306 @@
+/*
+ * BatchSimulator.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <thread>
+#include <BatchSimulator.h>
+#include <libraries/Util.h>
+
+// same as sgn() of Util.h, but as float
+static inline BatchFloat sgnf(BatchFloat x) {
+	const BatchFloat zero = {};
+	return (x > zero)?(zero + 1.0f):((x < zero)?(zero - 1.0f):zero);
+}
+
+// clears the sign bit like fabs
+static inline BatchFloat absf(BatchFloat x) {
+	return (BatchFloat)((BatchInt)x & 0x7FFFFFFF);
+}
+
+static inline BatchFloat constrainf(BatchFloat x, BatchFloat low, BatchFloat high) {
+	return (x < low)?low:((x > high)?high:x);
+}
+
+static inline BatchFloat maxf(BatchFloat a, BatchFloat b) {
+	return (a > b)?a:b;
+}
+
+static inline float lane(const BatchFloat& v, int i) { return v[i]; };
+
+void BatchPlant::setup(const BotModelParameters& parameters) {
+	const float M = parameters.bodyMass;
+	const float r = BallRadius;
+	const float l = parameters.centreOfGravityHeight - BallRadius;
+	const float Ia = 5.0/3.0*parameters.ballMass*r*r;
+	float A = Ia + parameters.bodyInertia + M*(r + l)*(r + l);
+	float B = Ia + M*r*(r + l);
+	invMotorTimeConstant = 1.0/parameters.motorTimeConstant;
+	gravityGain = M*Gravity*l/A;
+	inputGain = B/(A*r);
+}
+
+bool BatchLaneState::operator==(const BatchLaneState& s) const {
+	// compare bits, not values
+	return (memcmp(&tilt, &s.tilt, sizeof(float)) == 0) &&
+		   (memcmp(&tiltRate, &s.tiltRate, sizeof(float)) == 0) &&
+		   (memcmp(&relSpeed, &s.relSpeed, sizeof(float)) == 0) &&
+		   (memcmp(&odoPos, &s.odoPos, sizeof(float)) == 0) &&
+		   (memcmp(&speed, &s.speed, sizeof(float)) == 0) &&
+		   (memcmp(&filteredSpeed, &s.filteredSpeed, sizeof(float)) == 0) &&
+		   (memcmp(&posErrorIntegrated, &s.posErrorIntegrated, sizeof(float)) == 0) &&
+		   (memcmp(&maxTilt, &s.maxTilt, sizeof(float)) == 0) &&
+		   (memcmp(&sumTiltSquare, &s.sumTiltSquare, sizeof(float)) == 0) &&
+		   (memcmp(&maxPos, &s.maxPos, sizeof(float)) == 0) &&
+		   (ticks == s.ticks);
+}
+
+void BatchLaneState::print() const {
+	printf("tilt=%a rate=%a relSpeed=%a pos=%a speed=%a filtered=%a integrated=%a maxTilt=%a sumTilt=%a maxPos=%a ticks=%d\n",
+			tilt, tiltRate, relSpeed, odoPos, speed, filteredSpeed, posErrorIntegrated,
+			maxTilt, sumTiltSquare, maxPos, ticks);
+}
+
+void BatchSimulator::setup(int n, const BotModelParameters& parameters) {
+	plant.setup(parameters);
+	candidates = n;
+	groups.resize((n + BatchLanes - 1)/BatchLanes);
+	configs.resize(groups.size()*BatchLanes);
+	StateControllerConfig defaultConfig;
+	defaultConfig.initDefaultValues();
+	for (size_t i = 0;i<configs.size();i++)
+		setConfig(i, defaultConfig);
+
+	// take the filters from the ControlPlane, so they are the same
+	ControlPlane plane;
+	plane.reset();
+	posNumTaps = plane.posFilter.get_no_of_taps();
+	outputSpeedNumTaps = plane.outputSpeedFilter.get_no_of_taps();
+	if ((posNumTaps > MaxTaps) || (outputSpeedNumTaps > MaxTaps))
+		fatalError("FIR filter exceeds MaxTaps");
+	plane.posFilter.get_taps(posTaps);
+	plane.outputSpeedFilter.get_taps(outputSpeedTaps);
+}
+
+void BatchSimulator::setConfig(int i, const StateControllerConfig& config) {
+	configs[i] = config;
+	Group& g = groups[i/BatchLanes];
+	int l = i % BatchLanes;
+	g.angleWeight[l] = config.angleWeight;
+	g.angularSpeedWeight[l] = config.angularSpeedWeight;
+	g.ballPositionWeight[l] = config.ballPositionWeight;
+	g.ballPosIntegratedWeight[l] = config.ballPosIntegratedWeight;
+	g.ballVelocityWeight[l] = config.ballVelocityWeight;
+	g.ballAccelWeight[l] = config.ballAccelWeight;
+	g.omegaWeight[l] = config.omegaWeight;
+}
+
+void BatchSimulator::resetGroup(Group& g, float tilt) {
+	const BatchFloat zero = {};
+	const BatchInt zeroInt = {};
+	g.tilt = zero + tilt;
+	g.tiltRate = g.relSpeed = g.odoPos = zero;
+	g.lastTargetAngle = g.lastTargetBallPos = g.lastBodyPos = g.lastBodySpeed = zero;
+	g.posErrorIntegrated = g.speed = g.filteredSpeed = zero;
+	for (int i = 0;i<2*MaxTaps;i++)
+		g.posFilter[i] = g.outputSpeedFilter[i] = zero;
+	g.posFilterIdx = g.outputSpeedFilterIdx = 0;
+	g.maxTilt = g.sumTiltSquare = g.maxPos = zero;
+	g.ticks = g.fallen = zeroInt;
+}
+
+// FIR::Filter::update with a ring buffer instead of shifting, but the same order of summation.
+// The newest sample is at idx, every sample is stored twice so the window is contiguous
+BatchFloat BatchSimulator::fir(BatchFloat* ring, int& idx, const float* taps, int numTaps, BatchFloat x) {
+	idx = (idx == 0)?(numTaps-1):(idx-1);
+	ring[idx] = ring[idx + numTaps] = x;
+	BatchFloat result = {};
+	const BatchFloat* window = &ring[idx];
+	for (int i = 0;i<numTaps;i++)
+		result += window[i]*taps[i];
+	return result;
+}
+
+void BatchSimulator::runGroup(Group& g, int ticks) {
+	const float dT = SamplingTime;
+	const BatchFloat zero = {};
+	const BatchInt zeroInt = {};
+	const float gradient = 10.0;
+	const float posErrorLimitAngle = radians(3);
+
+	// target is to stay in the origin
+	const float targetAccel = 0;
+	const float targetPos = 0;
+	const float targetOmega = 0;
+	const float targetSpeed = 0;
+
+	for (int t = 0;t<ticks;t++) {
+		// leave early if all lanes have fallen
+		BatchInt active = (g.fallen == zeroInt);
+		bool anyActive = false;
+		for (int l = 0;l<BatchLanes;l++)
+			anyActive = anyActive || active[l];
+		if (!anyActive)
+			break;
+
+		// plant with the speed of the last tick
+		BatchFloat tilt = g.tilt, tiltRate = g.tiltRate, relSpeed = g.relSpeed, odoPos = g.odoPos;
+		plant.simulate(dT, g.filteredSpeed, tilt, tiltRate, relSpeed, odoPos);
+
+		// ControlPlane::update, same operations in the same order
+		BatchFloat sensorAngle = tilt;
+		BatchFloat sensorAngularVelocity = tiltRate;
+		float targetAngle = targetAccel/Gravity;
+		BatchFloat targetAngularVelocity = (targetAngle - g.lastTargetAngle)/dT;
+		BatchFloat absBallPos = odoPos;
+		BatchFloat bodyPos = absBallPos + sensorAngle * CentreOfGravityHeight;
+		BatchFloat bodySpeed = (bodyPos - g.lastBodyPos)/dT;
+		BatchFloat bodyAccel = (bodySpeed - g.lastBodySpeed)/dT;
+
+		float targetBallPos = targetPos - targetAngle * CentreOfGravityHeight;
+		BatchFloat targetBallSpeed = (targetBallPos - g.lastTargetBallPos)/dT;
+
+		BatchFloat error_tilt = (sensorAngle - targetAngle);
+		error_tilt = error_tilt + sgnf(error_tilt)*absf(error_tilt*error_tilt*gradient);
+		BatchFloat error_angular_speed = (sensorAngularVelocity - targetAngularVelocity);
+
+		BatchFloat posError = (absBallPos - targetBallPos);
+		posError = fir(g.posFilter, g.posFilterIdx, posTaps, posNumTaps, posError);
+		posError = constrainf(posError,
+							-posErrorLimitAngle*g.angleWeight / g.ballPositionWeight,
+							+posErrorLimitAngle*g.angleWeight / g.ballPositionWeight);
+		BatchFloat posErrorIntegrated = g.posErrorIntegrated + posError*dT;
+		posErrorIntegrated = constrainf(posErrorIntegrated,
+							-posErrorLimitAngle*g.angleWeight / g.ballPosIntegratedWeight,
+							+posErrorLimitAngle*g.angleWeight / g.ballPosIntegratedWeight);
+		BatchFloat speedError = (bodySpeed - targetBallSpeed);
+		BatchFloat accelError = (bodyAccel - targetAccel);
+		float error_centripedal = targetOmega * targetSpeed;
+
+		BatchFloat error = + g.angleWeight*error_tilt + g.angularSpeedWeight*error_angular_speed
+				+ g.ballPositionWeight*posError + g.ballPosIntegratedWeight*posErrorIntegrated + g.ballVelocityWeight*speedError + + g.ballAccelWeight*accelError
+				+ g.omegaWeight * error_centripedal;
+
+		BatchFloat force = error;
+		BatchFloat accel = force / BallWeight;
+		accel = constrainf(accel, zero - MaxBotAccel, zero + MaxBotAccel);
+
+		BatchFloat speed = g.speed;
+		BatchInt accelerate = (sgnf(speed) != sgnf(accel)) | (absf(speed) < MaxBotSpeed);
+		BatchFloat newSpeed = speed + accel * dT;
+		newSpeed = constrainf(newSpeed, zero - MaxBotSpeed, zero + MaxBotSpeed);
+		speed = accelerate?newSpeed:speed;
+
+		BatchFloat filteredSpeed = fir(g.outputSpeedFilter, g.outputSpeedFilterIdx, outputSpeedTaps, outputSpeedNumTaps, speed);
+
+		// take over the new state for lanes that have not fallen yet
+		g.tilt = active?tilt:g.tilt;
+		g.tiltRate = active?tiltRate:g.tiltRate;
+		g.relSpeed = active?relSpeed:g.relSpeed;
+		g.odoPos = active?odoPos:g.odoPos;
+		g.lastTargetAngle = active?(zero + targetAngle):g.lastTargetAngle;
+		g.lastTargetBallPos = active?(zero + targetBallPos):g.lastTargetBallPos;
+		g.lastBodyPos = active?bodyPos:g.lastBodyPos;
+		g.lastBodySpeed = active?bodySpeed:g.lastBodySpeed;
+		g.posErrorIntegrated = active?posErrorIntegrated:g.posErrorIntegrated;
+		g.speed = active?speed:g.speed;
+		g.filteredSpeed = active?filteredSpeed:g.filteredSpeed;
+
+		BatchFloat absTilt = absf(tilt);
+		g.maxTilt = active?maxf(g.maxTilt, absTilt):g.maxTilt;
+		g.sumTiltSquare = active?(g.sumTiltSquare + tilt*tilt):g.sumTiltSquare;
+		g.maxPos = active?maxf(g.maxPos, absf(odoPos)):g.maxPos;
+		g.ticks -= active;
+		g.fallen |= active & (absTilt > MaxTiltAngle);
+	}
+}
+
+void BatchSimulator::run(float tilt, float duration, int threads) {
+	ticks = (int)(duration*SampleFrequency + 0.5);
+	int n = groups.size();
+	threads = constrain(threads, 1, max(n,1));
+	std::vector<std::thread> worker;
+	for (int w = 0;w<threads;w++) {
+		worker.push_back(std::thread([this, w, threads, n, tilt]() {
+			for (int i = w*n/threads;i<(w+1)*n/threads;i++) {
+				resetGroup(groups[i], tilt);
+				runGroup(groups[i], ticks);
+			}
+		}));
+	}
+	for (size_t w = 0;w<worker.size();w++)
+		worker[w].join();
+}
+
+BatchResult BatchSimulator::getResult(int i) {
+	Group& g = groups[i/BatchLanes];
+	int l = i % BatchLanes;
+	BatchResult result;
+	result.fallen = g.fallen[l] != 0;
+	result.duration = g.ticks[l]*SamplingTime;
+	result.maxTilt = lane(g.maxTilt, l);
+	result.rmsTilt = (g.ticks[l] > 0)?sqrt(lane(g.sumTiltSquare, l)/g.ticks[l]):0;
+	result.maxPos = lane(g.maxPos, l);
+	return result;
+}
+
+BatchLaneState BatchSimulator::getLaneState(int i) {
+	Group& g = groups[i/BatchLanes];
+	int l = i % BatchLanes;
+	BatchLaneState s;
+	s.tilt = g.tilt[l];
+	s.tiltRate = g.tiltRate[l];
+	s.relSpeed = g.relSpeed[l];
+	s.odoPos = g.odoPos[l];
+	s.speed = g.speed[l];
+	s.filteredSpeed = g.filteredSpeed[l];
+	s.posErrorIntegrated = g.posErrorIntegrated[l];
+	s.maxTilt = g.maxTilt[l];
+	s.sumTiltSquare = g.sumTiltSquare[l];
+	s.maxPos = g.maxPos[l];
+	s.ticks = g.ticks[l];
+	return s;
+}
+
+BatchLaneState BatchSimulator::runReference(int i, float tilt, float duration) {
+	const float dT = SamplingTime;
+	int ticks = (int)(duration*SampleFrequency + 0.5);
+	const StateControllerConfig& config = configs[i];
+	ControlPlane plane;
+	plane.reset();
+	State target;
+	State current;
+	IMUSamplePlane sensor;
+
+	BatchLaneState s;
+	s.tilt = tilt;
+	s.tiltRate = s.relSpeed = s.odoPos = 0;
+	s.maxTilt = s.sumTiltSquare = s.maxPos = 0;
+	s.ticks = 0;
+	for (int t = 0;t<ticks;t++) {
+		plant.simulate(dT, plane.filteredSpeed, s.tilt, s.tiltRate, s.relSpeed, s.odoPos);
+
+		sensor.angle = s.tilt;
+		sensor.angularVelocity = s.tiltRate;
+		current.pos = s.odoPos;
+		current.speed = s.relSpeed;
+		plane.update(false, dT, config, current, target, 0, 0, sensor);
+
+		s.maxTilt = max(s.maxTilt, abs(s.tilt));
+		s.sumTiltSquare = s.sumTiltSquare + s.tilt*s.tilt;
+		s.maxPos = max(s.maxPos, abs(s.odoPos));
+		s.ticks++;
+		if (abs(s.tilt) > MaxTiltAngle)
+			break;
+	}
+	s.speed = plane.speed;
+	s.filteredSpeed = plane.filteredSpeed;
+	s.posErrorIntegrated = plane.posErrorIntegrated;
+	return s;
+}
+
+bool BatchSimulator::verify(int i, float tilt, float duration) {
+	return runReference(i, tilt, duration) == getLaneState(i);
+}
@@ -0,0 +1,156 @@
+/*
+ * BatchSimulator.h
+ *
+ * Screens many configurations of the state controller at once. The maths of ControlPlane::update
+ * is re-implemented on vectors of BatchLanes floats (GCC vector extensions, compiled to AVX2,
+ * AVX-512 or NEON), each lane runs the x-plane of one configuration against a simplified plant,
+ * i.e. the linearized planar ballbot of BotModel with a lagging speed input instead of three
+ * wheels, and without the imperfections of the IMU and the drive (bias, latency, backlash). Data is kept as structure of arrays per group of BatchLanes configurations.
+ *
+ * The vector code performs the same float operations in the same order as the scalar code of
+ * ControlPlane::update, so results are identical to the bit. runReference() runs one
+ * configuration with the unmodified ControlPlane and the same plant, verify() compares both.
+ * This requires both to be compiled without contraction of multiply-add (-ffp-contract=off).
+ * Any change of ControlPlane::update needs to be done here as well, verify() tells.
+ *
+ * use:
+ * 		BatchSimulator batch;
+ * 		batch.setup(n);
+ * 		for (int i = 0;i<n;i++)
+ * 			batch.setConfig(i, config[i]);
+ * 		batch.run(radians(2), 5.0);
+ * 		batch.getResult(i);
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef BATCHSIMULATOR_H_
+#define BATCHSIMULATOR_H_
+
+#include <vector>
+#include <Arduino.h>
+#include <setup.h>
+#include <StateController.h>
+#include <BotModel.h>
+
+#if defined(__AVX512F__)
+const int BatchLanes = 16;
+#else
+const int BatchLanes = 8;
+#endif
+
+typedef float BatchFloat __attribute__((vector_size(BatchLanes*sizeof(float))));
+typedef int32_t BatchInt __attribute__((vector_size(BatchLanes*sizeof(int32_t))));
+
+// linearized planar ballbot (see BotModel), input is the speed set by the controller
+class BatchPlant {
+public:
+	static const int Substeps = 4;			// integration steps per tick
+
+	void setup(const BotModelParameters& parameters);
+
+	// integrate one tick of dT, T is float or BatchFloat
+	template<typename T> void simulate(float dT, const T& setSpeed,
+									   T& tilt, T& tiltRate, T& relSpeed, T& odoPos) const {
+		float h = dT/Substeps;
+		for (int i = 0;i<Substeps;i++) {
+			T relAccel = (setSpeed - relSpeed)*invMotorTimeConstant;
+			T tiltAccel = tilt*gravityGain - relAccel*inputGain;
+			tiltRate += tiltAccel*h;
+			tilt += tiltRate*h;
+			relSpeed += relAccel*h;
+			odoPos += relSpeed*h;
+		}
+	}
+private:
+	float invMotorTimeConstant = 0;
+	float gravityGain = 0;		// M·g·l/A
+	float inputGain = 0;		// B/(A·r)
+};
+
+// outcome of one configuration
+class BatchResult {
+public:
+	bool fallen = false;
+	float duration = 0;		// [s] until it fell or the end of the simulation
+	float maxTilt = 0;		// [rad]
+	float rmsTilt = 0;		// [rad]
+	float maxPos = 0;		// [m] max distance from the start
+};
+
+// state of one configuration at the end, used to compare with the reference
+class BatchLaneState {
+public:
+	bool operator==(const BatchLaneState& s) const;
+	void print() const;
+
+	float tilt, tiltRate, relSpeed, odoPos;
+	float speed, filteredSpeed, posErrorIntegrated;
+	float maxTilt, sumTiltSquare, maxPos;
+	int32_t ticks;
+};
+
+class BatchSimulator {
+public:
+	BatchSimulator() {};
+
+	// prepare n configurations, all set to the default values
+	void setup(int n, const BotModelParameters& parameters = BotModelParameters());
+	void setConfig(int i, const StateControllerConfig& config);
+	int size() { return candidates; };
+
+	// run all configurations for duration [s] starting at rest with the passed tilt.
+	// groups of configurations are distributed to threads
+	void run(float tilt, float duration, int threads = 1);
+
+	BatchResult getResult(int i);
+	BatchLaneState getLaneState(int i);
+
+	// run configuration i with the scalar ControlPlane::update
+	BatchLaneState runReference(int i, float tilt, float duration);
+
+	// true if the batch result of configuration i is identical to the scalar reference
+	bool verify(int i, float tilt, float duration);
+private:
+	static const int MaxTaps = 64;
+
+	struct Group {
+		// configuration
+		BatchFloat angleWeight, angularSpeedWeight, ballPositionWeight, ballPosIntegratedWeight;
+		BatchFloat ballVelocityWeight, ballAccelWeight, omegaWeight;
+
+		// plant
+		BatchFloat tilt, tiltRate, relSpeed, odoPos;
+
+		// ControlPlane
+		BatchFloat lastTargetAngle, lastTargetBallPos, lastBodyPos, lastBodySpeed;
+		BatchFloat posErrorIntegrated, speed, filteredSpeed;
+		BatchFloat posFilter[2*MaxTaps];		// ring buffers of the FIR filters
+		BatchFloat outputSpeedFilter[2*MaxTaps];
+		int posFilterIdx, outputSpeedFilterIdx;
+
+		// result
+		BatchFloat maxTilt, sumTiltSquare, maxPos;
+		BatchInt ticks;			// ticks until fallen
+		BatchInt fallen;		// -1 if fallen
+	};
+
+	void resetGroup(Group& g, float tilt);
+	void runGroup(Group& g, int ticks);
+	BatchFloat fir(BatchFloat* ring, int& idx, const float* taps, int numTaps, BatchFloat x);
+
+	BatchPlant plant;
+	std::vector<Group> groups;
+	std::vector<StateControllerConfig> configs;
+	int candidates = 0;
+	int ticks = 0;
+
+	// taps of the FIR filters of ControlPlane
+	float posTaps[MaxTaps];
+	float outputSpeedTaps[MaxTaps];
+	int posNumTaps = 0;
+	int outputSpeedNumTaps = 0;
+};
+
+#endif /* BATCHSIMULATOR_H_ */
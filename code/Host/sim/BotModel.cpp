@@ -0,0 +1,172 @@
+/*
+ * BotModel.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <BotModel.h>
+#include <Kinematics.h>
+#include <libraries/Util.h>
+
+void BotModel::setup(const BotModelParameters& parameters) {
+	param = parameters;
+	random.seed(param.seed);
+
+	// the forward kinematics without tilt is linear, get its matrix column by column.
+	// Use small speeds, since Kinematix complains about speeds exceeding MaxWheelSpeed
+	Kinematix kinematics;
+	kinematics.setup();
+	const float unit = 0.1;
+	float forward[3][3];
+	for (int j = 0;j<3;j++) {
+		float wheel[3];
+		kinematics.computeWheelSpeed((j==0)?unit:0, (j==1)?unit:0, (j==2)?unit:0, 0, 0, wheel);
+		for (int i = 0;i<3;i++)
+			forward[i][j] = wheel[i]*TWO_PI/unit;			// [rev/s] -> [rad/s]
+	}
+
+	float det = forward[0][0]*(forward[1][1]*forward[2][2] - forward[1][2]*forward[2][1])
+			  - forward[0][1]*(forward[1][0]*forward[2][2] - forward[1][2]*forward[2][0])
+			  + forward[0][2]*(forward[1][0]*forward[2][1] - forward[1][1]*forward[2][0]);
+	if (det == 0)
+		fatalError("kinematics not invertible");
+	for (int i = 0;i<3;i++)
+		for (int j = 0;j<3;j++) {
+			// cofactor of the transposed element
+			int r0 = (j+1)%3, r1 = (j+2)%3, c0 = (i+1)%3, c1 = (i+2)%3;
+			inverseKinematics[i][j] = (forward[r0][c0]*forward[r1][c1] - forward[r0][c1]*forward[r1][c0])/det;
+		}
+
+	reset(0,0);
+}
+
+void BotModel::reset(float tiltX, float tiltY) {
+	for (int i = 0;i<2;i++)
+		plane[i] = Plane();
+	plane[X].tilt = tiltX;
+	plane[Y].tilt = tiltY;
+	yaw = 0;
+	yawRate = 0;
+	for (int i = 0;i<3;i++) {
+		wheelSpeed[i] = 0;
+		wheelSpeedSetpoint[i] = 0;
+		wheelAngle[i] = 0;
+		wheelOutputAngle[i] = 0;
+		wheelEngaged[i] = true;
+	}
+	delayedSetpoints.clear();
+}
+
+void BotModel::setWheelSpeed(const float speed[3]) {
+	if (param.actuatorLatency <= 0) {
+		for (int i = 0;i<3;i++)
+			wheelSpeedSetpoint[i] = speed[i];
+		return;
+	}
+
+	// the latency is rounded to integration steps
+	DelayedSetpoint setpoint;
+	setpoint.steps = (int)(param.actuatorLatency/TimeStep + 0.5);
+	for (int i = 0;i<3;i++)
+		setpoint.wheelSpeed[i] = speed[i];
+	delayedSetpoints.push_back(setpoint);
+}
+
+void BotModel::simulate(float dT) {
+	int steps = (int)ceil(dT/TimeStep - 0.001);
+	float h = dT/steps;
+	for (int i = 0;i<steps;i++)
+		step(h);
+}
+
+void BotModel::step(float h) {
+	// set wheel speeds that passed the latency arrive at the motors
+	for (DelayedSetpoint& setpoint : delayedSetpoints)
+		setpoint.steps--;
+	while (!delayedSetpoints.empty() && (delayedSetpoints.front().steps <= 0)) {
+		for (int i = 0;i<3;i++)
+			wheelSpeedSetpoint[i] = delayedSetpoints.front().wheelSpeed[i];
+		delayedSetpoints.pop_front();
+	}
+
+	// motors follow their set speed with a lag and limited acceleration
+	float wheelAccel[3];			// [rad/s^2]
+	float wheelRate[3];				// [rad/s]
+	for (int i = 0;i<3;i++) {
+		float accel = (wheelSpeedSetpoint[i] - wheelSpeed[i])/param.motorTimeConstant;
+		accel = constrain(accel, -param.maxWheelAcceleration, param.maxWheelAcceleration);
+		wheelSpeed[i] += accel*h;
+		wheelAngle[i] += wheelSpeed[i]*TWO_PI*h;
+		wheelAccel[i] = accel*TWO_PI;
+		wheelRate[i] = wheelSpeed[i]*TWO_PI;
+
+		// the wheel stands still until the motor took up the play, then it is dragged along.
+		// Engaging changes the wheel's speed within one step, i.e. a large acceleration
+		float play = wheelAngle[i] - wheelOutputAngle[i];
+		bool engaged = (abs(play) >= param.backlash/2.0);
+		if (engaged) {
+			wheelOutputAngle[i] = wheelAngle[i] - sgn(play)*param.backlash/2.0;
+			if (!wheelEngaged[i])
+				wheelAccel[i] = wheelRate[i]/h;
+		} else {
+			wheelAccel[i] = 0;
+			wheelRate[i] = 0;
+		}
+		wheelEngaged[i] = engaged;
+	}
+
+	// movement of the ball relative to the body
+	float relSpeed[3], relAccel[3];
+	for (int i = 0;i<3;i++) {
+		relSpeed[i] = 0;
+		relAccel[i] = 0;
+		for (int j = 0;j<3;j++) {
+			relSpeed[i] += inverseKinematics[i][j]*wheelRate[j];
+			relAccel[i] += inverseKinematics[i][j]*wheelAccel[j];
+		}
+	}
+
+	const float M = param.bodyMass;
+	const float r = BallRadius;
+	const float l = param.centreOfGravityHeight - BallRadius;
+	const float Ia = 5.0/3.0*param.ballMass*r*r;
+	for (int d = 0;d<2;d++) {
+		Plane& p = plane[d];
+		float sinT = sin(p.tilt);
+		float cosT = cos(p.tilt);
+		float A = Ia + param.bodyInertia + M*(r*r + 2.0*r*l*cosT + l*l);
+		float B = Ia + M*r*(r + l*cosT);
+		float relAngularAccel = relAccel[d]/r;			// ψ''
+		float tiltAccel = (M*Gravity*l*sinT + M*r*l*sinT*p.tiltRate*p.tiltRate - B*relAngularAccel)/A;
+
+		// semi-implicit Euler
+		p.tiltRate += tiltAccel*h;
+		p.tilt += p.tiltRate*h;
+		p.ballRate = relSpeed[d]/r + p.tiltRate;		// φ' = ψ' + θ'
+		p.ballAngle += p.ballRate*h;
+	}
+	yawRate = relSpeed[2];
+	yaw += yawRate*h;
+}
+
+IMUSample BotModel::getIMUSample(uint32_t time_us) {
+	IMUSample sample;
+	for (int d = 0;d<2;d++) {
+		sample.plane[d].angle = plane[d].tilt + param.imuAngleBias[d] + param.imuAngleNoise*normal(random);
+		sample.plane[d].angularVelocity = plane[d].tiltRate + param.imuAngularVelocityBias[d] + param.imuAngularVelocityNoise*normal(random);
+	}
+	sample.plane[Z].angle = yaw;
+	sample.plane[Z].angularVelocity = yawRate;
+	sample.timestamp_us = time_us;
+	return sample;
+}
+
+void BotModel::getWheelAngle(float angle[3]) {
+	for (int i = 0;i<3;i++)
+		angle[i] = param.encoderDirection*wheelAngle[i];
+}
+
+bool BotModel::hasFallen() {
+	return (abs(plane[X].tilt) > MaxTiltAngle) || (abs(plane[Y].tilt) > MaxTiltAngle);
+}
@@ -0,0 +1,129 @@
+/*
+ * BotModel.h
+ *
+ * Rigid body model of the bot for the simulator: an inverted pendulum (the body) on a ball that
+ * is driven by three omni wheels. Each of the planes x and y is modelled separately as a planar
+ * ballbot with the tilt θ of the body and the rotation φ of the ball as degrees of freedom
+ * (Lagrange, ball rolls without slipping, body mass M in the centre of gravity at distance l
+ * from the ball's centre, ball mass m as a hollow sphere of radius r):
+ *
+ * 		A(θ)·θ'' = M·g·l·sin(θ) + M·r·l·sin(θ)·θ'² - B(θ)·ψ''
+ * 		A(θ) = Ia + I + M·(r² + 2·r·l·cos(θ) + l²)
+ * 		B(θ) = Ia + M·r·(r + l·cos(θ))
+ * 		φ = ψ + θ, ball position x = r·φ
+ *
+ * where ψ is the rotation of the ball relative to the body, Ia = 5/3·m·r² is the inertia of
+ * the ball around the touch point and I the inertia of the body around its centre of gravity.
+ * ψ is determined by the wheels, since the motors are speed controlled. Each wheel follows its
+ * set speed with a first order lag and a limited acceleration. The mapping of wheel speeds to
+ * the ball's movement relative to the body is the inverse of the forward kinematics of Kinematix
+ * without tilt, i.e. the geometry is the same as the bot controller assumes. The rotation of
+ * the body around z follows the wheels directly.
+ *
+ * Mechanical constants are those of setup.h. Ball mass and height of the centre of gravity can deviate from setup.h,
+ * since the controller is designed with setup.h's values. To check the robustness of the
+ * controller, the model can add imperfections of the real bot:
+ *  - noise and a constant bias of the IMU's angle (i.e. a wrong null offset) and angular velocity,
+ *  - latency between the controller setting the wheel speeds and the motors receiving them,
+ *  - backlash of the gear box: the encoders sit on the motors, the wheels follow the motors
+ *    only once the play is taken up.
+ *
+ * Kinematix::computeWheelSpeed negates the speed in x and y, but computeActualSpeed does not,
+ * so the odometry returns the right direction only if the encoders count against the set
+ * speed of the wheels. That's what the model does by default (encoderDirection).
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef BOTMODEL_H_
+#define BOTMODEL_H_
+
+#include <random>
+#include <deque>
+#include <Arduino.h>
+#include <setup.h>
+#include <IMUSample.h>
+
+class BotModelParameters {
+public:
+	float bodyMass = BodyWeight;			// [kg] 	everything but the ball
+	float bodyInertia = BodyInertia;		// [kg m^2] around the centre of gravity
+	float motorTimeConstant = 0.010;		// [s] 		lag of the speed control of the motors
+	float maxWheelAcceleration = 1000.0;	// [rev/s^2] as limited by BrushlessMotorDriver
+	float encoderDirection = -1.0;			// sign of the encoder angle relative to the set wheel speed
+	float imuAngleNoise = 0.0;				// [rad] 	standard deviation of the IMU's angle
+	float imuAngularVelocityNoise = 0.0;	// [rad/s] 	standard deviation of the IMU's angular velocity
+	float imuAngleBias[2] = { 0,0 };		// [rad] 	error of the null offset in x and y
+	float imuAngularVelocityBias[2] = { 0,0 };	// [rad/s] bias of the gyro in x and y
+	float ballMass = BallWeight;			// [kg]
+	float centreOfGravityHeight = CentreOfGravityHeight;	// [m] from ground
+	float actuatorLatency = 0.0;			// [s] 		until set wheel speeds reach the motors
+	float backlash = 0.0;					// [rad] 	play of the gear box at the wheel
+	uint32_t seed = 1;						// seed of the noise
+};
+
+class BotModel {
+public:
+	static constexpr float TimeStep = 0.0002;	// [s] integration step
+
+	BotModel() {};
+
+	void setup(const BotModelParameters& parameters);
+
+	// start at rest in the origin with the passed tilt
+	void reset(float tiltX /* [rad] */, float tiltY /* [rad] */);
+
+	// set speed of the wheels [rev/s], the motors follow with a lag
+	void setWheelSpeed(const float wheelSpeed[3]);
+
+	// move the model forward by dT [s]
+	void simulate(float dT);
+
+	// orientation as the IMU would measure it at this time
+	IMUSample getIMUSample(uint32_t time_us);
+
+	// integrated angle of the wheels [rad] as the encoders measure it
+	void getWheelAngle(float wheelAngle[3]);
+
+	float getTilt(int dim) { return plane[dim].tilt; };					// [rad]
+	float getTiltRate(int dim) { return plane[dim].tiltRate; };			// [rad/s]
+	float getBallPos(int dim) { return BallRadius*plane[dim].ballAngle; };	// [m]
+	float getBallSpeed(int dim) { return BallRadius*plane[dim].ballRate; };	// [m/s]
+	float getYaw() { return yaw; };										// [rad]
+
+	// true if the bot tilted so much that the controller cannot recover
+	bool hasFallen();
+private:
+	class Plane {
+	public:
+		float tilt = 0;			// θ  [rad]
+		float tiltRate = 0;		// θ' [rad/s]
+		float ballAngle = 0;	// φ  [rad]
+		float ballRate = 0;		// φ' [rad/s]
+	};
+
+	void step(float h);
+
+	BotModelParameters param;
+	Plane plane[2];
+	float yaw = 0;							// [rad]
+	float yawRate = 0;						// [rad/s]
+	float wheelSpeed[3] = { 0,0,0 };		// [rev/s]
+	float wheelSpeedSetpoint[3] = { 0,0,0 };
+	float wheelAngle[3] = { 0,0,0 };		// [rad] of the motors, i.e. as the encoders see it
+	float wheelOutputAngle[3] = { 0,0,0 };	// [rad] of the wheels, differs by the backlash
+	bool wheelEngaged[3] = { true, true, true };	// false while the play of the gear box is taken up
+
+	// set wheel speeds on their way to the motors, and the integration steps they still need
+	struct DelayedSetpoint {
+		int steps;
+		float wheelSpeed[3];
+	};
+	std::deque<DelayedSetpoint> delayedSetpoints;
+	float inverseKinematics[3][3];			// wheel speed [rad/s] -> speed of ball relative to body (x,y [m/s], omega [rad/s])
+	std::mt19937 random;
+	std::normal_distribution<float> normal;
+};
+
+#endif /* BOTMODEL_H_ */
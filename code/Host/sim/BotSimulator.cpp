@@ -0,0 +1,146 @@
+/*
+ * BotSimulator.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <mutex>
+#include <BotSimulator.h>
+#include <libraries/Util.h>
+
+// time of the simulator running in this thread, returned by millis() and micros()
+static thread_local uint64_t simulatedTime_us = 0;
+
+// Kinematix reports exceeding the max wheel speed as fatal error, count it instead of stopping
+static thread_local uint32_t fatalErrors = 0;
+
+void SimulationResult::reset() {
+	*this = SimulationResult();
+}
+
+void SimulationResult::print() const {
+	logging("duration=");
+	logging(duration,1);
+	logging("s ");
+	logging(fallen?"fallen":"balanced");
+	logging(" max tilt=");
+	logging(degrees(maxTilt),2);
+	logging("deg rms tilt=");
+	logging(degrees(rmsTilt),3);
+	logging("deg max distance=");
+	logging(maxDistance,3);
+	logging("m max wheel speed=");
+	logging(maxWheelSpeed,2);
+	logging("rev/s speed limit hits=");
+	logging(speedLimitHits);
+	logging(" settling time=");
+	logging(settlingTime,2);
+	logging("s saturation=");
+	logging(saturation*100.0,1);
+	loggingln("%");
+}
+
+void BotSimulator::setup(const StateControllerConfig& config, const BotModelParameters& parameters) {
+	// the clock and the hook are global, but refer to the thread's simulator
+	static std::once_flag hostSetup;
+	std::call_once(hostSetup, []() {
+		setHostClock([]() { return simulatedTime_us; });
+		setFatalErrorHook([](const char s[]) { fatalErrors++; });
+	});
+
+	this->config = config;
+	model.setup(parameters);
+	kinematics.setup();
+	odometry.setup(&kinematics);
+	menuController.setup();
+	state.setConfig(&this->config);
+	state.setup(&menuController);
+	reset(0,0);
+}
+
+void BotSimulator::reset(float tiltX, float tiltY) {
+	model.reset(tiltX, tiltY);
+	time_us = 0;
+	tickNo = 0;
+	simulatedTime_us = 0;
+
+	// same as BotController::balanceMode when balancing starts
+	state.reset();
+	currentMovement.reset();
+	targetMovement.reset();
+	odometry.reset(currentMovement);
+	for (int i = 0;i<3;i++) {
+		lastWheelAngle[i] = 0;
+		wheelSpeed[i] = 0;
+	}
+
+	result.reset();
+	sumTiltSquare = 0;
+	fatalErrors = 0;
+}
+
+void BotSimulator::tick() {
+	// compute the time out of the tick number, so it does not drift
+	tickNo++;
+	uint64_t now_us = tickNo*1000000/SampleFrequency;
+	float dT = (now_us - time_us)*OneMicrosecond_s;
+	time_us = now_us;
+	simulatedTime_us = now_us;
+
+	// the bot moves with the wheel speed of the previous tick
+	model.simulate(dT);
+
+	// same as BotController::balanceTask
+	sample = model.getIMUSample((uint32_t)now_us);
+
+	float wheelAngle[3];
+	float wheelAngleChange[3];
+	model.getWheelAngle(wheelAngle);
+	for (int i = 0;i<3;i++) {
+		wheelAngleChange[i] = wheelAngle[i] - lastWheelAngle[i];
+		lastWheelAngle[i] = wheelAngle[i];
+	}
+	odometry.update(dT, wheelAngleChange, sample, currentMovement);
+
+	state.update(dT, sample, currentMovement, targetMovement);
+
+	kinematics.computeWheelSpeed(state.getSpeedX() + excitation[X], state.getSpeedY() + excitation[Y], state.getOmega(),
+								 sample.plane[Dimension::X].angle, sample.plane[Dimension::Y].angle,
+								 wheelSpeed);
+	model.setWheelSpeed(wheelSpeed);
+
+	updateResult();
+}
+
+void BotSimulator::updateResult() {
+	float tiltX = model.getTilt(X);
+	float tiltY = model.getTilt(Y);
+	result.ticks++;
+	result.duration = getTime();
+	result.maxTilt = max(result.maxTilt, max(abs(tiltX), abs(tiltY)));
+	sumTiltSquare += tiltX*tiltX + tiltY*tiltY;
+	result.rmsTilt = sqrt(sumTiltSquare/result.ticks);
+	result.maxDistance = max(result.maxDistance, hypot(model.getBallPos(X), model.getBallPos(Y)));
+	for (int i = 0;i<3;i++)
+		result.maxWheelSpeed = max(result.maxWheelSpeed, abs(wheelSpeed[i]));
+	if (max(abs(tiltX), abs(tiltY)) > SettledTilt)
+		result.settlingTime = getTime();
+
+	// controller at its limits, or the kinematics had to reduce the wheel speed
+	bool saturated = (abs(state.getPlaneX().accel) >= MaxBotAccel) || (abs(state.getPlaneY().accel) >= MaxBotAccel) ||
+					 (abs(state.getPlaneX().speed) >= MaxBotSpeed) || (abs(state.getPlaneY().speed) >= MaxBotSpeed) ||
+					 (fatalErrors > result.speedLimitHits);
+	if (saturated)
+		result.saturatedTicks++;
+	result.saturation = (float)result.saturatedTicks/result.ticks;
+	result.speedLimitHits = fatalErrors;
+	result.fallen = result.fallen || model.hasFallen();
+}
+
+const SimulationResult& BotSimulator::run(float duration) {
+	uint64_t end_us = time_us + (uint64_t)(duration*1000000.0);
+	while ((time_us < end_us) && !model.hasFallen())
+		tick();
+	return result;
+}
@@ -0,0 +1,108 @@
+/*
+ * BotSimulator.h
+ *
+ * Closed loop of the bot model and the unmodified control code of the bot controller. Every
+ * tick does what BotController::balanceTask does: read the IMU sample, compute the current
+ * movement out of the wheel angles (Odometry), call StateController::update and compute the
+ * wheel speeds with Kinematix. The model then runs with these wheel speeds until the next tick.
+ *
+ * Time is simulated, i.e. millis() and micros() return the simulated time while a simulator
+ * runs in this thread. Each simulator has its own StateControllerConfig, so several
+ * simulators with different configurations can run in parallel threads.
+ *
+ * use:
+ * 		BotSimulator sim;
+ * 		sim.setup(config, parameters);
+ * 		sim.reset(radians(2), 0);
+ * 		while (sim.getTime() < 10.0 && !sim.getModel().hasFallen())
+ * 			sim.tick();
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef BOTSIMULATOR_H_
+#define BOTSIMULATOR_H_
+
+#include <BotModel.h>
+#include <StateController.h>
+#include <Kinematics.h>
+#include <Odometry.h>
+#include <libraries/MenuController.h>
+
+// statistics of one simulation
+class SimulationResult {
+public:
+	void reset();
+	void print() const;
+
+	float duration = 0;				// [s] simulated time
+	bool fallen = false;			// bot tilted over
+	float maxTilt = 0;				// [rad] max tilt in any plane
+	float rmsTilt = 0;				// [rad] root mean square of tilt in x and y
+	float maxDistance = 0;			// [m] max distance from the origin
+	float maxWheelSpeed = 0;		// [rev/s] max wheel speed set by the controller
+	uint32_t speedLimitHits = 0;	// number of times the kinematics limited the wheel speed
+	float settlingTime = 0;			// [s] time after which the tilt stays below SettledTilt
+	float saturation = 0;			// share of ticks with the controller's output at its limit
+	uint32_t saturatedTicks = 0;
+	uint32_t ticks = 0;
+};
+
+class BotSimulator {
+public:
+	static constexpr float SettledTilt = radians(0.5);	// [rad] tilt that counts as settled
+
+	BotSimulator() {};
+
+	void setup(const StateControllerConfig& config, const BotModelParameters& parameters);
+
+	// start a new simulation with the bot at rest with the passed tilt
+	void reset(float tiltX /* [rad] */, float tiltY /* [rad] */);
+
+	// movement the bot should do, like BotController::setTarget
+	void setTarget(const BotMovement& target) { targetMovement = target; };
+
+	// speed [m/s] added to the output of the state controller before the kinematics, i.e. to the
+	// input of the bot. Used to excite the loop when measuring its frequency response
+	void setExcitation(float speedX, float speedY) { excitation[X] = speedX; excitation[Y] = speedY; };
+
+	// one balancing tick of 1/SampleFrequency
+	void tick();
+
+	// run until duration [s] passed or the bot has fallen
+	const SimulationResult& run(float duration);
+
+	float getTime() { return time_us*OneMicrosecond_s; };	// [s] since reset
+	BotModel& getModel() { return model; };
+	StateController& getStateController() { return state; };
+	StateControllerConfig& getConfig() { return config; };
+	const BotMovement& getCurrentMovement() { return currentMovement; };
+	const BotMovement& getTarget() { return targetMovement; };
+	const IMUSample& getSample() { return sample; };
+	const float* getWheelSpeed() { return wheelSpeed; };		// [rev/s] as set by the controller
+	const SimulationResult& getResult() { return result; };
+private:
+	void updateResult();
+
+	BotModel model;
+	StateControllerConfig config;
+	MenuController menuController;
+	StateController state;
+	Kinematix kinematics;
+	Odometry odometry;
+
+	BotMovement currentMovement;
+	BotMovement targetMovement;
+	IMUSample sample;
+	float lastWheelAngle[3] = { 0,0,0 };
+	float wheelSpeed[3] = { 0,0,0 };
+	float excitation[2] = { 0,0 };
+	uint64_t tickNo = 0;
+	uint64_t time_us = 0;
+
+	SimulationResult result;
+	double sumTiltSquare = 0;
+};
+
+#endif /* BOTSIMULATOR_H_ */
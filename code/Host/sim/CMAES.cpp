@@ -0,0 +1,173 @@
+/*
+ * CMAES.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <CMAES.h>
+
+// eigen decomposition of a symmetric matrix by Jacobi rotations, A = V·diag(d)·V^T
+static void jacobiEigen(std::vector<std::vector<double>> A, std::vector<std::vector<double>>& V, std::vector<double>& d) {
+	int n = A.size();
+	V.assign(n, std::vector<double>(n, 0));
+	for (int i = 0;i<n;i++)
+		V[i][i] = 1;
+	for (int sweep = 0;sweep<100;sweep++) {
+		double off = 0;
+		for (int p = 0;p<n;p++)
+			for (int q = p+1;q<n;q++)
+				off += A[p][q]*A[p][q];
+		if (off < 1e-30)
+			break;
+		for (int p = 0;p<n;p++)
+			for (int q = p+1;q<n;q++) {
+				if (fabs(A[p][q]) < 1e-300)
+					continue;
+				double theta = (A[q][q] - A[p][p])/(2*A[p][q]);
+				double t = ((theta >= 0)?1.0:-1.0)/(fabs(theta) + sqrt(theta*theta + 1));
+				double c = 1/sqrt(t*t + 1);
+				double s = t*c;
+				for (int k = 0;k<n;k++) {
+					double akp = A[k][p], akq = A[k][q];
+					A[k][p] = c*akp - s*akq;
+					A[k][q] = s*akp + c*akq;
+				}
+				for (int k = 0;k<n;k++) {
+					double apk = A[p][k], aqk = A[q][k];
+					A[p][k] = c*apk - s*aqk;
+					A[q][k] = s*apk + c*aqk;
+				}
+				for (int k = 0;k<n;k++) {
+					double vkp = V[k][p], vkq = V[k][q];
+					V[k][p] = c*vkp - s*vkq;
+					V[k][q] = s*vkp + c*vkq;
+				}
+			}
+	}
+	d.resize(n);
+	for (int i = 0;i<n;i++)
+		d[i] = A[i][i];
+}
+
+void CMAES::setup(const Vector& start, double startSigma, int populationSize, uint32_t seed) {
+	n = start.size();
+	lambda = (populationSize > 0)?populationSize:(4 + (int)(3*log(n)));
+	mu = lambda/2;
+	weights.resize(mu);
+	double sum = 0, sumSquare = 0;
+	for (int i = 0;i<mu;i++) {
+		weights[i] = log(mu + 0.5) - log(i + 1.0);
+		sum += weights[i];
+	}
+	for (int i = 0;i<mu;i++) {
+		weights[i] /= sum;
+		sumSquare += weights[i]*weights[i];
+	}
+	mueff = 1.0/sumSquare;
+
+	// default strategy parameters
+	cc = (4.0 + mueff/n)/(n + 4.0 + 2.0*mueff/n);
+	cs = (mueff + 2.0)/(n + mueff + 5.0);
+	c1 = 2.0/((n + 1.3)*(n + 1.3) + mueff);
+	cmu = std::min(1.0 - c1, 2.0*(mueff - 2.0 + 1.0/mueff)/((n + 2.0)*(n + 2.0) + mueff));
+	damps = 1.0 + 2.0*std::max(0.0, sqrt((mueff - 1.0)/(n + 1.0)) - 1.0) + cs;
+	chiN = sqrt(n)*(1.0 - 1.0/(4.0*n) + 1.0/(21.0*n*n));
+
+	mean = start;
+	sigma = startSigma;
+	pc.assign(n, 0);
+	ps.assign(n, 0);
+	C.assign(n, Vector(n, 0));
+	for (int i = 0;i<n;i++)
+		C[i][i] = 1;
+	B = C;
+	D.assign(n, 1);
+	generation = 0;
+	random.seed(seed);
+	population.assign(lambda, Vector(n, 0));
+}
+
+void CMAES::decompose() {
+	// enforce symmetry against rounding errors
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<i;j++)
+			C[i][j] = C[j][i] = (C[i][j] + C[j][i])/2;
+	jacobiEigen(C, B, D);
+	for (int i = 0;i<n;i++)
+		D[i] = sqrt(std::max(D[i], 1e-20));
+}
+
+const std::vector<CMAES::Vector>& CMAES::ask() {
+	decompose();
+	for (int k = 0;k<lambda;k++) {
+		Vector z(n);
+		for (int i = 0;i<n;i++)
+			z[i] = D[i]*normal(random);
+		for (int i = 0;i<n;i++) {
+			double y = 0;
+			for (int j = 0;j<n;j++)
+				y += B[i][j]*z[j];
+			population[k][i] = mean[i] + sigma*y;
+		}
+	}
+	return population;
+}
+
+void CMAES::tell(const std::vector<double>& cost) {
+	std::vector<int> order(lambda);
+	for (int i = 0;i<lambda;i++)
+		order[i] = i;
+	std::sort(order.begin(), order.end(), [&cost](int a, int b) { return cost[a] < cost[b]; });
+
+	// recombination of the best mu
+	Vector oldMean = mean;
+	for (int i = 0;i<n;i++) {
+		mean[i] = 0;
+		for (int k = 0;k<mu;k++)
+			mean[i] += weights[k]*population[order[k]][i];
+	}
+	Vector y(n);
+	for (int i = 0;i<n;i++)
+		y[i] = (mean[i] - oldMean[i])/sigma;
+
+	// evolution path of sigma with C^(-1/2)·y = B·D^-1·B^T·y
+	Vector t(n);
+	for (int i = 0;i<n;i++) {
+		t[i] = 0;
+		for (int j = 0;j<n;j++)
+			t[i] += B[j][i]*y[j];
+		t[i] /= D[i];
+	}
+	double psNorm = 0;
+	for (int i = 0;i<n;i++) {
+		double invSqrtCy = 0;
+		for (int j = 0;j<n;j++)
+			invSqrtCy += B[i][j]*t[j];
+		ps[i] = (1.0 - cs)*ps[i] + sqrt(cs*(2.0 - cs)*mueff)*invSqrtCy;
+		psNorm += ps[i]*ps[i];
+	}
+	psNorm = sqrt(psNorm);
+	generation++;
+	bool hsig = psNorm/sqrt(1.0 - pow(1.0 - cs, 2.0*generation))/chiN < 1.4 + 2.0/(n + 1.0);
+
+	// evolution path of C, rank-one and rank-mu update
+	for (int i = 0;i<n;i++)
+		pc[i] = (1.0 - cc)*pc[i] + (hsig?sqrt(cc*(2.0 - cc)*mueff):0.0)*y[i];
+	for (int i = 0;i<n;i++)
+		for (int j = 0;j<=i;j++) {
+			double rankMu = 0;
+			for (int k = 0;k<mu;k++) {
+				const Vector& x = population[order[k]];
+				rankMu += weights[k]*(x[i] - oldMean[i])*(x[j] - oldMean[j])/(sigma*sigma);
+			}
+			C[i][j] = (1.0 - c1 - cmu)*C[i][j]
+					+ c1*(pc[i]*pc[j] + (hsig?0.0:cc*(2.0 - cc)*C[i][j]))
+					+ cmu*rankMu;
+			C[j][i] = C[i][j];
+		}
+
+	sigma *= exp((cs/damps)*(psNorm/chiN - 1.0));
+}
@@ -0,0 +1,72 @@
+/*
+ * CMAES.h
+ *
+ * Covariance matrix adaptation evolution strategy (Hansen), (μ/μw, λ) with rank-one and
+ * rank-μ update of the covariance and cumulative step size adaptation. Minimizes a cost
+ * function of a few parameters without gradients, the cost may be noisy.
+ *
+ * use:
+ * 		CMAES cmaes;
+ * 		cmaes.setup(start, 0.3);
+ * 		for (int g = 0;g<generations;g++) {
+ * 			const std::vector<std::vector<double>>& population = cmaes.ask();
+ * 			<compute cost[i] of population[i]>
+ * 			cmaes.tell(cost);
+ * 		}
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef CMAES_H_
+#define CMAES_H_
+
+#include <random>
+#include <vector>
+#include <stdint.h>
+
+class CMAES {
+public:
+	typedef std::vector<double> Vector;
+
+	CMAES() {};
+
+	// start at mean with step size sigma, lambda = 0 takes the default population size 4+3ln(n)
+	void setup(const Vector& mean, double sigma, int lambda = 0, uint32_t seed = 1);
+
+	// sample a new population
+	const std::vector<Vector>& ask();
+
+	// pass the cost of each candidate of the last population, lower is better
+	void tell(const std::vector<double>& cost);
+
+	const Vector& getMean() { return mean; };
+	double getSigma() { return sigma; };
+	int getLambda() { return lambda; };
+	int getGeneration() { return generation; };
+private:
+	typedef std::vector<Vector> Matrix;
+
+	// C = B·diag(D²)·B^T
+	void decompose();
+
+	int n = 0;
+	int lambda = 0;
+	int mu = 0;
+	Vector weights;
+	double mueff = 0;
+	double cc = 0, cs = 0, c1 = 0, cmu = 0, damps = 0, chiN = 0;
+
+	Vector mean;
+	double sigma = 0;
+	Vector pc, ps;
+	Matrix C, B;
+	Vector D;
+	int generation = 0;
+
+	std::vector<Vector> population;
+	std::mt19937 random;
+	std::normal_distribution<double> normal;
+};
+
+#endif /* CMAES_H_ */
@@ -0,0 +1,47 @@
+/*
+ * InstructionCounter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <InstructionCounter.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+InstructionCounter::~InstructionCounter() {
+	if (fd >= 0)
+		close(fd);
+}
+
+bool InstructionCounter::setup() {
+	if (fd >= 0)
+		return true;
+
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+	attr.exclude_kernel = 1;			// allowed without privileges
+	attr.exclude_hv = 1;
+	attr.disabled = 1;
+
+	// this thread on any cpu, there is no glibc wrapper of perf_event_open
+	fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if (fd < 0)
+		return false;
+	ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	return true;
+}
+
+uint64_t InstructionCounter::read() {
+	uint64_t count = 0;
+	if ((fd < 0) || (::read(fd, &count, sizeof(count)) != sizeof(count)))
+		return 0;
+	return count;
+}
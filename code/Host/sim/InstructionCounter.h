@@ -0,0 +1,41 @@
+/*
+ * InstructionCounter.h
+ *
+ * Counts the instructions this thread executes in user space with the performance counters
+ * of the CPU (Linux perf events). Unlike the wall time, the number of instructions of a
+ * deterministic piece of code hardly varies between runs, so it shows small changes of the
+ * cost of the control code reliably. Not available in some virtual machines or with
+ * kernel.perf_event_paranoid > 2, then setup returns false and read returns 0.
+ *
+ * use:
+ * 		InstructionCounter counter;
+ * 		counter.setup();
+ * 		uint64_t start = counter.read();
+ * 		...
+ * 		uint64_t instructions = counter.read() - start;
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef INSTRUCTIONCOUNTER_H_
+#define INSTRUCTIONCOUNTER_H_
+
+#include <stdint.h>
+
+class InstructionCounter {
+public:
+	InstructionCounter() {};
+	~InstructionCounter();
+
+	// open the counter of this thread, returns false if there is none
+	bool setup();
+	bool isAvailable() { return fd >= 0; };
+
+	// instructions since setup
+	uint64_t read();
+private:
+	int fd = -1;
+};
+
+#endif /* INSTRUCTIONCOUNTER_H_ */
@@ -0,0 +1,180 @@
+/*
+ * SensorReplay.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <mutex>
+#include <SensorReplay.h>
+#include <MicroClock.h>
+#include <Profiler.h>
+#include <libraries/Util.h>
+#include <Telemetry.h>
+
+// time of the tick that is replayed, returned by millis() and micros()
+static uint64_t replayTime_us = 0;
+
+// Kinematix reports exceeding the max wheel speed as fatal error, count it instead of stopping
+static uint32_t fatalErrors = 0;
+
+const char* SensorReplay::OutputName[NumberOfOutputs] = {
+		"tilt_x", "tilt_y", "rate_x", "rate_y", "pos_x", "pos_y", "speed_x", "speed_y",
+		"out_speed_x", "out_speed_y", "out_omega", "wheel0", "wheel1", "wheel2" };
+
+void readSensorRecording(FILE* in, std::vector<SensorRecordingRun>& runs, SensorRecordingStatistics& stat) {
+	uint8_t encoded[telemetryFrameSize<SensorRecordingHeader>()];
+	size_t len = 0;
+	bool overflow = false;
+	int c;
+	while ((c = fgetc(in)) != EOF) {
+		if (c != 0) {
+			if (len < sizeof(encoded))
+				encoded[len++] = c;
+			else
+				overflow = true;
+			continue;
+		}
+		if ((len > 0) && !overflow) {
+			stat.frames++;
+			SensorRecordingHeader header;
+			SensorRecordingSample sample;
+			SensorRecordingTarget target;
+			if (telemetryDecodeFrame(encoded, len, header) && (header.type == SENSOR_RECORD_HEADER)) {
+				runs.push_back(SensorRecordingRun());
+				runs.back().header = header;
+			} else if (telemetryDecodeFrame(encoded, len, sample) && (sample.type == SENSOR_RECORD_SAMPLE)) {
+				if (runs.empty())
+					stat.orphans++;
+				else {
+					SensorRecordingRun& run = runs.back();
+					if (!run.samples.empty() && ((uint16_t)(run.samples.back().sequence + 1) != sample.sequence))
+						run.gaps++;
+					run.samples.push_back(sample);
+				}
+			} else if (telemetryDecodeFrame(encoded, len, target) && (target.type == SENSOR_RECORD_TARGET)) {
+				if (!runs.empty())
+					runs.back().targets.push_back(std::make_pair(runs.back().samples.size(), target));
+			} else
+				stat.other++;
+		}
+		len = 0;
+		overflow = false;
+	}
+}
+
+bool SensorReplay::setup(const SensorRecordingHeader& header) {
+	if ((header.type != SENSOR_RECORD_HEADER) || (header.version != SensorRecordingVersion) ||
+		(header.layoutVersion != PersistentMemLayoutVersion))
+		return false;
+
+	static std::once_flag hostSetup;
+	std::call_once(hostSetup, []() {
+		setHostClock([]() { return replayTime_us; });
+		setFatalErrorHook([](const char s[]) { fatalErrors++; });
+	});
+	fatalErrors = 0;
+	replayTime_us = header.odometryUpdate_us;
+
+	// configuration as it was on the bot, the replay does not log
+	memcpy(&memory.persistentMem, header.persistentMem, sizeof(memory.persistentMem));
+	memory.persistentMem.logConfig.null();
+
+	// same as BallDrive::setup and BotController::setup
+	kinematics.setup();
+	odometry.setup(&kinematics);
+	menuController.setup();
+	state.setup(&menuController);
+
+	// state of the IMU before the first recorded tick
+	frontend.setup(header.imuCalibration, &memory.persistentMem.imuControllerConfig);
+	frontend.setState(header.kalman);
+	for (int i = 0;i<3;i++) {
+		imuSample.plane[i].angle = header.imuSample[i][0];
+		imuSample.plane[i].angularVelocity = header.imuSample[i][1];
+	}
+	imuDT = header.imuDT;
+	imuUpdate_us = header.imuUpdate_us;
+
+	// same as BotController::balanceMode when balancing starts
+	odometryUpdate_us = header.odometryUpdate_us;
+	for (int i = 0;i<3;i++) {
+		lastWheelAngle[i] = header.lastWheelAngle[i];
+		reverse[i] = header.reverse[i];
+		wheelSpeed[i] = 0;
+	}
+	state.reset();
+	currentMovement.reset();
+	targetMovement.reset();
+	return true;
+}
+
+void SensorReplay::setTarget(const SensorRecordingTarget& target) {
+	State* plane[2] = { &targetMovement.x, &targetMovement.y };
+	for (int i = 0;i<2;i++) {
+		plane[i]->pos = target.state[i][0];
+		plane[i]->speed = target.state[i][1];
+		plane[i]->accel = target.state[i][2];
+	}
+	targetMovement.omega = target.omega;
+}
+
+void SensorReplay::tick(const SensorRecordingSample& sample) {
+	replayTime_us = sample.tick_us;
+
+	// same as IMU::loop, if the IMU delivered a new sample in this tick
+	if (sample.imuUpdated) {
+		uint32_t sampleTime_us = sample.tick_us - imuUpdate_us;
+		imuDT = ((float)(sampleTime_us))/1000000.0;
+		imuUpdate_us = sample.tick_us;
+		imuSample.timestamp_us = sample.timestamp_us;
+		ProfileScope scope(PROFILE_KALMAN);
+		frontend.update(sample.accel, sample.gyro, imuDT, imuSample);
+	}
+
+	updateOdometry(sample);
+
+	// same as BotController::balanceTask
+	state.update(imuDT, imuSample, currentMovement, targetMovement);
+	{
+		ProfileScope scope(PROFILE_KINEMATICS);
+		kinematics.computeWheelSpeed(state.getSpeedX(), state.getSpeedY(), state.getOmega(),
+									 imuSample.plane[Dimension::X].angle, imuSample.plane[Dimension::Y].angle,
+									 wheelSpeed);
+	}
+}
+
+// same as BallDrive::getSpeed, the times are the low words of the bot's clock
+void SensorReplay::updateOdometry(const SensorRecordingSample& sample) {
+	ProfileScope scope(PROFILE_GET_SPEED);
+
+	if (sample.tick_us != odometryUpdate_us) {
+		float dT = MicroClock::seconds((uint32_t)(sample.tick_us - odometryUpdate_us));
+		odometryUpdate_us = sample.tick_us;
+
+		const MotorConfig& motorConfig = memory.persistentMem.motorControllerConfig;
+		float wheelAngleChange[3];
+		for (int i = 0;i<3;i++) {
+			float angle = wheelAngleFromEncoder(sample.encoder[i], motorConfig.phaseAAngle[i], reverse[i]);
+			wheelAngleChange[i] = angle - lastWheelAngle[i];
+			lastWheelAngle[i] = angle;
+		}
+		odometry.update(dT, wheelAngleChange, imuSample, currentMovement);
+	} else
+		odometry.reset(currentMovement);
+}
+
+uint32_t SensorReplay::getSpeedLimitHits() {
+	return fatalErrors;
+}
+
+void SensorReplay::getOutput(float output[NumberOfOutputs]) {
+	float values[NumberOfOutputs] = {
+			imuSample.plane[X].angle, imuSample.plane[Y].angle,
+			imuSample.plane[X].angularVelocity, imuSample.plane[Y].angularVelocity,
+			currentMovement.x.pos, currentMovement.y.pos, currentMovement.x.speed, currentMovement.y.speed,
+			state.getSpeedX(), state.getSpeedY(), state.getOmega(),
+			wheelSpeed[0], wheelSpeed[1], wheelSpeed[2] };
+	for (int i = 0;i<NumberOfOutputs;i++)
+		output[i] = values[i];
+}
@@ -0,0 +1,96 @@
+/*
+ * SensorReplay.h
+ *
+ * Repeats a balancing run of the bot out of its sensor recording (see SensorRecording.h). Every
+ * tick does what BotController::balanceTask does with the recorded raw readings: the IMU's
+ * counts go through the same frontend and Kalman filters as in IMU::loop, the encoder counts
+ * through the same conversion as in BallDrive::getSpeed, then StateController::update and
+ * Kinematix compute the wheel speeds. Starting with the state of the header, the replay
+ * computes the same values as the bot did, to the bit as long as the host's libm rounds
+ * atan2 and sqrt like the Teensy's.
+ *
+ * The replay uses the global persistent memory, so there is only one replay at a time.
+ *
+ * use:
+ * 		SensorReplay replay;
+ * 		replay.setup(header);
+ * 		replay.setTarget(target);		// for each target record
+ * 		replay.tick(sample);			// for each sample record
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef SENSORREPLAY_H_
+#define SENSORREPLAY_H_
+
+#include <stdio.h>
+#include <vector>
+#include <SensorRecording.h>
+#include <SensorFrontend.h>
+#include <StateController.h>
+#include <Kinematics.h>
+#include <Odometry.h>
+#include <libraries/MenuController.h>
+
+// one balancing run of a sensor recording, i.e. a header and everything up to the next header
+struct SensorRecordingRun {
+	SensorRecordingHeader header;
+	std::vector<SensorRecordingSample> samples;
+	std::vector<std::pair<size_t, SensorRecordingTarget>> targets;	// valid from the sample with this index on
+	uint32_t gaps = 0;			// samples missing according to the sequence number
+};
+
+struct SensorRecordingStatistics {
+	uint32_t frames = 0;
+	uint32_t other = 0;			// corrupt or telemetry frames
+	uint32_t orphans = 0;		// samples without a header before
+};
+
+// split a sensor recording into its balancing runs
+void readSensorRecording(FILE* in, std::vector<SensorRecordingRun>& runs, SensorRecordingStatistics& stat);
+
+class SensorReplay {
+public:
+	// values computed in a tick, used to trace and compare replays
+	static const int NumberOfOutputs = 14;
+	static const char* OutputName[NumberOfOutputs];
+
+	SensorReplay() {};
+
+	// start where the recording started, returns false if the recording does not fit to this build
+	bool setup(const SensorRecordingHeader& header);
+
+	void setTarget(const SensorRecordingTarget& target);
+
+	// one balancing tick
+	void tick(const SensorRecordingSample& sample);
+
+	const IMUSample& getSample() { return imuSample; };
+	const BotMovement& getCurrentMovement() { return currentMovement; };
+	StateController& getStateController() { return state; };
+	const float* getWheelSpeed() { return wheelSpeed; };		// [rev/s] as set by the controller
+	uint32_t getSpeedLimitHits();								// wheel speeds limited by the kinematics
+	void getOutput(float output[NumberOfOutputs]);
+private:
+	void updateOdometry(const SensorRecordingSample& sample);
+
+	IMUFrontend frontend;
+	MenuController menuController;
+	StateController state;
+	Kinematix kinematics;
+	Odometry odometry;
+
+	IMUSample imuSample;
+	float imuDT = 0;
+	uint32_t imuUpdate_us = 0;
+	uint32_t odometryUpdate_us = 0;
+	float lastWheelAngle[3] = { 0,0,0 };
+	bool reverse[3] = { false, false, false };
+
+	BotMovement currentMovement;
+	BotMovement targetMovement;
+	float wheelSpeed[3] = { 0,0,0 };
+};
+
+#endif /* SENSORREPLAY_H_ */
@@ -0,0 +1,135 @@
+/*
+ * SensorSynthesizer.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <SensorSynthesizer.h>
+#include <Telemetry.h>
+#include <MotorConfig.h>
+#include <Encoder/AS5047D.h>
+
+const float IMUGravity = 9.807;				// [m/s^2] as used by the MPU9250 library
+const bool ReverseDirection = true;				// all motors are reversed, see Engine::setup
+
+IMUCalibration SensorSynthesizer::defaultCalibration() {
+	IMUCalibration c;
+	const int16_t transform[3][3] = { { 0, 1, 0 }, { 1, 0, 0 }, { 0, 0, -1 } };
+	for (int i = 0;i<3;i++) {
+		for (int j = 0;j<3;j++)
+			c.transform[i][j] = transform[i][j];
+		c.accelBias[i] = 0;
+		c.accelScaleFactor[i] = 1.0;
+		c.gyroBias[i] = 0;
+	}
+	c.accelScale = IMUGravity*2.0f/32767.5f;
+	c.gyroScale = 250.0f/32767.5f*DEG_TO_RAD;
+	return c;
+}
+
+template<typename Record> void SensorSynthesizer::write(const Record& record) {
+	uint8_t frame[telemetryFrameSize<Record>()];
+	size_t len = telemetryEncodeFrame(record, frame);
+	fwrite(frame, 1, len, out);
+}
+
+// inverse of wheelAngleFromEncoder
+int32_t SensorSynthesizer::encoderCounts(float wheelAngle, int wheelNo) {
+	float phaseAAngle = memory.persistentMem.motorControllerConfig.phaseAAngle[wheelNo];
+	float motorAngle = (ReverseDirection?-1.0:1.0)*wheelAngle/GearBoxRatio + phaseAAngle;
+	return (int32_t)lround(motorAngle/TWO_PI*AS5047D::resolution);
+}
+
+static int16_t saturatedCounts(float value, float scale) {
+	return (int16_t)constrain(lround(value/scale), -32768L, 32767L);
+}
+
+void SensorSynthesizer::start(FILE* newOut, BotSimulator& sim) {
+	out = newOut;
+	calibration = defaultCalibration();
+	sequence = 0;
+
+	SensorRecordingHeader header;
+	memset(&header, 0, sizeof(header));
+	header.type = SENSOR_RECORD_HEADER;
+	header.version = SensorRecordingVersion;
+	header.layoutVersion = PersistentMemLayoutVersion;
+	memcpy(header.persistentMem, &memory.persistentMem, sizeof(header.persistentMem));
+	header.imuCalibration = calibration;
+
+	// the Kalman filters have settled at the initial tilt
+	for (int i = 0;i<2;i++) {
+		header.kalman[i][0] = sim.getModel().getTilt(i);
+		header.imuSample[i][0] = sim.getModel().getTilt(i);
+	}
+	header.imuDT = SamplingTime;
+	float wheelAngle[3];
+	sim.getModel().getWheelAngle(wheelAngle);
+	for (int i = 0;i<3;i++) {
+		header.reverse[i] = ReverseDirection;
+		header.lastWheelAngle[i] = wheelAngleFromEncoder(encoderCounts(wheelAngle[i], i),
+				memory.persistentMem.motorControllerConfig.phaseAAngle[i], ReverseDirection);
+	}
+	write(header);
+	writeTarget(sim.getTarget());
+}
+
+// same as BotController::sendSensorTarget
+void SensorSynthesizer::writeTarget(const BotMovement& target) {
+	SensorRecordingTarget record;
+	memset(&record, 0, sizeof(record));
+	record.type = SENSOR_RECORD_TARGET;
+	const State* plane[2] = { &target.x, &target.y };
+	for (int i = 0;i<2;i++) {
+		record.state[i][0] = plane[i]->pos;
+		record.state[i][1] = plane[i]->speed;
+		record.state[i][2] = plane[i]->accel;
+	}
+	record.omega = target.omega;
+	recordedTarget = target;
+	write(record);
+}
+
+void SensorSynthesizer::record(BotSimulator& sim) {
+	// the target is recorded only when it changes, like in BotController::recordSensors
+	const BotMovement& t = sim.getTarget();
+	const BotMovement& r = recordedTarget;
+	if ((t.x.pos != r.x.pos) || (t.x.speed != r.x.speed) || (t.x.accel != r.x.accel) ||
+		(t.y.pos != r.y.pos) || (t.y.speed != r.y.speed) || (t.y.accel != r.y.accel) ||
+		(t.omega != r.omega))
+		writeTarget(t);
+
+	SensorRecordingSample sample;
+	sample.type = SENSOR_RECORD_SAMPLE;
+	sample.imuUpdated = 1;
+	sample.sequence = sequence++;
+	sample.tick_us = (uint32_t)(sim.getTime()*1000000.0 + 0.5);
+	sample.timestamp_us = sim.getSample().timestamp_us;
+
+	// gravity in the IMU's coordinate system, inverse of IMUFrontend::update
+	// the frontend subtracts the null offset of the IMU
+	const IMUSample& s = sim.getSample();
+	const IMUConfig& imuConfig = memory.persistentMem.imuControllerConfig;
+	float sinX = sin(s.plane[X].angle + imuConfig.nullOffsetX);
+	float sinY = sin(s.plane[Y].angle + imuConfig.nullOffsetY);
+	float accel[3] = { IMUGravity*sinX, -IMUGravity*sinY, IMUGravity*sqrt(max(0.0f, 1.0f - sinX*sinX - sinY*sinY)) };
+	float gyro[3] = { s.plane[Y].angularVelocity, s.plane[X].angularVelocity, s.plane[Z].angularVelocity };
+	for (int i = 0;i<3;i++) {
+		// the transformation is a permutation with signs, i.e. its own inverse
+		float a = 0;
+		float g = 0;
+		for (int j = 0;j<3;j++) {
+			a += calibration.transform[j][i]*accel[j];
+			g += calibration.transform[j][i]*gyro[j];
+		}
+		sample.accel[i] = saturatedCounts(a, calibration.accelScale);
+		sample.gyro[i] = saturatedCounts(g, calibration.gyroScale);
+	}
+
+	float wheelAngle[3];
+	sim.getModel().getWheelAngle(wheelAngle);
+	for (int i = 0;i<3;i++)
+		sample.encoder[i] = encoderCounts(wheelAngle[i], i);
+	write(sample);
+}
@@ -0,0 +1,51 @@
+/*
+ * SensorSynthesizer.h
+ *
+ * Writes a sensor recording (see SensorRecording.h) of a simulation, as if the bot had recorded
+ * it: the orientation of the model is turned into the counts of an MPU9250 that is set up
+ * like IMU::init does, the wheel angles into the counts of the AS5047D encoders. This gives
+ * input traces for sensor_replay and golden_trace without the bot.
+ *
+ * use:
+ * 		sim.reset(tiltX, tiltY);
+ * 		synthesizer.start(file, sim);
+ * 		while (...) {
+ * 			sim.tick();
+ * 			synthesizer.record(sim);
+ * 		}
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef SENSORSYNTHESIZER_H_
+#define SENSORSYNTHESIZER_H_
+
+#include <stdio.h>
+#include <BotSimulator.h>
+#include <SensorRecording.h>
+
+class SensorSynthesizer {
+public:
+	SensorSynthesizer() {};
+
+	// calibration of the MPU9250 with +/-2g and +/-250deg/s and no bias, like IMU::init
+	static IMUCalibration defaultCalibration();
+
+	// write the header, the simulation has just been reset
+	void start(FILE* out, BotSimulator& sim);
+
+	// write a sample of the current tick of the simulation
+	void record(BotSimulator& sim);
+private:
+	template<typename Record> void write(const Record& record);
+	int32_t encoderCounts(float wheelAngle /* [rad] */, int wheelNo);
+	void writeTarget(const BotMovement& target);
+
+	FILE* out = NULL;
+	IMUCalibration calibration;
+	uint16_t sequence = 0;
+	BotMovement recordedTarget;		// target as of the last target record
+};
+
+#endif /* SENSORSYNTHESIZER_H_ */
@@ -0,0 +1,100 @@
+/*
+ * WorkStealingPool.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <WorkStealingPool.h>
+
+thread_local int WorkStealingPool::workerIndex = -1;
+thread_local WorkStealingPool* WorkStealingPool::workerPool = NULL;
+
+WorkStealingPool::WorkStealingPool(int threads)
+	: queued(0), unfinished(0), nextQueue(0), steals(0) {
+	if (threads <= 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	for (int i = 0;i<threads;i++)
+		queues.push_back(std::unique_ptr<Queue>(new Queue()));
+	for (int i = 0;i<threads;i++)
+		workers.push_back(std::thread(&WorkStealingPool::work, this, i));
+}
+
+WorkStealingPool::~WorkStealingPool() {
+	wait();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	taskAvailable.notify_all();
+	for (size_t i = 0;i<workers.size();i++)
+		workers[i].join();
+}
+
+void WorkStealingPool::submit(Task task) {
+	int q = (workerPool == this)?workerIndex:(int)(nextQueue++ % queues.size());
+	unfinished++;
+	{
+		std::lock_guard<std::mutex> lock(queues[q]->mutex);
+		queues[q]->tasks.push_back(std::move(task));
+	}
+	{
+		// increase under the lock, so a worker going to sleep does not miss it
+		std::lock_guard<std::mutex> lock(mutex);
+		queued++;
+	}
+	taskAvailable.notify_one();
+}
+
+void WorkStealingPool::wait() {
+	std::unique_lock<std::mutex> lock(mutex);
+	allDone.wait(lock, [this]() { return unfinished == 0; });
+}
+
+bool WorkStealingPool::pop(int self, Task& task) {
+	Queue& q = *queues[self];
+	std::lock_guard<std::mutex> lock(q.mutex);
+	if (q.tasks.empty())
+		return false;
+	task = std::move(q.tasks.back());
+	q.tasks.pop_back();
+	return true;
+}
+
+bool WorkStealingPool::steal(int self, Task& task) {
+	int n = queues.size();
+	for (int i = 1;i<n;i++) {
+		Queue& q = *queues[(self + i) % n];
+		std::lock_guard<std::mutex> lock(q.mutex);
+		if (!q.tasks.empty()) {
+			task = std::move(q.tasks.front());
+			q.tasks.pop_front();
+			steals++;
+			return true;
+		}
+	}
+	return false;
+}
+
+void WorkStealingPool::work(int self) {
+	workerIndex = self;
+	workerPool = this;
+	while (true) {
+		Task task;
+		if (pop(self, task) || steal(self, task)) {
+			queued--;
+			task();
+			if (--unfinished == 0) {
+				std::lock_guard<std::mutex> lock(mutex);
+				allDone.notify_all();
+			}
+			continue;
+		}
+
+		// nothing to do, sleep until something is submitted
+		std::unique_lock<std::mutex> lock(mutex);
+		taskAvailable.wait(lock, [this]() { return stop || (queued > 0); });
+		if (stop)
+			return;
+	}
+}
@@ -0,0 +1,75 @@
+/*
+ * WorkStealingPool.h
+ *
+ * Thread pool with one task queue per worker. A worker takes tasks from the back of its own
+ * queue and steals from the front of the other queues when its own queue is empty, so tasks of
+ * different length (e.g. simulations that end early when the bot falls) keep all cores busy.
+ * Tasks submitted from outside are distributed round robin, tasks submitted by a worker go to
+ * its own queue.
+ *
+ * use:
+ * 		WorkStealingPool pool;				// one worker per core
+ * 		for (int i = 0;i<n;i++)
+ * 			pool.submit([i]() { work(i); });
+ * 		pool.wait();						// until all tasks are done
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef WORKSTEALINGPOOL_H_
+#define WORKSTEALINGPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+	typedef std::function<void()> Task;
+
+	// threads = 0 means one per core
+	WorkStealingPool(int threads = 0);
+	~WorkStealingPool();
+
+	void submit(Task task);
+
+	// block until all submitted tasks are done
+	void wait();
+
+	int size() { return workers.size(); };
+
+	// number of tasks a worker took from another worker's queue
+	uint64_t getSteals() { return steals; };
+private:
+	struct Queue {
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	void work(int self);
+	bool pop(int self, Task& task);
+	bool steal(int self, Task& task);
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> workers;
+
+	std::mutex mutex;						// protects sleeping and waiting
+	std::condition_variable taskAvailable;
+	std::condition_variable allDone;
+	std::atomic<int> queued;				// tasks in all queues
+	std::atomic<int> unfinished;			// tasks submitted but not yet done
+	std::atomic<uint32_t> nextQueue;
+	std::atomic<uint64_t> steals;
+	bool stop = false;
+
+	static thread_local int workerIndex;	// index of the current worker, -1 outside of the pool
+	static thread_local WorkStealingPool* workerPool;
+};
+
+#endif /* WORKSTEALINGPOOL_H_ */
@@ -0,0 +1,54 @@
+/*
+ * HostTest.h
+ *
+ * Minimal checks for the host tests. Each test is an executable registered with ctest that
+ * prints every failed check and returns non-zero if any check failed.
+ *
+ * use:
+ *     CHECK(scheduler.loop());
+ *     CHECK_EQUAL(task.overruns, 1u);
+ *     return testResult("task_scheduler");
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+
+#include <stdio.h>
+#include <sstream>
+
+#define CHECK(condition) checkTrue((condition), #condition, __FILE__, __LINE__)
+#define CHECK_EQUAL(actual, expected) checkEqual((actual), (expected), #actual, __FILE__, __LINE__)
+
+inline int& testFailures() {
+	static int failures = 0;
+	return failures;
+}
+
+inline bool checkTrue(bool ok, const char* condition, const char* file, int line) {
+	if (!ok) {
+		fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+		testFailures()++;
+	}
+	return ok;
+}
+
+template<class A, class E> bool checkEqual(const A& actual, const E& expected, const char* name, const char* file, int line) {
+	if (actual == expected)
+		return true;
+	std::ostringstream s;
+	s << name << " is " << actual << ", expected " << expected;
+	fprintf(stderr, "%s:%d: check failed: %s\n", file, line, s.str().c_str());
+	testFailures()++;
+	return false;
+}
+
+// to be returned by main
+inline int testResult(const char* name) {
+	printf("%s: %s\n", name, (testFailures() == 0)?"passed":"FAILED");
+	return (testFailures() == 0)?0:1;
+}
+
+#endif /* HOSTTEST_H_ */
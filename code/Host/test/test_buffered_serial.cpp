@@ -0,0 +1,170 @@
+/*
+ * test_buffered_serial.cpp
+ *
+ * Buffering logic of BufferedSerial over a host stand-in of the UART that accepts a limited
+ * number of bytes per call: both policies, the wrap of the ring buffer, the drop counters, and
+ * writes of an interrupt that lands while the buffer is sending.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <HostTest.h>
+#include <libraries/BufferedSerial.h>
+
+// UART that accepts bytesPerCall bytes every time it is asked for space, and keeps what was sent
+class SinkStream : public Stream {
+public:
+	virtual size_t write(uint8_t c) { return write(&c, 1); };
+	virtual size_t write(const uint8_t* buffer, size_t size) {
+		sent.append((const char*)buffer, size);
+
+		// an interrupt that lands while the buffer is sending and writes itself
+		if (interrupt != NULL) {
+			BufferedSerial* serial = interrupt;
+			interrupt = NULL;
+			interruptResult = serial->write((const uint8_t*)interruptText.data(), interruptText.size());
+		}
+		return size;
+	};
+	using Print::write;
+	virtual int availableForWrite() { return bytesPerCall; };
+	virtual int available() { return 0; };
+	virtual int read() { return -1; };
+	virtual int peek() { return -1; };
+
+	int bytesPerCall = 16;
+	std::string sent;
+
+	BufferedSerial* interrupt = NULL;		// re-enter write of this serial once with interruptText
+	std::string interruptText;
+	size_t interruptResult = 0;
+};
+
+// distinguishable content of the given length
+static std::string pattern(int len, char first) {
+	std::string s;
+	for (int i = 0;i<len;i++)
+		s += (char)(first + i % 23);
+	return s;
+}
+
+static void testBlocking() {
+	SinkStream sink;
+	BufferedSerial* serial = new BufferedSerial(sink);
+
+	// short print, this is what happens first at boot
+	CHECK_EQUAL(serial->print("hello"), (size_t)5);
+	CHECK_EQUAL(serial->availableForWrite(), BufferedSerial::TxBufferSize - 1 - 5);
+	serial->flush();
+	CHECK_EQUAL(sink.sent, std::string("hello"));
+
+	// a write larger than the buffer waits for the UART, nothing is lost
+	std::string text = pattern(3*BufferedSerial::TxBufferSize + 17, 'a');
+	sink.sent.clear();
+	CHECK_EQUAL(serial->write((const uint8_t*)text.data(), text.size()), text.size());
+	serial->flush();
+	CHECK(sink.sent == text);
+	CHECK_EQUAL(serial->getDroppedWrites(), 0u);
+	CHECK_EQUAL(serial->getMaxUsed(), BufferedSerial::TxBufferSize - 1);
+	delete serial;
+}
+
+static void testDropping() {
+	SinkStream sink;
+	sink.bytesPerCall = 0;
+	BufferedSerial* serial = new BufferedSerial(sink);
+	serial->setPolicy(BufferedSerial::DROP_ON_FULL);
+
+	std::string first = pattern(BufferedSerial::TxBufferSize - 100, 'a');
+	std::string second = pattern(99, 'A');
+	std::string third = pattern(10, '0');
+	CHECK_EQUAL(serial->write((const uint8_t*)first.data(), first.size()), first.size());
+	CHECK_EQUAL(serial->write((const uint8_t*)second.data(), second.size()), second.size());
+	CHECK_EQUAL(serial->availableForWrite(), 0);
+
+	// the UART is stuck, further writes are dropped as a whole
+	CHECK_EQUAL(serial->write((const uint8_t*)third.data(), third.size()), (size_t)0);
+	CHECK_EQUAL(serial->print('x'), (size_t)0);
+	CHECK_EQUAL(serial->getDroppedWrites(), 2u);
+	CHECK_EQUAL(serial->getDroppedBytes(), 11u);
+	CHECK_EQUAL(serial->getMaxUsed(), BufferedSerial::TxBufferSize - 1);
+
+	// the UART continues with what has been buffered
+	sink.bytesPerCall = 1000;
+	serial->flush();
+	CHECK(sink.sent == first + second);
+
+	serial->resetStatistics();
+	CHECK_EQUAL(serial->getDroppedWrites(), 0u);
+	CHECK_EQUAL(serial->getDroppedBytes(), 0u);
+	CHECK_EQUAL(serial->getMaxUsed(), 0);
+	delete serial;
+}
+
+static void testWrapAround() {
+	SinkStream sink;
+	sink.bytesPerCall = 100;
+	BufferedSerial* serial = new BufferedSerial(sink);
+	serial->setPolicy(BufferedSerial::DROP_ON_FULL);
+
+	// every write but the first one crosses the end of the ring buffer at some point
+	std::string expected;
+	for (int i = 0;i<10;i++) {
+		std::string text = pattern(BufferedSerial::TxBufferSize/3 + i, 'a' + i);
+		CHECK_EQUAL(serial->write((const uint8_t*)text.data(), text.size()), text.size());
+		expected += text;
+
+		// one loop sends at most what the UART accepts
+		size_t before = sink.sent.size();
+		serial->loop();
+		CHECK_EQUAL(sink.sent.size() - before, (size_t)100);
+		serial->flush();
+	}
+	CHECK(sink.sent == expected);
+	CHECK_EQUAL(serial->getDroppedWrites(), 0u);
+	CHECK_EQUAL(serial->availableForWrite(), BufferedSerial::TxBufferSize - 1);
+	delete serial;
+}
+
+static void testInterrupt() {
+	SinkStream sink;
+	sink.bytesPerCall = 100;
+	BufferedSerial* serial = new BufferedSerial(sink);
+
+	// an interrupt during loop() is queued behind what is in the buffer, loop() does not send it twice
+	std::string text = pattern(250, 'a');
+	CHECK_EQUAL(serial->write((const uint8_t*)text.data(), text.size()), text.size());
+	sink.interrupt = serial;
+	sink.interruptText = "i2cRec";
+	serial->loop();
+	CHECK_EQUAL(sink.interruptResult, (size_t)6);
+	CHECK_EQUAL(sink.sent.size(), (size_t)100);
+	serial->flush();
+	CHECK(sink.sent == text + "i2cRec");
+
+	// with a full buffer an interrupt neither waits nor sends, even when blocking
+	sink.sent.clear();
+	sink.bytesPerCall = 10;
+	std::string full = pattern(BufferedSerial::TxBufferSize - 1, 'A');
+	CHECK_EQUAL(serial->write((const uint8_t*)full.data(), full.size()), full.size());
+	sink.interrupt = serial;
+	sink.interruptText = pattern(20, '0');
+	serial->loop();
+	CHECK_EQUAL(sink.interruptResult, (size_t)0);
+	CHECK_EQUAL(serial->getDroppedWrites(), 1u);
+	CHECK_EQUAL(serial->getDroppedBytes(), 20u);
+	CHECK_EQUAL(sink.sent.size(), (size_t)10);
+	sink.bytesPerCall = 1000;
+	serial->flush();
+	CHECK(sink.sent == full);
+	delete serial;
+}
+
+int main() {
+	testBlocking();
+	testDropping();
+	testWrapAround();
+	testInterrupt();
+	return testResult("buffered_serial");
+}
@@ -0,0 +1,81 @@
+/*
+ * test_load_governor.cpp
+ *
+ * Feeds the LoadGovernor with windows of a given load: tiers are escalated one at a time after
+ * their dwell time only, and given back after the recovery windows.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <HostTest.h>
+#include <LoadGovernor.h>
+
+const uint32_t Window_us = 3000;
+
+static uint64_t now_us = Window_us;
+static uint64_t busy_us = 0;
+
+// run one window with the given ratio of busy time, returns the tier afterwards
+static LoadTier runWindow(LoadGovernor& governor, float load) {
+	now_us += Window_us;
+	busy_us += (uint64_t)(load*Window_us);
+	governor.update(now_us, busy_us);
+	return governor.getTier();
+}
+
+// number of windows with the given load until the tier changes
+static int windowsUntilChange(LoadGovernor& governor, float load, int maxWindows) {
+	LoadTier tier = governor.getTier();
+	for (int i = 1;i<=maxWindows;i++)
+		if (runWindow(governor, load) != tier)
+			return i;
+	return -1;
+}
+
+static void testEscalation() {
+	LoadGovernor governor;
+	governor.setup(Window_us);
+	governor.setDwell(LOAD_SHED_DEBUG_LOG, 400000);
+	governor.setDwell(LOAD_SHED_MEMORY, 200000);
+	governor.update(now_us, busy_us);
+
+	// the filtered slack drops below LowSlack after a few windows of full load
+	int windows = windowsUntilChange(governor, 1.0, 100);
+	CHECK(windows > 0);
+	CHECK(windows < 10);
+	CHECK_EQUAL(governor.getTier(), LOAD_SHED_DEBUG_LOG);
+
+	// the next tiers are entered after the dwell of the current one only
+	CHECK_EQUAL(windowsUntilChange(governor, 1.0, 1000), (int)(400000/Window_us) + 1);
+	CHECK_EQUAL(governor.getTier(), LOAD_SHED_MEMORY);
+	CHECK_EQUAL(windowsUntilChange(governor, 1.0, 1000), (int)(200000/Window_us) + 1);
+	CHECK_EQUAL(governor.getTier(), LOAD_SHED_LIFTER);
+	CHECK_EQUAL(windowsUntilChange(governor, 1.0, 1000), -1);
+}
+
+static void testRecovery() {
+	LoadGovernor governor;
+	governor.setup(Window_us);
+	governor.setDwell(LOAD_SHED_DEBUG_LOG, 30000);
+	governor.update(now_us, busy_us);
+	CHECK(windowsUntilChange(governor, 1.0, 100) > 0);
+	CHECK(windowsUntilChange(governor, 1.0, 100) > 0);
+	CHECK_EQUAL(governor.getTier(), LOAD_SHED_MEMORY);
+
+	// low load gives back one tier per RecoveryWindows, after the slack has been filtered up
+	int windows = windowsUntilChange(governor, 0.0, 1000);
+	CHECK(windows >= governor.RecoveryWindows);
+	CHECK_EQUAL(governor.getTier(), LOAD_SHED_DEBUG_LOG);
+	CHECK_EQUAL(windowsUntilChange(governor, 0.0, 1000), governor.RecoveryWindows);
+	CHECK_EQUAL(governor.getTier(), LOAD_NORMAL);
+
+	// medium load keeps the tier
+	CHECK_EQUAL(windowsUntilChange(governor, 0.7, 1000), -1);
+}
+
+int main() {
+	testEscalation();
+	testRecovery();
+	return testResult("load_governor");
+}
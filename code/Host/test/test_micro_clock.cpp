@@ -0,0 +1,93 @@
+/*
+ * test_micro_clock.cpp
+ *
+ * Timing maths across the wrap of the 32 bit clocks: the 64 bit extension of MicroClock,
+ * TimePassedBy with uint32 milliseconds, and the dT of the commutation of the brushless motors.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <HostTest.h>
+#include <MicroClock.h>
+#include <TimePassedBy.h>
+#include <BrushlessMotorDriver.h>
+
+static uint32_t fakeMicros = 0;
+static uint32_t fakeSource() { return fakeMicros; }
+
+const uint64_t Wrap_us = ((uint64_t)1) << 32;
+
+static void testWrapExtension() {
+	MicroClock::setSource(fakeSource);
+	fakeMicros = 0xFFFFFF00;
+	uint64_t before_us = MicroClock::now_us();
+	CHECK_EQUAL(before_us, (uint64_t)0xFFFFFF00);
+
+	// the source wraps, the 64 bit time goes on
+	fakeMicros = 0x100;
+	uint64_t after_us = MicroClock::now_us();
+	CHECK_EQUAL(after_us, Wrap_us + 0x100);
+	CHECK_EQUAL(after_us - before_us, (uint64_t)0x200);
+	CHECK(fabs(MicroClock::seconds(after_us - before_us) - 512.0e-6) < 1.0e-9);
+
+	// the same value again is not a wrap
+	CHECK_EQUAL(MicroClock::now_us(), Wrap_us + 0x100);
+
+	// second wrap
+	fakeMicros = 0xFFFFFFFF;
+	MicroClock::now_us();
+	fakeMicros = 0;
+	CHECK_EQUAL(MicroClock::now_us(), 2*Wrap_us);
+
+	// a new source starts over
+	MicroClock::setSource(fakeSource);
+	fakeMicros = 5;
+	CHECK_EQUAL(MicroClock::now_us(), (uint64_t)5);
+}
+
+static void testTimePassedBy() {
+	TimePassedBy timer(100);
+
+	// due 16ms before the wrap of millis()
+	timer.setDueTime(0xFFFFFFF0);
+	uint32_t passed_ms = 0;
+	CHECK(!timer.isDue_ms(100, passed_ms, 0xFFFFFFEF));
+	CHECK(timer.isDue_ms(100, passed_ms, 0xFFFFFFF0));
+	CHECK_EQUAL(passed_ms, 100u);
+
+	// next due time is behind the wrap
+	CHECK(!timer.isDue_ms(100, passed_ms, 0x10));
+	CHECK_EQUAL(passed_ms, 0x20u);
+	CHECK(!timer.isDue_ms(100, passed_ms, 0x53));
+	CHECK(timer.isDue_ms(100, passed_ms, 0x54));
+	CHECK_EQUAL(passed_ms, 100u);
+	CHECK_EQUAL(timer.mLastCall_ms, 0x54u);
+}
+
+static void testCommutationDT() {
+	const uint32_t Period_us = 1000000/MaxBrushlessDriverFrequency;
+
+	// commutation is accepted from half of the period on
+	CHECK_EQUAL(BrushlessMotorDriver::commutationDT(Period_us/2 - 1, 0), 0.0f);
+	CHECK(fabs(BrushlessMotorDriver::commutationDT(Period_us/2, 0) - Period_us/2*1.0e-6) < 1.0e-9);
+
+	// the dT has microsecond resolution across the wrap of the source
+	MicroClock::setSource(fakeSource);
+	fakeMicros = 0xFFFFFFFF - 200;
+	uint64_t last_us = MicroClock::now_us();
+	fakeMicros = 300 - 1;
+	uint64_t now_us = MicroClock::now_us();
+	CHECK(fabs(BrushlessMotorDriver::commutationDT(now_us, last_us) - 500.0e-6) < 1.0e-9);
+	fakeMicros = 1234;
+	now_us = MicroClock::now_us();
+	CHECK(fabs(BrushlessMotorDriver::commutationDT(now_us, last_us) - 1435.0e-6) < 1.0e-9);
+	CHECK_EQUAL(BrushlessMotorDriver::commutationDT(last_us + Period_us/2 - 1, last_us), 0.0f);
+}
+
+int main() {
+	testWrapExtension();
+	testTimePassedBy();
+	testCommutationDT();
+	return testResult("micro_clock");
+}
@@ -0,0 +1,130 @@
+/*
+ * test_task_scheduler.cpp
+ *
+ * Drives the TaskScheduler with a fake clock: priority order of due tasks, periods,
+ * missed deadlines and budget overruns. Tasks advance the fake clock by their execution time.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <HostTest.h>
+#include <libraries/TaskScheduler.h>
+
+static uint64_t fakeTime_us = 0;
+static uint64_t fakeClock() { return fakeTime_us; }
+
+// execution log of the tasks, one character per invocation
+static std::string executed;
+static uint32_t duration_us[3] = { 0, 0, 0 };
+
+static void runTask(int id, uint64_t now_us) {
+	executed += (char)('a' + id);
+	fakeTime_us = now_us + duration_us[id];
+}
+
+static void setupScheduler(TaskScheduler& scheduler) {
+	fakeTime_us = 0;
+	executed.clear();
+	for (int i = 0;i<3;i++)
+		duration_us[i] = 0;
+	scheduler.setup(fakeClock);
+
+	// registered in the reverse order of their priority
+	scheduler.addTask("a", 5000, 5, 1000, [](uint64_t now_us) { runTask(0, now_us); });
+	scheduler.addTask("b", 2000, 1, 300, [](uint64_t now_us) { runTask(1, now_us); });
+	scheduler.addTask("c", 1000, 0, 500, [](uint64_t now_us) { runTask(2, now_us); });
+}
+
+// run the scheduler until there is nothing due anymore
+static void runDue(TaskScheduler& scheduler) {
+	while (scheduler.loop())
+		;
+}
+
+static void testPriority() {
+	TaskScheduler scheduler;
+	setupScheduler(scheduler);
+
+	// all tasks are due at the start, one task per loop, the most important first
+	CHECK(scheduler.loop());
+	CHECK_EQUAL(executed, std::string("c"));
+	runDue(scheduler);
+	CHECK_EQUAL(executed, std::string("cba"));
+	CHECK(!scheduler.loop());
+}
+
+static void testPeriod() {
+	TaskScheduler scheduler;
+	setupScheduler(scheduler);
+
+	for (fakeTime_us = 0;fakeTime_us<10000;fakeTime_us += 100) {
+		uint64_t now_us = fakeTime_us;
+		runDue(scheduler);
+		fakeTime_us = now_us;
+	}
+	CHECK_EQUAL(scheduler.getTask(2).executions, 10u);
+	CHECK_EQUAL(scheduler.getTask(1).executions, 5u);
+	CHECK_EQUAL(scheduler.getTask(0).executions, 2u);
+	CHECK_EQUAL(scheduler.getTask(2).nextDue_us, 10000u);
+	for (int i = 0;i<3;i++) {
+		CHECK_EQUAL(scheduler.getTask(i).deadlineMisses, 0u);
+		CHECK_EQUAL(scheduler.getTask(i).overruns, 0u);
+	}
+
+	// a new period takes effect after the next execution
+	scheduler.setPeriod(2, 4000);
+	fakeTime_us = 10000;
+	runDue(scheduler);
+	CHECK_EQUAL(scheduler.getTask(2).nextDue_us, 14000u);
+}
+
+static void testDeadlineMiss() {
+	TaskScheduler scheduler;
+	setupScheduler(scheduler);
+	runDue(scheduler);
+
+	// late by less than a period keeps the phase
+	fakeTime_us = 1400;
+	runDue(scheduler);
+	CHECK_EQUAL(scheduler.getTask(2).deadlineMisses, 0u);
+	CHECK_EQUAL(scheduler.getTask(2).nextDue_us, 2000u);
+
+	// a complete period missed restarts from now without catching up
+	fakeTime_us = 3500;
+	runDue(scheduler);
+	CHECK_EQUAL(scheduler.getTask(2).deadlineMisses, 1u);
+	CHECK_EQUAL(scheduler.getTask(2).executions, 3u);
+	CHECK_EQUAL(scheduler.getTask(2).nextDue_us, 4500u);
+	CHECK_EQUAL(scheduler.getTask(1).deadlineMisses, 0u);
+}
+
+static void testOverrun() {
+	TaskScheduler scheduler;
+	setupScheduler(scheduler);
+	duration_us[2] = 600;
+	duration_us[1] = 300;
+	runDue(scheduler);
+
+	CHECK_EQUAL(scheduler.getTask(2).overruns, 1u);
+	CHECK_EQUAL(scheduler.getTask(2).maxDuration_us, 600u);
+	CHECK_EQUAL(scheduler.getTask(1).overruns, 0u);
+	CHECK_EQUAL(scheduler.getTask(1).lastDuration_us, 300u);
+	CHECK_EQUAL(scheduler.getBusyTime(), 900u);
+
+	// the overrun delayed the low priority task, not the next period of the important one
+	CHECK_EQUAL(scheduler.getTask(2).nextDue_us, 1000u);
+	CHECK_EQUAL(scheduler.getTask(0).executions, 1u);
+
+	scheduler.resetStatistics();
+	CHECK_EQUAL(scheduler.getTask(2).overruns, 0u);
+	CHECK_EQUAL(scheduler.getTask(2).maxDuration_us, 0u);
+}
+
+int main() {
+	testPriority();
+	testPeriod();
+	testDeadlineMiss();
+	testOverrun();
+	return testResult("task_scheduler");
+}
@@ -0,0 +1,238 @@
+/*
+ * autotune.cpp
+ *
+ * Offline tuning of the state controller's weights. CMA-ES proposes a population of weights per
+ * generation, every candidate is simulated in several scenarios on all cores (work stealing
+ * pool), and scored by settling time, tilt rms and saturation of the controller. The best
+ * weights are written as EEPROM image, i.e. the magic number followed by the persistentMem
+ * block of BotMemory, with all other configurations at their default values.
+ *
+ * use:
+ *     autotune [-g generations] [-l lambda] [-j threads] [-s seed] [-t seconds] [-o eeprom.bin]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+#include <BotSimulator.h>
+#include <BotMemory.h>
+#include <HostConsole.h>
+#include <EEPROM.h>
+#include <CMAES.h>
+#include <WorkStealingPool.h>
+
+// the image is a plain copy of the RAM block, no pointers or vtables allowed in there
+static_assert(std::is_trivially_copyable<decltype(memory.persistentMem)>::value,
+		"persistentMem must be trivially copyable to be written as EEPROM image");
+
+// the tuned weights, optimised in log space since all of them are positive
+const int NumberOfWeights = 5;
+static const char* WeightName[NumberOfWeights] = { "angle", "angularSpeed", "pos", "posIntegrated", "velocity" };
+
+static float* weight(StateControllerConfig& config, int i) {
+	switch (i) {
+	case 0: return &config.angleWeight;
+	case 1: return &config.angularSpeedWeight;
+	case 2: return &config.ballPositionWeight;
+	case 3: return &config.ballPosIntegratedWeight;
+	default: return &config.ballVelocityWeight;
+	}
+}
+
+struct Scenario {
+	const char* name;
+	float tiltX;		// [deg] initial tilt
+	float tiltY;		// [deg]
+	float speed;		// [m/s] target speed in x after 1s
+	float noise;		// [deg] standard deviation of the IMU's angle noise
+};
+
+static const Scenario scenarios[] = {
+		{ "tilt",		3.0, 0.0,	0.0, 0.0 },
+		{ "diagonal",	-2.0, 2.0,	0.0, 0.0 },
+		{ "speed step",	0.0, 0.0,	0.2, 0.0 },
+		{ "noise",		1.0, 0.0,	0.0, 0.1 } };
+const int NumberOfScenarios = sizeof(scenarios)/sizeof(Scenario);
+
+static float scenarioCost(const StateControllerConfig& config, const Scenario& scenario, float duration, uint32_t seed) {
+	BotModelParameters parameters;
+	parameters.imuAngleNoise = radians(scenario.noise);
+	parameters.imuAngularVelocityNoise = 10.0*parameters.imuAngleNoise;
+	parameters.seed = seed;
+
+	BotSimulator sim;
+	sim.setup(config, parameters);
+	sim.reset(radians(scenario.tiltX), radians(scenario.tiltY));
+	float targetSpeed = scenario.speed;
+	while ((sim.getTime() < duration) && !sim.getModel().hasFallen()) {
+		if ((targetSpeed != 0) && (sim.getTime() >= 1.0)) {
+			BotMovement target;
+			target.x.speed = targetSpeed;
+			sim.setTarget(target);
+			targetSpeed = 0;
+		}
+		sim.tick();
+	}
+
+	const SimulationResult& result = sim.getResult();
+	if (result.fallen)
+		return 1000.0 + 100.0*(duration - result.duration);
+	return result.settlingTime + 2.0*degrees(result.rmsTilt) + 10.0*result.saturation + 0.01*result.speedLimitHits;
+}
+
+static StateControllerConfig toConfig(const CMAES::Vector& x) {
+	StateControllerConfig config;
+	config.initDefaultValues();
+	for (int i = 0;i<NumberOfWeights;i++)
+		*weight(config, i) = exp(x[i]);
+	return config;
+}
+
+// cost of all configurations summed up over all scenarios, computed in parallel
+static std::vector<double> evaluate(WorkStealingPool& pool, const std::vector<StateControllerConfig>& configs, float duration, uint32_t seed) {
+	std::vector<double> cost(configs.size()*NumberOfScenarios, 0);
+	for (size_t k = 0;k<configs.size();k++)
+		for (int s = 0;s<NumberOfScenarios;s++)
+			pool.submit([&cost, &configs, k, s, duration, seed]() {
+				cost[k*NumberOfScenarios + s] = scenarioCost(configs[k], scenarios[s], duration, seed + s);
+			});
+	pool.wait();
+
+	std::vector<double> sum(configs.size(), 0);
+	for (size_t k = 0;k<configs.size();k++)
+		for (int s = 0;s<NumberOfScenarios;s++)
+			sum[k] += cost[k*NumberOfScenarios + s];
+	return sum;
+}
+
+static void printConfig(const char* title, const StateControllerConfig& config, double cost) {
+	StateControllerConfig c = config;
+	printf("%-8s cost=%8.3f", title, cost);
+	for (int i = 0;i<NumberOfWeights;i++)
+		printf(" %s=%.3f", WeightName[i], *weight(c, i));
+	printf("\n");
+}
+
+static bool writeImage(const char* filename, const StateControllerConfig& config) {
+	// start with the default values of everything, but without logging
+	hostEEPROMErase();
+	memory.setup();
+	memory.persistentMem.ctrlConfig = config;
+	memory.persistentMem.logConfig.initDefaultValues();
+	memory.save();
+
+	FILE* out = fopen(filename, "wb");
+	if (out == NULL) {
+		perror(filename);
+		return false;
+	}
+	size_t len = sizeof(uint16_t) + sizeof(memory.persistentMem);
+	bool ok = (fwrite(hostEEPROM, 1, len, out) == len);
+	fclose(out);
+	return ok;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: autotune [-g generations] [-l lambda] [-j threads] [-s seed] [-t seconds] [-o eeprom.bin]\n");
+	fprintf(stderr, "       -g number of generations, default 30\n");
+	fprintf(stderr, "       -l candidates per generation, default 16\n");
+	fprintf(stderr, "       -j number of threads, default is one per core\n");
+	fprintf(stderr, "       -t simulated time per scenario, default 5s\n");
+	fprintf(stderr, "       -o EEPROM image with the best configuration, default autotune_eeprom.bin\n");
+}
+
+int main(int argc, char* argv[]) {
+	int generations = 30;
+	int lambda = 16;
+	int threads = 0;
+	uint32_t seed = 1;
+	float duration = 5.0;
+	const char* imageName = "autotune_eeprom.bin";
+
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-g") == 0) && hasValue)
+			generations = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-l") == 0) && hasValue)
+			lambda = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-j") == 0) && hasValue)
+			threads = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-s") == 0) && hasValue)
+			seed = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-t") == 0) && hasValue)
+			duration = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			imageName = argv[++i];
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((generations < 1) || (lambda < 4) || (duration <= 0)) {
+		usage();
+		return 1;
+	}
+
+	// the control code must not log, the output of the tuning goes to stdout
+	memory.setup();
+	LogConfig logConfig = memory.persistentMem.logConfig;
+	memory.persistentMem.logConfig.null();
+	hostConsole.enable(false);
+
+	WorkStealingPool pool(threads);
+
+	StateControllerConfig defaultConfig;
+	defaultConfig.initDefaultValues();
+	std::vector<StateControllerConfig> configs(1, defaultConfig);
+	double defaultCost = evaluate(pool, configs, duration, seed)[0];
+
+	CMAES::Vector start(NumberOfWeights);
+	for (int i = 0;i<NumberOfWeights;i++)
+		start[i] = log(*weight(defaultConfig, i));
+	CMAES cmaes;
+	cmaes.setup(start, 0.3, lambda, seed);
+
+	StateControllerConfig best = defaultConfig;
+	double bestCost = defaultCost;
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	for (int g = 0;g<generations;g++) {
+		const std::vector<CMAES::Vector>& population = cmaes.ask();
+		configs.clear();
+		for (size_t k = 0;k<population.size();k++)
+			configs.push_back(toConfig(population[k]));
+		std::vector<double> cost = evaluate(pool, configs, duration, seed);
+		cmaes.tell(cost);
+
+		double generationBest = cost[0];
+		for (size_t k = 0;k<cost.size();k++) {
+			generationBest = std::min(generationBest, cost[k]);
+			if (cost[k] < bestCost) {
+				bestCost = cost[k];
+				best = configs[k];
+			}
+		}
+		printf("generation %3d best=%8.3f overall=%8.3f sigma=%.4f\n", g+1, generationBest, bestCost, cmaes.getSigma());
+		fflush(stdout);
+	}
+	float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+	uint32_t simulations = generations*lambda*NumberOfScenarios;
+	printf("%u simulations of %.1fs in %.1fs on %d threads (%.0f/s), %lu steals\n",
+			simulations, duration, elapsed, pool.size(), (elapsed > 0)?simulations/elapsed:0.0,
+			(unsigned long)pool.getSteals());
+
+	printConfig("default", defaultConfig, defaultCost);
+	printConfig("best", best, bestCost);
+
+	memory.persistentMem.logConfig = logConfig;
+	if (!writeImage(imageName, best))
+		return 1;
+	printf("EEPROM image written to %s (%u bytes, layout version %u)\n",
+			imageName, (unsigned)(sizeof(uint16_t) + sizeof(memory.persistentMem)), PersistentMemLayoutVersion);
+	return 0;
+}
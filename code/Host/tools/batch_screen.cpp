@@ -0,0 +1,141 @@
+/*
+ * batch_screen.cpp
+ *
+ * Screens random configurations of the state controller with the batch simulator: each
+ * configuration starts tilted and has to balance for the given time. Prints the throughput
+ * and the best configurations, i.e. those with the smallest tilt that did not fall.
+ * With -v, a number of configurations is run with the scalar ControlPlane as well and
+ * compared to the bit, exit code is 1 if any differs.
+ *
+ * use:
+ *     batch_screen [-c candidates] [-t seconds] [-x tilt_deg] [-j threads] [-r range] [-s seed] [-v verify]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+#include <BatchSimulator.h>
+#include <BotMemory.h>
+#include <HostConsole.h>
+
+static void usage() {
+	fprintf(stderr, "usage: batch_screen [-c candidates] [-t seconds] [-x tilt_deg] [-j threads] [-r range] [-s seed] [-v verify]\n");
+	fprintf(stderr, "       -c number of configurations, default 65536\n");
+	fprintf(stderr, "       -t simulated time per configuration, default 5s\n");
+	fprintf(stderr, "       -x initial tilt, default 2deg\n");
+	fprintf(stderr, "       -j threads, default number of cores\n");
+	fprintf(stderr, "       -r weights are drawn within default*(1 +/- range), default 1.0\n");
+	fprintf(stderr, "       -v number of configurations compared with the scalar reference, default 64\n");
+}
+
+static void printConfig(int i, const StateControllerConfig& c, const BatchResult& r) {
+	printf("%6d angle=%6.2f angularSpeed=%6.2f pos=%5.2f posIntegrated=%5.2f velocity=%5.2f  "
+		   "rms tilt=%.3fdeg max tilt=%.2fdeg max pos=%.3fm\n",
+			i, c.angleWeight, c.angularSpeedWeight, c.ballPositionWeight, c.ballPosIntegratedWeight, c.ballVelocityWeight,
+			degrees(r.rmsTilt), degrees(r.maxTilt), r.maxPos);
+}
+
+int main(int argc, char* argv[]) {
+	int candidates = 65536;
+	float duration = 5.0;
+	float tilt = radians(2.0);
+	int threads = std::max(1u, std::thread::hardware_concurrency());
+	float range = 1.0;
+	uint32_t seed = 1;
+	int verifications = 64;
+
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-c") == 0) && hasValue)
+			candidates = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-t") == 0) && hasValue)
+			duration = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-x") == 0) && hasValue)
+			tilt = radians(atof(argv[++i]));
+		else if ((strcmp(argv[i], "-j") == 0) && hasValue)
+			threads = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			range = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-s") == 0) && hasValue)
+			seed = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-v") == 0) && hasValue)
+			verifications = atoi(argv[++i]);
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if (candidates <= 0) {
+		usage();
+		return 1;
+	}
+
+	memory.setup();
+	memory.persistentMem.logConfig.null();
+
+	// random configurations around the default values
+	StateControllerConfig defaultConfig;
+	defaultConfig.initDefaultValues();
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<float> factor(1.0 - range, 1.0 + range);
+	BatchSimulator batch;
+	batch.setup(candidates);
+	std::vector<StateControllerConfig> configs(candidates, defaultConfig);
+	for (int i = 1;i<candidates;i++) {		// first one is the default
+		StateControllerConfig& c = configs[i];
+		c.angleWeight *= factor(random);
+		c.angularSpeedWeight *= factor(random);
+		c.ballPositionWeight *= factor(random);
+		c.ballPosIntegratedWeight *= factor(random);
+		c.ballVelocityWeight *= factor(random);
+		batch.setConfig(i, c);
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	batch.run(tilt, duration, threads);
+	float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::vector<int> balanced;
+	for (int i = 0;i<candidates;i++)
+		if (!batch.getResult(i).fallen)
+			balanced.push_back(i);
+	std::sort(balanced.begin(), balanced.end(), [&batch](int a, int b) {
+		return batch.getResult(a).rmsTilt < batch.getResult(b).rmsTilt; });
+
+	printf("%d configurations of %.1fs in %.3fs with %d lanes and %d threads: %.0f configurations/s, %.0fx real time\n",
+			candidates, duration, elapsed, BatchLanes, threads,
+			candidates/elapsed, candidates*duration/elapsed);
+	printf("%d balanced, %d fell\n", (int)balanced.size(), candidates - (int)balanced.size());
+	printf("default:\n");
+	printConfig(0, configs[0], batch.getResult(0));
+	printf("best:\n");
+	for (size_t i = 0;i<std::min((size_t)10, balanced.size());i++)
+		printConfig(balanced[i], configs[balanced[i]], batch.getResult(balanced[i]));
+
+	// compare a sample of configurations with the scalar ControlPlane
+	int mismatches = 0;
+	std::uniform_int_distribution<int> pick(0, candidates-1);
+	for (int v = 0;v<verifications;v++) {
+		int i = (v == 0)?0:pick(random);
+		BatchLaneState reference = batch.runReference(i, tilt, duration);
+		BatchLaneState lane = batch.getLaneState(i);
+		if (!(reference == lane)) {
+			if (mismatches++ < 3) {
+				printf("mismatch of configuration %d\n   batch:     ", i);
+				lane.print();
+				printf("   reference: ");
+				reference.print();
+			}
+		}
+	}
+	if (verifications > 0)
+		printf("verified %d configurations against the scalar reference: %s\n",
+				verifications, (mismatches == 0)?"identical":"DIFFERENT");
+	return (mismatches == 0)?0:1;
+}
@@ -0,0 +1,179 @@
+/*
+ * bot_simulate.cpp
+ *
+ * Runs the state controller of the bot controller against the model of the bot, faster than real
+ * time. Starts with the bot at rest and tilted, prints whether it balances, and optionally
+ * the course of each tick as csv, or the sensor readings of each tick as a sensor recording
+ * (see SensorRecording.h) for sensor_replay and golden_trace.
+ *
+ * use:
+ *     bot_simulate [-t seconds] [-x tilt_deg] [-y tilt_deg] [-n noise_deg] [-s speed_m_s]
+ *                  [-w angle,angularSpeed,pos,posIntegrated,velocity] [-m weights|lqr|mpc] [-k differences|observer]
+ *                  [-o trace.csv] [-r recording.bin]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <BotSimulator.h>
+#include <SensorSynthesizer.h>
+#include <BotMemory.h>
+#include <HostConsole.h>
+
+static void usage() {
+	fprintf(stderr, "usage: bot_simulate [-t seconds] [-x tilt_deg] [-y tilt_deg] [-n noise_deg] [-s speed_m_s]\n");
+	fprintf(stderr, "                    [-w angle,angularSpeed,pos,posIntegrated,velocity] [-m weights|lqr|mpc] [-k differences|observer]\n");
+	fprintf(stderr, "                    [-o trace.csv] [-r recording.bin]\n");
+	fprintf(stderr, "       -t simulated time, default 10s\n");
+	fprintf(stderr, "       -x/-y initial tilt, default 2deg in x\n");
+	fprintf(stderr, "       -n standard deviation of the IMU's angle noise\n");
+	fprintf(stderr, "       -s target speed in x after 1s\n");
+	fprintf(stderr, "       -w weights of the state controller, default are the values of StateControllerConfig\n");
+	fprintf(stderr, "       -m control mode of the state controller, default are the weights\n");
+	fprintf(stderr, "       -k state estimation of the state controller, default are the finite differences\n");
+	fprintf(stderr, "       -r write the sensor readings as recorded by the bot\n");
+}
+
+static void printTraceHeader(FILE* out) {
+	fprintf(out, "time,tilt_x,tilt_y,rate_x,rate_y,ball_x,ball_y,ballspeed_x,ballspeed_y,"
+				 "odo_pos_x,odo_pos_y,odo_speed_x,odo_speed_y,out_speed_x,out_speed_y,wheel0,wheel1,wheel2\n");
+}
+
+static void printTrace(FILE* out, BotSimulator& sim) {
+	BotModel& model = sim.getModel();
+	const BotMovement& current = sim.getCurrentMovement();
+	const float* wheel = sim.getWheelSpeed();
+	fprintf(out, "%.4f,%.5f,%.5f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f\n",
+			sim.getTime(),
+			model.getTilt(X), model.getTilt(Y), model.getTiltRate(X), model.getTiltRate(Y),
+			model.getBallPos(X), model.getBallPos(Y), model.getBallSpeed(X), model.getBallSpeed(Y),
+			current.x.pos, current.y.pos, current.x.speed, current.y.speed,
+			sim.getStateController().getSpeedX(), sim.getStateController().getSpeedY(),
+			wheel[0], wheel[1], wheel[2]);
+}
+
+int main(int argc, char* argv[]) {
+	float duration = 10.0;
+	float tiltX = radians(2.0);
+	float tiltY = 0;
+	float targetSpeed = 0;
+	const char* traceName = NULL;
+	const char* recordingName = NULL;
+	BotModelParameters parameters;
+	StateControllerConfig config;
+	config.initDefaultValues();
+	ControlMode mode = CONTROL_WEIGHTS;
+	StateEstimation estimation = ESTIMATE_DIFFERENCES;
+
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-t") == 0) && hasValue)
+			duration = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-x") == 0) && hasValue)
+			tiltX = radians(atof(argv[++i]));
+		else if ((strcmp(argv[i], "-y") == 0) && hasValue)
+			tiltY = radians(atof(argv[++i]));
+		else if ((strcmp(argv[i], "-n") == 0) && hasValue) {
+			parameters.imuAngleNoise = radians(atof(argv[++i]));
+			parameters.imuAngularVelocityNoise = 10.0*parameters.imuAngleNoise;
+		}
+		else if ((strcmp(argv[i], "-s") == 0) && hasValue)
+			targetSpeed = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			traceName = argv[++i];
+		else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			recordingName = argv[++i];
+		else if ((strcmp(argv[i], "-m") == 0) && hasValue) {
+			const char* name = argv[++i];
+			if (strcmp(name, "lqr") == 0)
+				mode = CONTROL_LQR;
+			else if (strcmp(name, "mpc") == 0)
+				mode = CONTROL_MPC;
+			else if (strcmp(name, "weights") != 0) {
+				usage();
+				return 1;
+			}
+		}
+		else if ((strcmp(argv[i], "-k") == 0) && hasValue) {
+			const char* name = argv[++i];
+			if (strcmp(name, "observer") == 0)
+				estimation = ESTIMATE_OBSERVER;
+			else if (strcmp(name, "differences") != 0) {
+				usage();
+				return 1;
+			}
+		}
+		else if ((strcmp(argv[i], "-w") == 0) && hasValue) {
+			if (sscanf(argv[++i], "%f,%f,%f,%f,%f",
+					&config.angleWeight, &config.angularSpeedWeight,
+					&config.ballPositionWeight, &config.ballPosIntegratedWeight, &config.ballVelocityWeight) != 5) {
+				usage();
+				return 1;
+			}
+		} else {
+			usage();
+			return 1;
+		}
+	}
+
+	FILE* trace = NULL;
+	if (traceName != NULL) {
+		trace = fopen(traceName, "w");
+		if (trace == NULL) {
+			perror(traceName);
+			return 1;
+		}
+		printTraceHeader(trace);
+	}
+	FILE* recording = NULL;
+	if (recordingName != NULL) {
+		recording = fopen(recordingName, "wb");
+		if (recording == NULL) {
+			perror(recordingName);
+			return 1;
+		}
+	}
+
+	// the control code must not log, the output of the simulation goes to stdout
+	memory.setup();
+	memory.persistentMem.logConfig.null();
+	hostConsole.enable(false);
+
+	BotSimulator sim;
+	sim.setup(config, parameters);
+	sim.getStateController().setControlMode(mode);
+	sim.getStateController().setStateEstimation(estimation);
+	sim.reset(tiltX, tiltY);
+	SensorSynthesizer synthesizer;
+	if (recording)
+		synthesizer.start(recording, sim);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	while ((sim.getTime() < duration) && !sim.getModel().hasFallen()) {
+		if ((targetSpeed != 0) && (sim.getTime() >= 1.0)) {
+			BotMovement target;
+			target.x.speed = targetSpeed;
+			sim.setTarget(target);
+			targetSpeed = 0;
+		}
+		sim.tick();
+		if (trace)
+			printTrace(trace, sim);
+		if (recording)
+			synthesizer.record(sim);
+	}
+	float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	hostConsole.enable(true);
+	sim.getResult().print();
+	printf("real time factor=%.0f\n", (elapsed > 0)?sim.getTime()/elapsed:0.0);
+
+	if (trace)
+		fclose(trace);
+	if (recording)
+		fclose(recording);
+	return sim.getResult().fallen?2:0;
+}
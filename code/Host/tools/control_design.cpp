@@ -0,0 +1,319 @@
+/*
+ * control_design.cpp
+ *
+ * Offline design of the LQR mode and of the state observer of the state controller out of the
+ * linearised model of one plane (LinearModel.h), with the state of LQRState and the acceleration
+ * of the ControlPlane as input. Motor lag and the output filter are not modelled, the weights
+ * need to keep the loop slow enough for those.
+ *
+ * The discrete Riccati equation is solved by iteration, the weights follow Bryson's rule,
+ * i.e. Q and R are diagonal with 1/(max value)^2. The feedback gains are written as constexpr
+ * table into LQRGains.h of the bot controller.
+ *
+ * The StateObserver uses the first four states, all of them are measured by IMU and odometry.
+ * Its steady state Kalman gain comes out of the dual Riccati equation, with the noise of the
+ * sensors and the process noise of a disturbing angular acceleration and a disturbing
+ * acceleration of the ball (slip, motor lag). Model and gain are written into ObserverGains.h.
+ *
+ * use:
+ *     control_design [-q tilt_deg,rate_deg_s,pos_m,speed_m_s,integral_ms] [-r accel_m_s2] [-o LQRGains.h]
+ *                    [-m tilt_deg,rate_deg_s,pos_m,speed_m_s] [-d angular_accel_rad_s2,accel_m_s2] [-e ObserverGains.h]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <setup.h>
+#include <LinearModel.h>
+#include <GeneratedHeader.h>
+
+const int O = ObserverStates;
+typedef double ObserverMatrix[O][O];
+typedef double ObserverVector[O];
+
+struct ObserverNoise {
+	// standard deviation of the measurement
+	double tilt = radians(0.1);				// [rad]	IMU after its Kalman filter
+	double angularVelocity = radians(1.0);	// [rad/s]	gyro
+	double pos = 0.001;						// [m]		odometry
+	double speed = 0.01;					// [m/s]	odometry
+	// standard deviation of the disturbances
+	double angularAccel = 5.0;				// [rad/s^2]
+	double accel = 2.0;						// [m/s^2]
+};
+
+// steady state Kalman gain L of x(k+1) = A·x(k) + B·a(k) + w, y(k) = x(k) + v, applied as
+// correction x += L·(y - x) after the prediction. W and V are the covariances of w and v
+static bool solveKalman(const ObserverMatrix& A, const ObserverMatrix& W, const ObserverVector& V, ObserverMatrix& L) {
+	ObserverMatrix P, At;
+	memcpy(P, W, sizeof(ObserverMatrix));
+	transpose(A, At);
+
+	const int MaxIterations = 1000000;
+	for (int iteration = 0;iteration<MaxIterations;iteration++) {
+		// L = P·(P + V)^-1 with P being the covariance of the prediction
+		ObserverMatrix S, SInverse;
+		memcpy(S, P, sizeof(ObserverMatrix));
+		for (int i = 0;i<O;i++)
+			S[i][i] += V[i];
+		if (!invert(S, SInverse))
+			return false;
+		multiply(P, SInverse, L);
+
+		// covariance of the estimate (I-L)·P·(I-L)' + L·V·L', Joseph form to stay symmetric
+		ObserverMatrix IL, ILT, estimate;
+		for (int i = 0;i<O;i++)
+			for (int j = 0;j<O;j++)
+				IL[i][j] = ((i == j)?1.0:0.0) - L[i][j];
+		transpose(IL, ILT);
+		multiply(P, ILT, estimate);
+		multiply(IL, estimate, estimate);
+		for (int i = 0;i<O;i++)
+			for (int j = 0;j<O;j++)
+				for (int k = 0;k<O;k++)
+					estimate[i][j] += L[i][k]*V[k]*L[j][k];
+
+		// covariance of the next prediction A·P·A' + W
+		ObserverMatrix next;
+		multiply(estimate, At, next);
+		multiply(A, next, next);
+		for (int i = 0;i<O;i++)
+			for (int j = 0;j<O;j++)
+				next[i][j] += W[i][j];
+
+		double change = 0;
+		for (int i = 0;i<O;i++)
+			for (int j = 0;j<O;j++)
+				change = max(change, fabs(next[i][j] - P[i][j]));
+		memcpy(P, next, sizeof(ObserverMatrix));
+		if (change < 1.0e-12*maxAbs(P)) {
+			printf("Kalman filter converged after %d iterations\n", iteration+1);
+			return true;
+		}
+	}
+	return false;
+}
+
+// response of the linear closed loop to an initial tilt, to check the input against the limits of the bot
+static void printStepResponse(const Matrix& A, const Vector& B, const Vector& gain, double tilt) {
+	Vector x;
+	memset(x, 0, sizeof(Vector));
+	x[LQR_TILT] = tilt;
+	double maxAccel = 0, maxSpeed = 0, maxPos = 0;
+	float settled = 0;
+	for (int tick = 0;tick<10*SampleFrequency;tick++) {
+		double a = 0;
+		for (int i = 0;i<N;i++)
+			a += gain[i]*x[i];
+		maxAccel = max(maxAccel, fabs(a));
+		multiply(A, x, x);
+		for (int i = 0;i<N;i++)
+			x[i] += B[i]*a;
+		maxSpeed = max(maxSpeed, fabs(x[LQR_SPEED]));
+		maxPos = max(maxPos, fabs(x[LQR_POS]));
+		if (fabs(x[LQR_TILT]) > 0.05*tilt)
+			settled = (tick+1)*SamplingTime;
+	}
+	printf("response to %.1f° tilt: max accel %.2fm/s^2 (limit %.2f), max speed %.3fm/s, max pos %.3fm, tilt settled within 5%% after %.2fs\n",
+			degrees(tilt), maxAccel, MaxBotAccel, maxSpeed, maxPos, settled);
+}
+
+static bool writeLQRHeader(const char* name, const DesignWeights& weights, const Vector& gain, double radius, int argc, char* argv[]) {
+	FILE* out = openHeader(name, "control_design", "LQRGains.h", "Gains of the LQR mode of the ControlPlane", argc, argv);
+	if (out == NULL)
+		return false;
+	fprintf(out, " * max values of Bryson's rule: tilt %.2fdeg, angular velocity %.1fdeg/s, pos %.3fm, speed %.3fm/s,\n",
+			degrees(weights.tilt), degrees(weights.angularVelocity), weights.pos, weights.speed);
+	fprintf(out, " * integrated pos %.3fms, accel %.2fm/s^2. Spectral radius of the closed loop is %.6f\n",
+			weights.posIntegrated, weights.accel, radius);
+	beginHeader(out, "LQRGAINS_H_");
+	fprintf(out, "// the gains are valid for this sample frequency only\n");
+	fprintf(out, "const int LQRSampleFrequency = %d;\n\n", SampleFrequency);
+	fprintf(out, "// acceleration [m/s^2] = LQRGain · (tilt, angular velocity, pos, speed, integrated pos) error\n");
+	fprintf(out, "constexpr float LQRGain[] = { ");
+	for (int i = 0;i<N;i++)
+		fprintf(out, "%s%.6g", (i > 0)?", ":"", gain[i]);
+	fprintf(out, " };\n\n");
+	closeHeader(out, "LQRGAINS_H_");
+	return true;
+}
+
+static void printMatrix(FILE* out, const ObserverMatrix& m) {
+	fprintf(out, "{\n");
+	for (int i = 0;i<O;i++) {
+		fprintf(out, "\t{ ");
+		for (int j = 0;j<O;j++)
+			fprintf(out, "%s%.8g", (j > 0)?", ":"", m[i][j]);
+		fprintf(out, " }%s\n", (i < O-1)?",":"");
+	}
+	fprintf(out, "};\n\n");
+}
+
+static bool writeObserverHeader(const char* name, const ObserverNoise& noise, const LinearModel& model,
+								const ObserverMatrix& A, const ObserverMatrix& L, double radius, int argc, char* argv[]) {
+	FILE* out = openHeader(name, "control_design", "ObserverGains.h", "Model and gains of the StateObserver", argc, argv);
+	if (out == NULL)
+		return false;
+	fprintf(out, " * measurement noise: tilt %.3fdeg, angular velocity %.2fdeg/s, pos %.4fm, speed %.4fm/s,\n",
+			degrees(noise.tilt), degrees(noise.angularVelocity), noise.pos, noise.speed);
+	fprintf(out, " * disturbances: angular accel %.2frad/s^2, accel %.2fm/s^2. Spectral radius of the observer is %.6f\n",
+			noise.angularAccel, noise.accel, radius);
+	beginHeader(out, "OBSERVERGAINS_H_");
+	fprintf(out, "// model and gains are valid for this sample frequency only\n");
+	fprintf(out, "const int ObserverSampleFrequency = %d;\n\n", SampleFrequency);
+	fprintf(out, "// discrete model x(k+1) = ObserverModel·x(k) + ObserverInput·a(k) with x = (tilt, angular velocity, pos, speed)\n");
+	fprintf(out, "constexpr float ObserverModel[%d][%d] = ", O, O);
+	printMatrix(out, A);
+	fprintf(out, "constexpr float ObserverInput[%d] = { ", O);
+	for (int i = 0;i<O;i++)
+		fprintf(out, "%s%.8g", (i > 0)?", ":"", model.B[i]);
+	fprintf(out, " };\n\n");
+	fprintf(out, "// steady state Kalman gain, x += ObserverGain·(measurement - x)\n");
+	fprintf(out, "constexpr float ObserverGain[%d][%d] = ", O, O);
+	printMatrix(out, L);
+	fprintf(out, "// angular acceleration [rad/s^2] = ObserverAngularAccel · (tilt, a)\n");
+	fprintf(out, "constexpr float ObserverAngularAccel[2] = { %.8g, %.8g };\n\n", model.angularAccelTilt, model.angularAccelInput);
+	closeHeader(out, "OBSERVERGAINS_H_");
+	return true;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: control_design [-q tilt_deg,rate_deg_s,pos_m,speed_m_s,integral_ms] [-r accel_m_s2] [-o LQRGains.h]\n");
+	fprintf(stderr, "                      [-m tilt_deg,rate_deg_s,pos_m,speed_m_s] [-d angular_accel_rad_s2,accel_m_s2] [-e ObserverGains.h]\n");
+	fprintf(stderr, "       -q max values of the state for Q, default 2°,30°/s,0.1m,0.25m/s,0.2ms\n");
+	fprintf(stderr, "       -r max value of the acceleration for R, default 1.5m/s^2\n");
+	fprintf(stderr, "       -o write the gains for the bot controller\n");
+	fprintf(stderr, "       -m standard deviation of the measurement, default 0.1°,1°/s,0.001m,0.01m/s\n");
+	fprintf(stderr, "       -d standard deviation of the disturbances, default 5rad/s^2,2m/s^2\n");
+	fprintf(stderr, "       -e write model and gains of the observer for the bot controller\n");
+}
+
+int main(int argc, char* argv[]) {
+	DesignWeights weights;
+	ObserverNoise noise;
+	const char* headerName = NULL;
+	const char* observerHeaderName = NULL;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-q") == 0) && hasValue) {
+			double tilt, angularVelocity;
+			if (sscanf(argv[++i], "%lf,%lf,%lf,%lf,%lf", &tilt, &angularVelocity,
+					&weights.pos, &weights.speed, &weights.posIntegrated) != 5) {
+				usage();
+				return 1;
+			}
+			weights.tilt = radians(tilt);
+			weights.angularVelocity = radians(angularVelocity);
+		} else if ((strcmp(argv[i], "-m") == 0) && hasValue) {
+			double tilt, angularVelocity;
+			if (sscanf(argv[++i], "%lf,%lf,%lf,%lf", &tilt, &angularVelocity, &noise.pos, &noise.speed) != 4) {
+				usage();
+				return 1;
+			}
+			noise.tilt = radians(tilt);
+			noise.angularVelocity = radians(angularVelocity);
+		} else if ((strcmp(argv[i], "-d") == 0) && hasValue) {
+			if (sscanf(argv[++i], "%lf,%lf", &noise.angularAccel, &noise.accel) != 2) {
+				usage();
+				return 1;
+			}
+		} else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			weights.accel = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			headerName = argv[++i];
+		else if ((strcmp(argv[i], "-e") == 0) && hasValue)
+			observerHeaderName = argv[++i];
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((weights.tilt <= 0) || (weights.angularVelocity <= 0) || (weights.pos <= 0) ||
+		(weights.speed <= 0) || (weights.posIntegrated <= 0) || (weights.accel <= 0) ||
+		(noise.tilt <= 0) || (noise.angularVelocity <= 0) || (noise.pos <= 0) || (noise.speed <= 0) ||
+		(noise.angularAccel <= 0) || (noise.accel <= 0)) {
+		usage();
+		return 1;
+	}
+
+	LinearModel model;
+	discreteModel(model);
+	printf("model: θ''=%.3f·θ %+.3f·a (open loop pole at ±%.2f/s)\n",
+			model.angularAccelTilt, model.angularAccelInput, sqrt(model.angularAccelTilt));
+
+	// LQR
+	Vector Q;
+	double R;
+	weights.costs(Q, R);
+
+	Vector K;
+	Matrix P;
+	if (!solveRiccati(model.A, model.B, Q, R, K, P)) {
+		fprintf(stderr, "Riccati equation did not converge\n");
+		return 2;
+	}
+
+	// the ControlPlane adds the weighted errors, a = -K·x
+	Vector gain;
+	for (int i = 0;i<N;i++)
+		gain[i] = -K[i];
+	Matrix closedLoop;
+	for (int i = 0;i<N;i++)
+		for (int j = 0;j<N;j++)
+			closedLoop[i][j] = model.A[i][j] + model.B[i]*gain[j];
+	double radius = spectralRadius(closedLoop);
+
+	printf("gains (tilt, angular velocity, pos, speed, integrated pos) = (%.4f, %.4f, %.4f, %.4f, %.4f)\n",
+			gain[LQR_TILT], gain[LQR_ANGULAR_VELOCITY], gain[LQR_POS], gain[LQR_SPEED], gain[LQR_POS_INTEGRATED]);
+	printf("spectral radius of the closed loop %.6f, i.e. slowest time constant %.3fs\n",
+			radius, -SamplingTime/log(radius));
+	printStepResponse(model.A, model.B, gain, radians(2.0));
+	if (radius >= 1.0) {
+		fprintf(stderr, "closed loop is unstable\n");
+		return 2;
+	}
+
+	// observer of the first four states, i.e. without the integrated position
+	ObserverMatrix A;
+	for (int i = 0;i<O;i++)
+		for (int j = 0;j<O;j++)
+			A[i][j] = model.A[i][j];
+
+	// the disturbances act within a tick, i.e. with (dT^2/2, dT) on angle and angular velocity resp. pos and speed
+	ObserverVector angularDisturbance = { SamplingTime*SamplingTime/2.0*noise.angularAccel, SamplingTime*noise.angularAccel, 0, 0 };
+	ObserverVector disturbance = { 0, 0, SamplingTime*SamplingTime/2.0*noise.accel, SamplingTime*noise.accel };
+	ObserverMatrix W;
+	for (int i = 0;i<O;i++)
+		for (int j = 0;j<O;j++)
+			W[i][j] = angularDisturbance[i]*angularDisturbance[j] + disturbance[i]*disturbance[j];
+	ObserverVector V = { noise.tilt*noise.tilt, noise.angularVelocity*noise.angularVelocity,
+						 noise.pos*noise.pos, noise.speed*noise.speed };
+	ObserverMatrix L;
+	if (!solveKalman(A, W, V, L)) {
+		fprintf(stderr, "Kalman filter did not converge\n");
+		return 2;
+	}
+
+	// the error of the estimation propagates with (I-L)·A
+	ObserverMatrix IL, errorDynamics;
+	for (int i = 0;i<O;i++)
+		for (int j = 0;j<O;j++)
+			IL[i][j] = ((i == j)?1.0:0.0) - L[i][j];
+	multiply(IL, A, errorDynamics);
+	double observerRadius = spectralRadius(errorDynamics);
+	printf("observer gain diagonal (tilt, angular velocity, pos, speed) = (%.4f, %.4f, %.4f, %.4f)\n",
+			L[0][0], L[1][1], L[2][2], L[3][3]);
+	printf("spectral radius of the observer %.6f, i.e. slowest time constant %.3fs\n",
+			observerRadius, -SamplingTime/log(observerRadius));
+	if (observerRadius >= 1.0) {
+		fprintf(stderr, "observer is unstable\n");
+		return 2;
+	}
+
+	if ((headerName != NULL) && !writeLQRHeader(headerName, weights, gain, radius, argc, argv))
+		return 1;
+	if ((observerHeaderName != NULL) && !writeObserverHeader(observerHeaderName, noise, model, A, L, observerRadius, argc, argv))
+		return 1;
+	return 0;
+}
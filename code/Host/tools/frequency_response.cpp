@@ -0,0 +1,318 @@
+/*
+ * frequency_response.cpp
+ *
+ * Measures the frequency response of the balancing loop in x: the simulator runs the unmodified
+ * StateController with its filters against the bot model, and a sine of a small amplitude is
+ * added to the controller's output speed, i.e. the loop is broken at the input of the bot.
+ * With u = c + d being the input of the bot and c the controller's output, the loop transfer
+ * function is L(jw) = -C(jw)/U(jw), both taken by correlating with the sine over an integer
+ * number of periods after the transient has settled (stepped sine). Every frequency is a
+ * simulation of its own, these run in parallel on all cores.
+ *
+ * Out of L the analyser reports
+ *   - every crossover of |L| = 1 with its phase margin,
+ *   - every crossover of the phase with -180° with its gain margin (the bot is unstable without
+ *     the controller, so there is a margin to decrease the gain as well),
+ *   - the peak of the sensitivity |S| = |1/(1+L)|, 1/Ms is the distance of L to -1,
+ *   - the bandwidth, i.e. where the closed loop |T| = |L/(1+L)| drops below -3dB.
+ * The cut off frequencies of the filters of the ControlPlane can be changed, to see what a
+ * different filter costs in phase.
+ *
+ * use:
+ *     frequency_response [-w angle,angularSpeed,pos,posIntegrated,velocity] [-e eeprom.bin] [-m weights|lqr|mpc] [-k differences|observer]
+ *                        [-c posCutOff,outputSpeedCutOff] [-f fmin,fmax] [-p points per decade]
+ *                        [-a amplitude] [-j threads] [-o response.csv]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <complex>
+#include <vector>
+#include <BotSimulator.h>
+#include <BotMemory.h>
+#include <HostConsole.h>
+#include <EEPROM.h>
+#include <WorkStealingPool.h>
+
+typedef std::complex<double> Complex;
+
+const float SettlingTime = 2.0;				// [s] min time for the transient
+const int SettlingPeriods = 8;				// min periods for the transient
+const float MeasuringTime = 2.0;			// [s] min time to correlate
+const int MeasuringPeriods = 4;				// min periods to correlate
+
+struct FilterCutOff {
+	float pos = 5.0;						// [Hz] default of ControlPlane
+	float outputSpeed = 15.0;
+};
+
+struct ResponsePoint {
+	double frequency = 0;					// [Hz]
+	Complex L;								// loop transfer function
+	bool fallen = false;
+	double phase = 0;						// [deg] of L, unwrapped
+
+	Complex S() const { return 1.0/(1.0 + L); };
+	Complex T() const { return L/(1.0 + L); };
+};
+
+static double dB(double x) { return 20.0*log10(x); };
+
+static void measure(const StateControllerConfig& config, ControlMode mode, StateEstimation estimation, const FilterCutOff& cutOff, float amplitude, ResponsePoint& point) {
+	BotSimulator sim;
+	sim.setup(config, BotModelParameters());
+	sim.getStateController().setControlMode(mode);
+	sim.getStateController().setStateEstimation(estimation);
+	sim.getStateController().setFilterCutOff(cutOff.pos, cutOff.outputSpeed);
+	sim.reset(0, 0);
+
+	double f = point.frequency;
+	int periods = max(MeasuringPeriods, (int)ceil(MeasuringTime*f));
+	uint32_t settlingTicks = (uint32_t)(max(SettlingTime, (float)(SettlingPeriods/f))*SampleFrequency);
+	uint32_t measuringTicks = (uint32_t)(periods/f*SampleFrequency + 0.5);
+
+	Complex C = 0;
+	Complex U = 0;
+	for (uint32_t tick = 0;tick<settlingTicks + measuringTicks;tick++) {
+		// the excitation is applied with the controller's output of this tick, the time is that of the tick
+		double t = (tick+1)/(double)SampleFrequency;
+		float d = amplitude*sin(TWO_PI*f*t);
+		sim.setExcitation(d, 0);
+		sim.tick();
+		if (sim.getModel().hasFallen()) {
+			point.fallen = true;
+			return;
+		}
+		if (tick >= settlingTicks) {
+			float c = sim.getStateController().getSpeedX();
+			Complex e = std::polar(1.0, -TWO_PI*f*t);
+			C += (double)c*e;
+			U += (double)(c + d)*e;
+		}
+	}
+	point.L = -C/U;
+}
+
+// linear interpolation between two points of the grid in log of the frequency
+static double interpolateFrequency(const ResponsePoint& a, const ResponsePoint& b, double ratio) {
+	return exp(log(a.frequency) + ratio*(log(b.frequency) - log(a.frequency)));
+}
+
+static void printMargins(const std::vector<ResponsePoint>& points) {
+	for (size_t i = 0;i+1<points.size();i++) {
+		const ResponsePoint& a = points[i];
+		const ResponsePoint& b = points[i+1];
+
+		// gain crossover
+		double gainA = dB(abs(a.L));
+		double gainB = dB(abs(b.L));
+		if ((gainA >= 0) != (gainB >= 0)) {
+			double ratio = gainA/(gainA - gainB);
+			double phase = a.phase + ratio*(b.phase - a.phase);
+			double margin = fmod(phase + 180.0, 360.0);
+			if (margin > 180.0)
+				margin -= 360.0;
+			if (margin <= -180.0)
+				margin += 360.0;
+			printf("gain crossover at %.2fHz: phase margin %.1fdeg\n", interpolateFrequency(a, b, ratio), margin);
+		}
+
+		// phase crossover of -180 + k*360
+		double k = floor((a.phase + 180.0)/360.0);
+		double crossing = -180.0 + ((b.phase > a.phase)?(k+1):k)*360.0;
+		if ((crossing != a.phase) && ((a.phase - crossing)*(b.phase - crossing) <= 0)) {
+			double ratio = (crossing - a.phase)/(b.phase - a.phase);
+			double gain = gainA + ratio*(gainB - gainA);
+			printf("phase crossover at %.2fHz: gain margin %+.1fdB\n", interpolateFrequency(a, b, ratio), -gain);
+		}
+	}
+
+	const ResponsePoint* peak = &points[0];
+	for (const ResponsePoint& p : points)
+		if (abs(p.S()) > abs(peak->S()))
+			peak = &p;
+	printf("sensitivity peak Ms=%.2f (%.1fdB) at %.2fHz, distance to -1 is %.2f\n",
+			abs(peak->S()), dB(abs(peak->S())), peak->frequency, 1.0/abs(peak->S()));
+
+	double reference = abs(points[0].T());
+	for (size_t i = 1;i<points.size();i++)
+		if (abs(points[i].T()) < reference/sqrt(2.0)) {
+			printf("bandwidth %.2fHz (closed loop -3dB below %.2fHz)\n", points[i].frequency, points[0].frequency);
+			return;
+		}
+	printf("bandwidth above %.2fHz\n", points.back().frequency);
+}
+
+static bool readImage(const char* name) {
+	FILE* in = fopen(name, "rb");
+	if (in == NULL) {
+		perror(name);
+		return false;
+	}
+	hostEEPROMErase();
+	size_t len = fread(hostEEPROM, 1, HostEEPROMSize, in);
+	fclose(in);
+
+	// setup initializes the memory if the image's magic number does not fit
+	if ((len == 0) || memory.setup()) {
+		fprintf(stderr, "%s is not an EEPROM image of layout version %u\n", name, PersistentMemLayoutVersion);
+		return false;
+	}
+	return true;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: frequency_response [-w angle,angularSpeed,pos,posIntegrated,velocity] [-e eeprom.bin] [-m weights|lqr|mpc] [-k differences|observer]\n");
+	fprintf(stderr, "                          [-c posCutOff,outputSpeedCutOff] [-f fmin,fmax] [-p points per decade]\n");
+	fprintf(stderr, "                          [-a amplitude] [-j threads] [-o response.csv]\n");
+	fprintf(stderr, "       -w weights of the state controller, default are the values of StateControllerConfig\n");
+	fprintf(stderr, "       -e configuration out of an EEPROM image (autotune)\n");
+	fprintf(stderr, "       -m control mode of the state controller, default are the weights\n");
+	fprintf(stderr, "       -k state estimation of the state controller, default are the finite differences\n");
+	fprintf(stderr, "       -c cut off frequencies of the filters of the ControlPlane, default 5,15Hz\n");
+	fprintf(stderr, "       -f range of frequencies, default 0.1,100Hz\n");
+	fprintf(stderr, "       -p frequencies per decade, default 20\n");
+	fprintf(stderr, "       -a amplitude of the excitation, default 0.005m/s\n");
+	fprintf(stderr, "       -j number of threads, default is one per core\n");
+}
+
+int main(int argc, char* argv[]) {
+	StateControllerConfig config;
+	config.initDefaultValues();
+	ControlMode mode = CONTROL_WEIGHTS;
+	StateEstimation estimation = ESTIMATE_DIFFERENCES;
+	FilterCutOff cutOff;
+	float fMin = 0.1;
+	float fMax = 100.0;
+	int pointsPerDecade = 20;
+	float amplitude = 0.005;
+	int threads = 0;
+	const char* imageName = NULL;
+	const char* outputName = NULL;
+	bool weightsSet = false;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-w") == 0) && hasValue) {
+			weightsSet = true;
+			if (sscanf(argv[++i], "%f,%f,%f,%f,%f",
+					&config.angleWeight, &config.angularSpeedWeight,
+					&config.ballPositionWeight, &config.ballPosIntegratedWeight, &config.ballVelocityWeight) != 5) {
+				usage();
+				return 1;
+			}
+		} else if ((strcmp(argv[i], "-c") == 0) && hasValue) {
+			if (sscanf(argv[++i], "%f,%f", &cutOff.pos, &cutOff.outputSpeed) != 2) {
+				usage();
+				return 1;
+			}
+		} else if ((strcmp(argv[i], "-f") == 0) && hasValue) {
+			if (sscanf(argv[++i], "%f,%f", &fMin, &fMax) != 2) {
+				usage();
+				return 1;
+			}
+		} else if ((strcmp(argv[i], "-m") == 0) && hasValue) {
+			const char* name = argv[++i];
+			if (strcmp(name, "lqr") == 0)
+				mode = CONTROL_LQR;
+			else if (strcmp(name, "mpc") == 0)
+				mode = CONTROL_MPC;
+			else if (strcmp(name, "weights") != 0) {
+				usage();
+				return 1;
+			}
+		} else if ((strcmp(argv[i], "-k") == 0) && hasValue) {
+			const char* name = argv[++i];
+			if (strcmp(name, "observer") == 0)
+				estimation = ESTIMATE_OBSERVER;
+			else if (strcmp(name, "differences") != 0) {
+				usage();
+				return 1;
+			}
+		} else if ((strcmp(argv[i], "-e") == 0) && hasValue)
+			imageName = argv[++i];
+		else if ((strcmp(argv[i], "-p") == 0) && hasValue)
+			pointsPerDecade = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-a") == 0) && hasValue)
+			amplitude = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-j") == 0) && hasValue)
+			threads = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			outputName = argv[++i];
+		else {
+			usage();
+			return 1;
+		}
+	}
+	// the excitation is sampled with the loop, keep below Nyquist
+	if ((fMin <= 0) || (fMax <= fMin) || (fMax >= SampleFrequency/2.0) || (pointsPerDecade < 1) || (amplitude <= 0) ||
+		(weightsSet && (imageName != NULL))) {
+		usage();
+		return 1;
+	}
+
+	if (imageName != NULL) {
+		if (!readImage(imageName))
+			return 1;
+		config = memory.persistentMem.ctrlConfig;
+	} else
+		memory.setup();
+
+	// the control code must not log, the result goes to stdout
+	memory.persistentMem.logConfig.null();
+	hostConsole.enable(false);
+
+	int numberOfPoints = (int)ceil(log10(fMax/fMin)*pointsPerDecade) + 1;
+	std::vector<ResponsePoint> points(numberOfPoints);
+	for (int i = 0;i<numberOfPoints;i++)
+		points[i].frequency = fMin*pow(fMax/fMin, (double)i/(numberOfPoints-1));
+
+	WorkStealingPool pool(threads);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0;i<numberOfPoints;i++)
+		pool.submit([&points, &config, mode, estimation, &cutOff, amplitude, i]() {
+			measure(config, mode, estimation, cutOff, amplitude, points[i]);
+		});
+	pool.wait();
+	float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	hostConsole.enable(true);
+
+	for (const ResponsePoint& p : points)
+		if (p.fallen) {
+			printf("the bot fell at %.2fHz, the loop is unstable or the amplitude too large\n", p.frequency);
+			return 2;
+		}
+
+	// unwrap the phase starting at the lowest frequency
+	for (int i = 0;i<numberOfPoints;i++) {
+		double phase = degrees(arg(points[i].L));
+		if (i > 0)
+			phase += 360.0*round((points[i-1].phase - phase)/360.0);
+		points[i].phase = phase;
+	}
+
+	printf("%d frequencies in %.1fs on %d threads, filters %.1fHz/%.1fHz, amplitude %.4fm/s\n",
+			numberOfPoints, elapsed, pool.size(), cutOff.pos, cutOff.outputSpeed, amplitude);
+	printf("%9s %9s %9s %9s %9s\n", "f [Hz]", "|L| [dB]", "arg L", "|S| [dB]", "|T| [dB]");
+	for (const ResponsePoint& p : points)
+		printf("%9.3f %9.2f %9.1f %9.2f %9.2f\n", p.frequency, dB(abs(p.L)), p.phase, dB(abs(p.S())), dB(abs(p.T())));
+	printMargins(points);
+
+	if (outputName != NULL) {
+		FILE* out = fopen(outputName, "w");
+		if (out == NULL) {
+			perror(outputName);
+			return 1;
+		}
+		fprintf(out, "frequency,L_re,L_im,L_dB,L_phase,S_dB,T_dB\n");
+		for (const ResponsePoint& p : points)
+			fprintf(out, "%.4f,%.6g,%.6g,%.3f,%.2f,%.3f,%.3f\n", p.frequency, p.L.real(), p.L.imag(),
+					dB(abs(p.L)), p.phase, dB(abs(p.S())), dB(abs(p.T())));
+		fclose(out);
+	}
+	return 0;
+}
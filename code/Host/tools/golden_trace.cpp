@@ -0,0 +1,320 @@
+/*
+ * golden_trace.cpp
+ *
+ * Regression test of the numerics and the cost of the control code. Replays a stored sensor
+ * recording (see SensorRecording.h, or bot_simulate -r) through the host build of the control
+ * code and writes or compares a golden trace: the outputs of every tick, plus the instructions
+ * and the wall time a tick takes. The comparison fails loudly
+ *   - if an output deviates from the golden trace by more than abs + rel*|golden|,
+ *   - if a tick needs more instructions on average than the golden trace plus a margin,
+ *   - if the median wall time of a tick is above the golden one plus a margin.
+ * Instructions are counted in user space by the CPU's performance counters and hardly vary
+ * between runs, wall time depends on the machine, so its margin is wide and can be switched off.
+ * Cost is measured over several repetitions of the run, the minimum per tick is taken.
+ *
+ * use:
+ *     bot_simulate -t 5 -s 0.2 -r input.bin
+ *     golden_trace -i input.bin -w golden.csv				// once, when the numerics change on purpose
+ *     golden_trace -i input.bin -c golden.csv				// after every change
+ * ctest does the latter with test/golden_trace.csv and without the check of the wall time.
+ *
+ * exit code is 0 if the comparison passed, 1 for wrong usage or files, 2 if the numerics
+ * deviate, 3 if the control code became slower.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <SensorReplay.h>
+#include <InstructionCounter.h>
+#include <HostConsole.h>
+
+static const int NumberOfColumns = SensorReplay::NumberOfOutputs + 3;	// sequence, outputs, instructions, ns
+
+struct TraceTick {
+	uint16_t sequence = 0;
+	float output[SensorReplay::NumberOfOutputs];
+	uint64_t instructions = 0;
+	uint32_t ns = 0;
+};
+
+struct Trace {
+	std::vector<TraceTick> ticks;
+	double instructions = 0;			// mean per tick
+	double ns = 0;						// median per tick
+};
+
+// replay the run until the first gap, repetitions times, and keep the cheapest measurement per tick
+static void replayRun(const SensorRecordingRun& run, int repetitions, InstructionCounter& counter, Trace& trace) {
+	for (int r = 0;r<repetitions;r++) {
+		SensorReplay replay;
+		replay.setup(run.header);
+		size_t nextTarget = 0;
+		for (size_t t = 0;t<run.samples.size();t++) {
+			const SensorRecordingSample& sample = run.samples[t];
+			if ((t > 0) && ((uint16_t)(run.samples[t-1].sequence + 1) != sample.sequence))
+				break;
+			while ((nextTarget < run.targets.size()) && (run.targets[nextTarget].first <= t))
+				replay.setTarget(run.targets[nextTarget++].second);
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			uint64_t startInstructions = counter.read();
+			replay.tick(sample);
+			uint64_t instructions = counter.read() - startInstructions;
+			uint32_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+			if (r == 0) {
+				TraceTick tick;
+				tick.sequence = sample.sequence;
+				replay.getOutput(tick.output);
+				tick.instructions = instructions;
+				tick.ns = ns;
+				trace.ticks.push_back(tick);
+			} else {
+				TraceTick& tick = trace.ticks[t];
+				tick.instructions = std::min(tick.instructions, instructions);
+				tick.ns = std::min(tick.ns, ns);
+			}
+		}
+	}
+
+	std::vector<uint32_t> ns;
+	double sumInstructions = 0;
+	for (const TraceTick& tick : trace.ticks) {
+		sumInstructions += tick.instructions;
+		ns.push_back(tick.ns);
+	}
+	if (!ns.empty()) {
+		std::nth_element(ns.begin(), ns.begin() + ns.size()/2, ns.end());
+		trace.instructions = sumInstructions/trace.ticks.size();
+		trace.ns = ns[ns.size()/2];
+	}
+}
+
+static bool writeTrace(const char* name, const Trace& trace) {
+	FILE* out = fopen(name, "w");
+	if (out == NULL) {
+		perror(name);
+		return false;
+	}
+	fprintf(out, "# ticks=%u instructions=%.1f ns=%.1f\n", (unsigned)trace.ticks.size(), trace.instructions, trace.ns);
+	fprintf(out, "sequence");
+	for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+		fprintf(out, ",%s", SensorReplay::OutputName[i]);
+	fprintf(out, ",instructions,ns\n");
+	for (const TraceTick& tick : trace.ticks) {
+		fprintf(out, "%u", tick.sequence);
+		for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+			fprintf(out, ",%.9g", tick.output[i]);
+		fprintf(out, ",%llu,%u\n", (unsigned long long)tick.instructions, tick.ns);
+	}
+	fclose(out);
+	return true;
+}
+
+static bool readTrace(const char* name, Trace& trace) {
+	FILE* in = fopen(name, "r");
+	if (in == NULL) {
+		perror(name);
+		return false;
+	}
+	char line[1024];
+	unsigned ticks = 0;
+	if ((fgets(line, sizeof(line), in) == NULL) ||
+		(sscanf(line, "# ticks=%u instructions=%lf ns=%lf", &ticks, &trace.instructions, &trace.ns) != 3)) {
+		fprintf(stderr, "%s is not a golden trace\n", name);
+		fclose(in);
+		return false;
+	}
+
+	// the outputs need to be the same as those of this build
+	std::string header = "sequence";
+	for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+		header += std::string(",") + SensorReplay::OutputName[i];
+	header += ",instructions,ns\n";
+	if ((fgets(line, sizeof(line), in) == NULL) || (header != line)) {
+		fprintf(stderr, "%s has different columns than this build, write it again\n", name);
+		fclose(in);
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), in) != NULL) {
+		TraceTick tick;
+		char* p = line;
+		char* end = NULL;
+		int columns = 0;
+		double value[NumberOfColumns];
+		while (columns < NumberOfColumns) {
+			value[columns] = strtod(p, &end);
+			if (end == p)
+				break;
+			columns++;
+			p = (*end == ',')?end+1:end;
+		}
+		if (columns != NumberOfColumns) {
+			fprintf(stderr, "%s: line %u is broken\n", name, (unsigned)trace.ticks.size()+3);
+			fclose(in);
+			return false;
+		}
+		tick.sequence = value[0];
+		for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+			tick.output[i] = value[i+1];
+		tick.instructions = value[NumberOfColumns-2];
+		tick.ns = value[NumberOfColumns-1];
+		trace.ticks.push_back(tick);
+	}
+	fclose(in);
+	if (trace.ticks.size() != ticks) {
+		fprintf(stderr, "%s has %u instead of %u ticks\n", name, (unsigned)trace.ticks.size(), ticks);
+		return false;
+	}
+	return true;
+}
+
+// returns the index of the first tick that deviates, or -1
+static int compareNumerics(const Trace& trace, const Trace& golden, float absTolerance, float relTolerance) {
+	if (trace.ticks.size() != golden.ticks.size()) {
+		printf("FAILED: %u ticks replayed, golden trace has %u\n", (unsigned)trace.ticks.size(), (unsigned)golden.ticks.size());
+		return 0;
+	}
+
+	int failedTick = -1;
+	double maxDeviation[SensorReplay::NumberOfOutputs] = { 0 };
+	for (size_t t = 0;t<trace.ticks.size();t++) {
+		const TraceTick& is = trace.ticks[t];
+		const TraceTick& should = golden.ticks[t];
+		for (int i = 0;i<SensorReplay::NumberOfOutputs;i++) {
+			double deviation = fabs((double)is.output[i] - should.output[i]);
+			maxDeviation[i] = std::max(maxDeviation[i], deviation);
+			if ((failedTick < 0) && !(deviation <= absTolerance + relTolerance*fabs(should.output[i]))) {
+				printf("FAILED: %s deviates in tick %u (sequence %u): %.9g instead of %.9g\n",
+						SensorReplay::OutputName[i], (unsigned)t, is.sequence, is.output[i], should.output[i]);
+				failedTick = t;
+			}
+		}
+	}
+	printf("max deviation:");
+	for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+		printf(" %s=%.3g", SensorReplay::OutputName[i], maxDeviation[i]);
+	printf("\n");
+	return failedTick;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: golden_trace -i input.bin (-w golden.csv | -c golden.csv) [-n run] [-r repetitions]\n");
+	fprintf(stderr, "                    [-a abs tolerance] [-e rel tolerance] [-I instructions %%] [-T time %%]\n");
+	fprintf(stderr, "       -w write the golden trace, -c compare with it\n");
+	fprintf(stderr, "       -n number of the balancing run in the recording, default 1\n");
+	fprintf(stderr, "       -r repetitions to measure the cost, default 10\n");
+	fprintf(stderr, "       -a/-e tolerance of an output is abs + rel*|golden|, default 0, i.e. to the bit\n");
+	fprintf(stderr, "       -I allowed increase of the mean instructions per tick, default 2%%\n");
+	fprintf(stderr, "       -T allowed increase of the median time per tick, default 50%%, 0 switches it off\n");
+}
+
+int main(int argc, char* argv[]) {
+	const char* inputName = NULL;
+	const char* writeName = NULL;
+	const char* compareName = NULL;
+	int runNo = 1;
+	int repetitions = 10;
+	float absTolerance = 0;
+	float relTolerance = 0;
+	float instructionMargin = 2.0;
+	float timeMargin = 50.0;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-i") == 0) && hasValue)
+			inputName = argv[++i];
+		else if ((strcmp(argv[i], "-w") == 0) && hasValue)
+			writeName = argv[++i];
+		else if ((strcmp(argv[i], "-c") == 0) && hasValue)
+			compareName = argv[++i];
+		else if ((strcmp(argv[i], "-n") == 0) && hasValue)
+			runNo = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			repetitions = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-a") == 0) && hasValue)
+			absTolerance = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-e") == 0) && hasValue)
+			relTolerance = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-I") == 0) && hasValue)
+			instructionMargin = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-T") == 0) && hasValue)
+			timeMargin = atof(argv[++i]);
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((inputName == NULL) || ((writeName == NULL) == (compareName == NULL)) || (repetitions < 1)) {
+		usage();
+		return 1;
+	}
+
+	FILE* in = fopen(inputName, "rb");
+	if (in == NULL) {
+		perror(inputName);
+		return 1;
+	}
+	std::vector<SensorRecordingRun> runs;
+	SensorRecordingStatistics stat;
+	readSensorRecording(in, runs, stat);
+	fclose(in);
+	if ((runNo < 1) || (runNo > (int)runs.size())) {
+		fprintf(stderr, "run %d is not in %s\n", runNo, inputName);
+		return 1;
+	}
+	const SensorRecordingRun& run = runs[runNo-1];
+	if ((run.header.version != SensorRecordingVersion) || (run.header.layoutVersion != PersistentMemLayoutVersion)) {
+		fprintf(stderr, "recording version %u/layout %u does not fit to version %u/layout %u\n",
+				run.header.version, run.header.layoutVersion, SensorRecordingVersion, PersistentMemLayoutVersion);
+		return 1;
+	}
+
+	Trace golden;
+	if ((compareName != NULL) && !readTrace(compareName, golden))
+		return 1;
+
+	InstructionCounter counter;
+	if (!counter.setup())
+		fprintf(stderr, "no instruction counter on this machine, instructions are not checked\n");
+
+	// the control code must not log, the output goes to stdout
+	hostConsole.enable(false);
+	Trace trace;
+	replayRun(run, repetitions, counter, trace);
+	hostConsole.enable(true);
+
+	printf("%u ticks, %.0f instructions and %.0fns per tick\n",
+			(unsigned)trace.ticks.size(), trace.instructions, trace.ns);
+	if (writeName != NULL)
+		return writeTrace(writeName, trace)?0:1;
+
+	printf("golden trace: %.0f instructions and %.0fns per tick\n", golden.instructions, golden.ns);
+	if (compareNumerics(trace, golden, absTolerance, relTolerance) >= 0)
+		return 2;
+
+	bool slower = false;
+	if (counter.isAvailable() && (golden.instructions > 0) &&
+		(trace.instructions > golden.instructions*(1.0 + instructionMargin/100.0))) {
+		printf("FAILED: %.0f instructions per tick, %.1f%% more than the golden trace\n",
+				trace.instructions, (trace.instructions/golden.instructions - 1.0)*100.0);
+		slower = true;
+	}
+	if ((timeMargin > 0) && (golden.ns > 0) && (trace.ns > golden.ns*(1.0 + timeMargin/100.0))) {
+		printf("FAILED: %.0fns per tick, %.1f%% more than the golden trace\n",
+				trace.ns, (trace.ns/golden.ns - 1.0)*100.0);
+		slower = true;
+	}
+	if (slower)
+		return 3;
+	printf("passed\n");
+	return 0;
+}
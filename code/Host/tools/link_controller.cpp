@@ -0,0 +1,130 @@
+/*
+ * link_controller.cpp
+ *
+ * Bot controller side of the emulated link between Teensy and ESP8266. Runs the production
+ * I2CSlave on a virtual I2C bus and logs via BufferedSerial into a pseudo terminal that
+ * emulates Serial5, limited to its baud rate. Instead of balancing, it produces numbered log
+ * lines of a given bandwidth, so the webserver side (link_webserver) can measure what gets lost.
+ * Terminates when the webserver disconnects and prints the statistics of the serial line.
+ *
+ * use:
+ *     link_controller [-s serial link] [-i i2c socket] [-b baud] [-l log bytes/s] [-n line length] &
+ *     link_webserver [-s serial link] [-i i2c socket] [-b baud] [-r commands/s] [-t seconds]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <pty.h>
+#include <termios.h>
+#include <unistd.h>
+#include <common.h>
+#include <HostSerial.h>
+#include <libraries/I2CSlave.h>
+#include <libraries/BufferedSerial.h>
+
+HostSerial serial5;
+BufferedSerial bufferedSerial(serial5);
+
+I2CSlave* i2cSlave = new I2CSlave(&Wire1);
+
+static void usage() {
+	fprintf(stderr, "usage: link_controller [-s serial link] [-i i2c socket] [-b baud] [-l log bytes/s] [-n line length]\n");
+	fprintf(stderr, "       -s symbolic link to the pty of the serial line, default /tmp/flowerpot-serial\n");
+	fprintf(stderr, "       -i socket of the i2c bus, default /tmp/flowerpot-i2c.sock\n");
+	fprintf(stderr, "       -b baud rate of the serial line, default 230400\n");
+	fprintf(stderr, "       -l bandwidth of generated log lines, default 0\n");
+	fprintf(stderr, "       -n length of a generated log line, default 64\n");
+}
+
+int main(int argc, char* argv[]) {
+	const char* serialLink = "/tmp/flowerpot-serial";
+	const char* i2cSocket = "/tmp/flowerpot-i2c.sock";
+	uint32_t baud = 230400;
+	float logBandwidth = 0;
+	int lineLength = 64;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-s") == 0) && hasValue)
+			serialLink = argv[++i];
+		else if ((strcmp(argv[i], "-i") == 0) && hasValue)
+			i2cSocket = argv[++i];
+		else if ((strcmp(argv[i], "-b") == 0) && hasValue)
+			baud = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-l") == 0) && hasValue)
+			logBandwidth = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-n") == 0) && hasValue)
+			lineLength = atoi(argv[++i]);
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((baud == 0) || (logBandwidth < 0) || (lineLength < 16) || (lineLength > 256)) {
+		usage();
+		return 1;
+	}
+
+	// the webserver opens the other end of the pty via the symbolic link
+	int master, slave;
+	char slaveName[256];
+	if (openpty(&master, &slave, slaveName, NULL, NULL) != 0) {
+		perror("openpty");
+		return 1;
+	}
+	struct termios tio;
+	tcgetattr(slave, &tio);
+	cfmakeraw(&tio);
+	tcsetattr(slave, TCSANOW, &tio);
+	unlink(serialLink);
+	if (symlink(slaveName, serialLink) != 0) {
+		perror(serialLink);
+		return 1;
+	}
+	serial5.attach(master);
+	serial5.begin(baud);
+	logger = &bufferedSerial;
+	command = &bufferedSerial;
+
+	if (!Wire1.hostListen(i2cSocket)) {
+		perror(i2cSocket);
+		return 1;
+	}
+	i2cSlave->setup();
+	bufferedSerial.setPolicy(BufferedSerial::DROP_ON_FULL);
+	fprintf(stderr, "link_controller: serial %s -> %s, i2c %s\n", serialLink, slaveName, i2cSocket);
+
+	// the log starts when the webserver is there, what is sent before is not counted by it
+	while (!Wire1.hostConnected())
+		Wire1.hostPoll(100000);
+
+	// log lines are "log <seq> " padded to the line length
+	uint32_t lines = 0;
+	uint32_t start_us = micros();
+	char line[257];
+	while (Wire1.hostPoll(100)) {
+		i2cSlave->loop();
+
+		uint32_t due = (uint32_t)((uint64_t)(micros() - start_us)*logBandwidth/lineLength/1000000);
+		while (lines < due) {
+			int len = snprintf(line, sizeof(line), "log %u ", lines);
+			memset(&line[len], '.', lineLength - 2 - len);
+			line[lineLength-2] = '\r';
+			line[lineLength-1] = '\n';
+			bufferedSerial.write((const uint8_t*)line, lineLength);
+			lines++;
+		}
+		bufferedSerial.loop();
+	}
+
+	fprintf(stderr, "link_controller: %u log lines, dropped %u writes %u bytes, max buffer %d/%d bytes, overrun %u bytes\n",
+			lines, bufferedSerial.getDroppedWrites(), bufferedSerial.getDroppedBytes(),
+			bufferedSerial.getMaxUsed(), BufferedSerial::TxBufferSize, serial5.getOverrunBytes());
+	unlink(serialLink);
+	unlink(i2cSocket);
+	close(slave);
+	close(master);
+	return 0;
+}
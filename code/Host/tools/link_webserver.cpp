@@ -0,0 +1,212 @@
+/*
+ * link_webserver.cpp
+ *
+ * Webserver side of the emulated link between Teensy and ESP8266, load test of the link.
+ * Runs the production I2CMaster, LogBridge and LogStream of the webserver against
+ * link_controller, which has to be started before. Sends numbered commands at a given rate
+ * via I2C and reads the log of the bot controller out of the LogStream like the web page does:
+ * 		command throughput and commands that are not confirmed by their "execute" line in the log
+ * 		(when the serial line is saturated, the bot controller drops log output, not commands)
+ * 		duration of the I2C transactions of a command
+ * 		latency from sending a command until its "execute" line arrives in the log
+ * 		bandwidth of the forwarded log and log lines that got lost (gaps in their numbers)
+ *
+ * use:
+ *     link_controller -l 10000 &
+ *     link_webserver [-s serial link] [-i i2c socket] [-b baud] [-k i2c clock] [-r commands/s]
+ *                    [-t seconds] [-n command length]
+ *
+ * exit code is 2 if commands are not confirmed.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <poll.h>
+#include <vector>
+#include <algorithm>
+#include <common.h>
+#include <Wire.h>
+#include <HostSerial.h>
+#include <I2CMaster.h>
+#include <LogStream.h>
+#include <LogBridge.h>
+
+HostSerial botControllerLogs;
+LogBridge logBridge;
+I2CMaster* i2cMaster = new I2CMaster(&Wire);
+
+// what came back of the commands and the generated log lines
+struct LinkStatistics {
+	std::vector<uint32_t> sent_us;			// time when a command was passed to the I2CMaster, per command
+	std::vector<uint32_t> executed_us;		// time when the execute line arrived, 0 if it did not
+	std::vector<uint32_t> transaction_us;	// duration of I2CMaster::loop that sent a command
+	uint32_t sendErrors = 0;
+	uint32_t logLines = 0;
+	uint32_t lostLogLines = 0;
+	int64_t lastLogLine = -1;
+	uint32_t otherLines = 0;
+};
+
+static void parseLine(const char* line, LinkStatistics& stat) {
+	unsigned int seq;
+	if (sscanf(line, "execute (%*d)=[c%u", &seq) == 1) {
+		if ((seq < stat.executed_us.size()) && (stat.executed_us[seq] == 0))
+			stat.executed_us[seq] = micros();
+	} else if (sscanf(line, "log %u", &seq) == 1) {
+		stat.logLines++;
+		if ((int64_t)seq > stat.lastLogLine) {
+			stat.lostLogLines += seq - stat.lastLogLine - 1;
+			stat.lastLogLine = seq;
+		}
+	} else if ((strncmp(line, "send(", 5) == 0) && (strrchr(line, '=') != NULL)) {
+		// send(adr):[cmd]=status
+		if (atoi(strrchr(line, '=') + 1) != 0)
+			stat.sendErrors++;
+	} else
+		stat.otherLines++;
+}
+
+// read the log buffer line by line, like the web page does
+static void readLog(LinkStatistics& stat) {
+	static char line[512];
+	static int len = 0;
+	while (logger->available()) {
+		char c = logger->read();
+		if ((c == '\r') || (c == '\n')) {
+			if (len > 0) {
+				line[len] = 0;
+				parseLine(line, stat);
+			}
+			len = 0;
+		} else if (len < (int)sizeof(line)-1)
+			line[len++] = c;
+	}
+}
+
+static void printPercentiles(const char* name, std::vector<uint32_t> v) {
+	if (v.empty()) {
+		printf("%s: none\n", name);
+		return;
+	}
+	std::sort(v.begin(), v.end());
+	printf("%s: p50 %.2fms p99 %.2fms max %.2fms\n", name,
+			v[v.size()/2]/1000.0, v[(v.size()*99)/100]/1000.0, v.back()/1000.0);
+}
+
+static void usage() {
+	fprintf(stderr, "usage: link_webserver [-s serial link] [-i i2c socket] [-b baud] [-k i2c clock] [-r commands/s]\n");
+	fprintf(stderr, "                      [-t seconds] [-n command length]\n");
+	fprintf(stderr, "       -s pty of the serial line created by link_controller, default /tmp/flowerpot-serial\n");
+	fprintf(stderr, "       -i socket of the i2c bus, default /tmp/flowerpot-i2c.sock\n");
+	fprintf(stderr, "       -b baud rate of the serial line, default 230400\n");
+	fprintf(stderr, "       -k clock of the i2c bus, default 100000\n");
+	fprintf(stderr, "       -r commands per second, default 50\n");
+	fprintf(stderr, "       -t duration of the load test, default 10s\n");
+	fprintf(stderr, "       -n length of a command, default 8\n");
+}
+
+int main(int argc, char* argv[]) {
+	const char* serialLink = "/tmp/flowerpot-serial";
+	const char* i2cSocket = "/tmp/flowerpot-i2c.sock";
+	uint32_t baud = 230400;
+	uint32_t i2cClock = 100000;
+	float rate = 50;
+	float duration = 10;
+	int commandLength = 8;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-s") == 0) && hasValue)
+			serialLink = argv[++i];
+		else if ((strcmp(argv[i], "-i") == 0) && hasValue)
+			i2cSocket = argv[++i];
+		else if ((strcmp(argv[i], "-b") == 0) && hasValue)
+			baud = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-k") == 0) && hasValue)
+			i2cClock = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			rate = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-t") == 0) && hasValue)
+			duration = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-n") == 0) && hasValue)
+			commandLength = atoi(argv[++i]);
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((baud == 0) || (i2cClock == 0) || (rate <= 0) || (duration <= 0) ||
+		(commandLength < 8) || (commandLength >= TwoWire::BufferLength)) {
+		usage();
+		return 1;
+	}
+
+	// link_controller creates the pty before it listens on the bus
+	if (!Wire.hostConnect(i2cSocket, 5000)) {
+		fprintf(stderr, "link_webserver: cannot connect to %s, is link_controller running?\n", i2cSocket);
+		return 1;
+	}
+	if (!botControllerLogs.open(serialLink)) {
+		perror(serialLink);
+		return 1;
+	}
+	botControllerLogs.begin(baud);
+	Wire.setClock(i2cClock);
+	i2cMaster->setup();
+	logBridge.setup(&botControllerLogs, logger);
+
+	LinkStatistics stat;
+	uint32_t numberOfCommands = (uint32_t)(rate*duration);
+	stat.sent_us.reserve(numberOfCommands);
+	stat.executed_us.assign(numberOfCommands, 0);
+
+	// commands are "c<seq>:" padded to the command length
+	uint32_t start_us = micros();
+	uint32_t end_us = start_us + (uint32_t)(duration*1000000);
+	uint32_t drain_us = end_us + 500000;		// wait for the last commands and log lines
+	uint32_t now = start_us;
+	while ((int32_t)(now - drain_us) < 0) {
+		uint32_t due = min((uint32_t)((uint64_t)(now - start_us)*rate/1000000), numberOfCommands);
+		if (stat.sent_us.size() < due) {
+			char cmd[TwoWire::BufferLength];
+			int len = snprintf(cmd, sizeof(cmd), "c%u:", (uint32_t)stat.sent_us.size());
+			memset(&cmd[len], 'x', commandLength - len);
+			cmd[commandLength] = 0;
+			stat.sent_us.push_back(micros());
+			i2cMaster->sendCommandAsync(BotCtrlCmd_SerialCommand, cmd);
+		}
+
+		// that's subloop() of the webserver
+		logBridge.loop();
+		uint32_t transactionStart = micros();
+		bool pending = (stat.transaction_us.size() < stat.sent_us.size());
+		i2cMaster->loop();
+		if (pending)
+			stat.transaction_us.push_back(micros() - transactionStart);
+
+		readLog(stat);
+
+		struct pollfd p = { botControllerLogs.getFd(), POLLIN, 0 };
+		poll(&p, 1, 1);
+		now = micros();
+	}
+	Wire.hostDisconnect();
+
+	std::vector<uint32_t> latency;
+	for (uint32_t i = 0;i<stat.sent_us.size();i++)
+		if (stat.executed_us[i] != 0)
+			latency.push_back(stat.executed_us[i] - stat.sent_us[i]);
+	uint32_t unconfirmed = stat.sent_us.size() - latency.size();
+	float elapsed = (drain_us - start_us)/1000000.0;
+
+	printf("commands: %u sent in %.1fs (%.1f/s), %u confirmed by the log, %u unconfirmed, %u send errors\n",
+			(uint32_t)stat.sent_us.size(), duration, stat.sent_us.size()/duration,
+			(uint32_t)latency.size(), unconfirmed, stat.sendErrors);
+	printPercentiles("i2c transactions per command", stat.transaction_us);
+	printPercentiles("command latency until executed", latency);
+	printf("log: %.0f bytes/s forwarded, %u lines received, %u lost, %u other lines\n",
+			logBridge.getBytes()/elapsed, stat.logLines, stat.lostLogLines, stat.otherLines);
+	return (unconfirmed > 0)?2:0;
+}
@@ -0,0 +1,290 @@
+/*
+ * montecarlo.cpp
+ *
+ * Robustness of the state controller's configuration against the variations of a real bot.
+ * Runs many simulations in parallel (work stealing pool), each with randomly drawn imperfections
+ * of the IMU (noise, gyro bias, error of the null offset), latency of the motors, backlash of
+ * the gear box, ball mass and height of the centre of gravity, starting with a random tilt.
+ * Reports the probability to fall, the distribution of the max tilt, how close the wheels get
+ * to MaxWheelSpeed, and which imperfection the falls depend on (fall probability in the lower
+ * and upper half of each range). Every run draws from its own seed, so the result does not
+ * depend on the number of threads.
+ *
+ * use:
+ *     montecarlo [-n runs] [-j threads] [-s seed] [-t seconds] [-r range scale] [-e eeprom.bin]
+ *                [-f max fall %] [-o runs.csv]
+ *
+ * exit code is 2 if the fall probability exceeds the limit of -f.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <BotSimulator.h>
+#include <BotMemory.h>
+#include <HostConsole.h>
+#include <EEPROM.h>
+#include <WorkStealingPool.h>
+
+// drawn uniformly within [0, max*scale], resp. [nominal-deviation*scale, nominal+deviation*scale]
+struct Perturbation {
+	const char* name;
+	const char* unit;
+	float nominal;
+	float deviation;
+};
+
+enum PerturbationIndex { IMU_NOISE, GYRO_BIAS, NULL_OFFSET_ERROR, LATENCY, BACKLASH, BALL_MASS, COG_HEIGHT, INITIAL_TILT };
+
+static const Perturbation perturbations[] = {
+		{ "imu noise",			"deg",		0.1,	0.1 },		// standard deviation of the angle
+		{ "gyro bias",			"deg/s",	0.5,	0.5 },		// magnitude, direction is random
+		{ "null offset error",	"deg",		0.5,	0.5 },		// magnitude, direction is random
+		{ "latency",			"ms",		5.0,	5.0 },
+		{ "backlash",			"deg",		0.5,	0.5 },		// at the wheel
+		{ "ball mass",			"g",		BallWeight*1000.0,	BallWeight*1000.0*0.2 },
+		{ "cog height",			"mm",		CentreOfGravityHeight*1000.0,	20.0 },
+		{ "initial tilt",		"deg",		1.5,	1.5 } };		// magnitude, direction is random
+const int NumberOfPerturbations = sizeof(perturbations)/sizeof(Perturbation);
+
+struct Run {
+	float value[NumberOfPerturbations];
+	SimulationResult result;
+};
+
+static void drawRun(uint32_t seed, float scale, Run& run, BotModelParameters& parameters, float& tiltX, float& tiltY) {
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<float> uniform(-1.0, 1.0);
+	std::uniform_real_distribution<float> direction(0, TWO_PI);
+	for (int i = 0;i<NumberOfPerturbations;i++) {
+		const Perturbation& p = perturbations[i];
+		run.value[i] = max(0.0f, p.nominal + p.deviation*scale*uniform(random));
+	}
+
+	parameters.seed = seed;
+	parameters.imuAngleNoise = radians(run.value[IMU_NOISE]);
+	parameters.imuAngularVelocityNoise = 10.0*parameters.imuAngleNoise;
+	float a = direction(random);
+	parameters.imuAngularVelocityBias[X] = radians(run.value[GYRO_BIAS])*cos(a);
+	parameters.imuAngularVelocityBias[Y] = radians(run.value[GYRO_BIAS])*sin(a);
+	a = direction(random);
+	parameters.imuAngleBias[X] = radians(run.value[NULL_OFFSET_ERROR])*cos(a);
+	parameters.imuAngleBias[Y] = radians(run.value[NULL_OFFSET_ERROR])*sin(a);
+	parameters.actuatorLatency = run.value[LATENCY]/1000.0;
+	parameters.backlash = radians(run.value[BACKLASH]);
+	parameters.ballMass = run.value[BALL_MASS]/1000.0;
+	parameters.centreOfGravityHeight = run.value[COG_HEIGHT]/1000.0;
+	a = direction(random);
+	tiltX = radians(run.value[INITIAL_TILT])*cos(a);
+	tiltY = radians(run.value[INITIAL_TILT])*sin(a);
+}
+
+static void simulateRun(const StateControllerConfig& config, uint32_t seed, float scale, float duration, Run& run) {
+	BotModelParameters parameters;
+	float tiltX, tiltY;
+	drawRun(seed, scale, run, parameters, tiltX, tiltY);
+
+	BotSimulator sim;
+	sim.setup(config, parameters);
+	sim.reset(tiltX, tiltY);
+	run.result = sim.run(duration);
+}
+
+// Wilson score interval of a probability with 95% confidence
+static void confidenceInterval(int hits, int n, float& low, float& high) {
+	const float z = 1.96;
+	float p = (float)hits/n;
+	float centre = (p + z*z/(2*n))/(1 + z*z/n);
+	float halfWidth = z*sqrt(p*(1-p)/n + z*z/(4.0*n*n))/(1 + z*z/n);
+	low = max(0.0f, centre - halfWidth);
+	high = min(1.0f, centre + halfWidth);
+}
+
+static float percentile(std::vector<float> values, float p) {
+	if (values.empty())
+		return 0;
+	size_t k = min(values.size()-1, (size_t)(p*values.size()));
+	std::nth_element(values.begin(), values.begin() + k, values.end());
+	return values[k];
+}
+
+static void printReport(const std::vector<Run>& runs, float scale) {
+	int n = runs.size();
+	int fallen = 0;
+	int atSpeedLimit = 0;
+	float maxWheelSpeed = 0;
+	double sumSaturation = 0;
+	std::vector<float> maxTilt;
+	for (const Run& run : runs) {
+		if (run.result.fallen)
+			fallen++;
+		else
+			maxTilt.push_back(degrees(run.result.maxTilt));
+		if ((run.result.speedLimitHits > 0) || (run.result.maxWheelSpeed >= MaxWheelSpeed))
+			atSpeedLimit++;
+		maxWheelSpeed = max(maxWheelSpeed, run.result.maxWheelSpeed);
+		sumSaturation += run.result.saturation;
+	}
+
+	float low, high;
+	confidenceInterval(fallen, n, low, high);
+	printf("fallen: %d of %d runs, p=%.2f%% (95%% interval %.2f%%..%.2f%%)\n",
+			fallen, n, 100.0*fallen/n, 100.0*low, 100.0*high);
+	printf("max tilt of balanced runs: median=%.2fdeg p95=%.2fdeg p99=%.2fdeg worst=%.2fdeg\n",
+			percentile(maxTilt, 0.5), percentile(maxTilt, 0.95), percentile(maxTilt, 0.99), percentile(maxTilt, 1.0));
+	printf("wheel speed: max=%.2frev/s (%.0f%% of MaxWheelSpeed), %.2f%% of runs at the limit, mean saturation=%.2f%%\n",
+			maxWheelSpeed, 100.0*maxWheelSpeed/MaxWheelSpeed, 100.0*atSpeedLimit/n, 100.0*sumSaturation/n);
+
+	// fall probability in the lower and upper half of each range
+	printf("fall probability per half of the range (scale %.2f):\n", scale);
+	for (int i = 0;i<NumberOfPerturbations;i++) {
+		const Perturbation& p = perturbations[i];
+		int count[2] = { 0,0 };
+		int falls[2] = { 0,0 };
+		for (const Run& run : runs) {
+			int half = (run.value[i] >= p.nominal)?1:0;
+			count[half]++;
+			if (run.result.fallen)
+				falls[half]++;
+		}
+		printf("  %-18s %7.2f..%7.2f%-5s %6.2f%%   %7.2f..%7.2f%-5s %6.2f%%\n", p.name,
+				max(0.0f, p.nominal - p.deviation*scale), p.nominal, p.unit, count[0]?100.0*falls[0]/count[0]:0.0,
+				p.nominal, p.nominal + p.deviation*scale, p.unit, count[1]?100.0*falls[1]/count[1]:0.0);
+	}
+}
+
+static bool writeRuns(const char* name, const std::vector<Run>& runs) {
+	FILE* out = fopen(name, "w");
+	if (out == NULL) {
+		perror(name);
+		return false;
+	}
+	fprintf(out, "run");
+	for (int i = 0;i<NumberOfPerturbations;i++)
+		fprintf(out, ",%s [%s]", perturbations[i].name, perturbations[i].unit);
+	fprintf(out, ",fallen,duration,max_tilt,rms_tilt,max_wheel_speed,speed_limit_hits,saturation,settling_time\n");
+	for (size_t r = 0;r<runs.size();r++) {
+		const Run& run = runs[r];
+		fprintf(out, "%u", (unsigned)r);
+		for (int i = 0;i<NumberOfPerturbations;i++)
+			fprintf(out, ",%.4f", run.value[i]);
+		fprintf(out, ",%d,%.3f,%.4f,%.4f,%.3f,%u,%.4f,%.3f\n",
+				run.result.fallen?1:0, run.result.duration, degrees(run.result.maxTilt), degrees(run.result.rmsTilt),
+				run.result.maxWheelSpeed, run.result.speedLimitHits, run.result.saturation, run.result.settlingTime);
+	}
+	fclose(out);
+	return true;
+}
+
+static bool readImage(const char* name) {
+	FILE* in = fopen(name, "rb");
+	if (in == NULL) {
+		perror(name);
+		return false;
+	}
+	hostEEPROMErase();
+	size_t len = fread(hostEEPROM, 1, HostEEPROMSize, in);
+	fclose(in);
+
+	// setup initializes the memory if the image's magic number does not fit
+	if ((len == 0) || memory.setup()) {
+		fprintf(stderr, "%s is not an EEPROM image of layout version %u\n", name, PersistentMemLayoutVersion);
+		return false;
+	}
+	return true;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: montecarlo [-n runs] [-j threads] [-s seed] [-t seconds] [-r range scale] [-e eeprom.bin]\n");
+	fprintf(stderr, "                  [-f max fall %%] [-o runs.csv]\n");
+	fprintf(stderr, "       -n number of simulations, default 1000\n");
+	fprintf(stderr, "       -j number of threads, default is one per core\n");
+	fprintf(stderr, "       -t simulated time per run, default 10s\n");
+	fprintf(stderr, "       -r scale of the ranges of all imperfections, default 1\n");
+	fprintf(stderr, "       -e configuration out of an EEPROM image (autotune), default are the values of StateControllerConfig\n");
+	fprintf(stderr, "       -f fail if the fall probability is above this\n");
+	fprintf(stderr, "       -o write every run as csv\n");
+}
+
+int main(int argc, char* argv[]) {
+	int numberOfRuns = 1000;
+	int threads = 0;
+	uint32_t seed = 1;
+	float duration = 10.0;
+	float scale = 1.0;
+	float maxFallProbability = 100.0;
+	const char* imageName = NULL;
+	const char* outputName = NULL;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-n") == 0) && hasValue)
+			numberOfRuns = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-j") == 0) && hasValue)
+			threads = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-s") == 0) && hasValue)
+			seed = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-t") == 0) && hasValue)
+			duration = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			scale = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-e") == 0) && hasValue)
+			imageName = argv[++i];
+		else if ((strcmp(argv[i], "-f") == 0) && hasValue)
+			maxFallProbability = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			outputName = argv[++i];
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((numberOfRuns < 1) || (duration <= 0) || (scale < 0)) {
+		usage();
+		return 1;
+	}
+
+	StateControllerConfig config;
+	config.initDefaultValues();
+	if (imageName != NULL) {
+		if (!readImage(imageName))
+			return 1;
+		config = memory.persistentMem.ctrlConfig;
+	} else
+		memory.setup();
+
+	// the control code must not log, the report goes to stdout
+	memory.persistentMem.logConfig.null();
+	hostConsole.enable(false);
+
+	WorkStealingPool pool(threads);
+	std::vector<Run> runs(numberOfRuns);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int r = 0;r<numberOfRuns;r++)
+		pool.submit([&runs, &config, r, seed, scale, duration]() {
+			simulateRun(config, seed + r, scale, duration, runs[r]);
+		});
+	pool.wait();
+	float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	hostConsole.enable(true);
+
+	printf("%d runs of %.1fs in %.1fs on %d threads (%.0f/s)\n",
+			numberOfRuns, duration, elapsed, pool.size(), (elapsed > 0)?numberOfRuns/elapsed:0.0);
+	printReport(runs, scale);
+
+	if ((outputName != NULL) && !writeRuns(outputName, runs))
+		return 1;
+
+	int fallen = std::count_if(runs.begin(), runs.end(), [](const Run& run) { return run.result.fallen; });
+	if (100.0*fallen/numberOfRuns > maxFallProbability) {
+		printf("FAILED: fall probability is above %.2f%%\n", maxFallProbability);
+		return 2;
+	}
+	return 0;
+}
@@ -0,0 +1,835 @@
+/*
+ * mpc_design.cpp
+ *
+ * Offline design of the explicit MPC mode of the state controller (ExplicitMPC). The model is
+ * the linearised plane of LinearModel.h, predicted over a horizon of steps, each holding the
+ * acceleration for a couple of ticks. The cost is that of the LQR mode (Bryson's rule) with the
+ * Riccati solution of the step model as terminal cost, so without active constraints the law
+ * is close to the LQR mode. The constraints are the envelope of the bot:
+ *     |a| <= MaxBotAccel,  |θ| <= max tilt,  |ball speed| <= speed of MaxWheelSpeed
+ * where tilt and speed are the predicted errors plus target angle and target speed. The speed
+ * limit holds in x and y at the same time, i.e. it is that of the worst wheel in diagonal direction.
+ *
+ * The quadratic program of the horizon is condensed to the accelerations U of the steps
+ *     min ½U'HU + p'F'U  with  GU <= w + S·p
+ * with p being the parameter of ExplicitMPC. Its solution is affine in p as long as the set of
+ * active constraints does not change, and that set defines a polyhedral region of p (KKT
+ * conditions). Instead of enumerating all combinations of constraints, the tool solves the QP
+ * along random choreographies of the linear model and collects the active sets that occur, most
+ * frequent first. A second set of choreographies measures the coverage, i.e. how often the
+ * table returns the optimum. The table is written into MPCTable.h of the bot controller.
+ *
+ * use:
+ *     mpc_design [-n horizon] [-b ticks_per_step] [-l tilt_deg,wheel_speed_rev_s] [-a choreography_accel_m_s2]
+ *                [-c choreographies] [-x max_regions] [-s horizon,horizon,...] [-o MPCTable.h]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <map>
+#include <random>
+#include <algorithm>
+#include <setup.h>
+#include <Kinematics.h>
+#include <ExplicitMPC.h>
+#include <LinearModel.h>
+#include <GeneratedHeader.h>
+
+const int NP = MPCParameters;
+
+// weight of the slack, i.e. of the relative violation of the limits of tilt and speed. Weighted much
+// higher, the short horizon brakes hard and the bot falls over beyond the horizon
+const double SlackWeight = 1.0e3;
+
+struct Envelope {
+	double tilt = radians(12.0);			// [rad]	below MaxTiltAngle, where the bot stops balancing
+	double wheelSpeed = 0.9*MaxWheelSpeed;	// [rev/s]
+	double accel = MaxBotAccel;				// [m/s^2]
+	double speed = 0;						// [m/s]	ball speed of wheelSpeed, computed
+};
+
+struct Choreography {
+	double accel = -1;						// [m/s^2]	max target acceleration of a move, default 80% of the limit of the tilt
+	double speed = 0.6;						// max target speed relative to the limit, the bot overshoots when it stops accelerating
+	double duration = 5.0;					// [s]		of one choreography
+	double angularAccel = 5.0;				// [rad/s^2] standard deviation of the disturbance
+	int count = 200;						// number of choreographies to sample the regions
+};
+
+// condensed QP of the horizon, matrices in row major order
+struct Problem {
+	int horizon;
+	int ticks;								// per step
+	int variables;							// acceleration of each step and the slack of tilt and speed
+	int constraints;
+	std::vector<double> H;					// variables x variables
+	std::vector<double> Hinv;
+	std::vector<double> F;					// variables x NP
+	std::vector<double> G;					// constraints x variables
+	std::vector<double> w;					// constraints
+	std::vector<double> S;					// constraints x NP
+	std::vector<double> HinvG;				// variables x constraints, Hinv·G'
+	std::vector<double> GHinvG;				// constraints x constraints, G·Hinv·G'
+	double unconstrained[NP];				// gain of the unconstrained law, first step of -Hinv·F
+};
+
+// solution for a set of active constraints, U = K·p + c and multipliers λ = Λ·p + l
+struct AffineSolution {
+	std::vector<double> K, c, Lambda, l;
+};
+
+struct Region {
+	std::vector<int> active;
+	std::vector<double> rows;				// h·p <= k, NP+1 values per row
+	double gain[NP];
+	double offset;
+	int hits = 0;
+};
+
+struct Table {
+	std::vector<Region> regions;
+	double limit[NP];						// operating range of the parameter
+	int failed = 0;							// QPs without solution
+	int invalid = 0;						// active sets whose region does not contain the sample
+};
+
+// closed loop of the linear model with the online QP
+struct LoopStats {
+	double maxTilt = 0;
+	double maxSpeed = 0;
+	int ticks = 0;
+	int saturated = 0;						// ticks with the acceleration at its limit
+	int beyondTilt = 0;						// ticks beyond the limit of the tilt
+	int beyondSpeed = 0;
+};
+
+// ball speed [m/s] in x and y at the same time that keeps all wheels within the wheel speed
+static double ballSpeedLimit(double wheelSpeed) {
+	Kinematix kinematics;
+	kinematics.setup();
+	const float v = 0.01;
+	float x[3], y[3];
+	kinematics.computeWheelSpeed(v, 0, 0, 0, 0, x);
+	kinematics.computeWheelSpeed(0, v, 0, 0, 0, y);
+	double worst = 0;
+	for (int i = 0;i<3;i++)
+		worst = max(worst, (fabs(x[i]) + fabs(y[i]))/v);
+	return min(wheelSpeed/worst, (double)MaxBotSpeed);
+}
+
+static void addConstraint(Problem& qp, const std::vector<double>& g, double w, const double s[NP]) {
+	qp.G.insert(qp.G.end(), g.begin(), g.end());
+	qp.w.push_back(w);
+	qp.S.insert(qp.S.end(), s, s+NP);
+	qp.constraints++;
+}
+
+static bool setupProblem(Problem& qp, const LinearModel& model, const DesignWeights& weights, const Envelope& envelope,
+						 int horizon, int ticks) {
+	qp.horizon = horizon;
+	qp.ticks = ticks;
+	qp.constraints = 0;
+	const int n = horizon;
+
+	// model of a step, the acceleration is held for all its ticks
+	Matrix A;
+	Vector B;
+	memset(B, 0, sizeof(Vector));
+	for (int i = 0;i<N;i++)
+		for (int j = 0;j<N;j++)
+			A[i][j] = (i == j)?1.0:0.0;
+	for (int t = 0;t<ticks;t++) {
+		multiply(model.A, B, B);
+		for (int i = 0;i<N;i++)
+			B[i] += model.B[i];
+		multiply(model.A, A, A);
+	}
+
+	Vector Q, K;
+	double R;
+	Matrix P;
+	weights.costs(Q, R);
+	if (!solveRiccati(A, B, Q, R, K, P))
+		return false;
+
+	// prediction x(k) = Phi(k)·x(0) + sum Gamma(k,j)·u(j), k = 1..n
+	std::vector<double> Phi(n*N*N), Gamma(n*N*n, 0.0);
+	Matrix current;
+	memcpy(current, A, sizeof(Matrix));
+	for (int k = 0;k<n;k++) {
+		if (k > 0)
+			multiply(A, current, current);
+		for (int i = 0;i<N;i++)
+			for (int j = 0;j<N;j++)
+				Phi[(k*N+i)*N+j] = current[i][j];
+		// the input j reaches step k after k-j steps
+		for (int j = 0;j<=k;j++) {
+			Vector response;
+			memcpy(response, B, sizeof(Vector));
+			for (int s = 0;s<k-j;s++)
+				multiply(A, response, response);
+			for (int i = 0;i<N;i++)
+				Gamma[(k*N+i)*n+j] = response[i];
+		}
+	}
+
+	// cost sum x(k)'Q x(k) + R u(k)^2 with the Riccati solution P in the last step, and the slack
+	const int v = n+1;
+	qp.variables = v;
+	qp.H.assign(v*v, 0.0);
+	qp.F.assign(v*NP, 0.0);
+	for (int k = 0;k<n;k++) {
+		for (int i = 0;i<N;i++)
+			for (int j = 0;j<N;j++) {
+				double weight = (k == n-1)?P[i][j]:((i == j)?Q[i]:0.0);
+				if (weight == 0)
+					continue;
+				for (int a = 0;a<n;a++) {
+					double ga = Gamma[(k*N+i)*n+a];
+					for (int b = 0;b<n;b++)
+						qp.H[a*v+b] += ga*weight*Gamma[(k*N+j)*n+b];
+					for (int b = 0;b<N;b++)
+						qp.F[a*NP+b] += ga*weight*Phi[(k*N+j)*N+b];
+				}
+			}
+	}
+	for (int a = 0;a<n;a++)
+		qp.H[a*v+a] += R;
+	qp.H[n*v+n] = SlackWeight;
+	qp.Hinv.resize(v*v);
+	if (!invert(v, &qp.H[0], &qp.Hinv[0]))
+		return false;
+	for (int j = 0;j<NP;j++) {
+		qp.unconstrained[j] = 0;
+		for (int b = 0;b<v;b++)
+			qp.unconstrained[j] -= qp.Hinv[b]*qp.F[b*NP+j];
+	}
+
+	// hard constraints of the input
+	std::vector<double> g(v);
+	double s[NP];
+	for (int k = 0;k<n;k++) {
+		for (int sign = -1;sign<=1;sign += 2) {
+			std::fill(g.begin(), g.end(), 0.0);
+			std::fill(s, s+NP, 0.0);
+			g[k] = sign;
+			addConstraint(qp, g, envelope.accel, s);
+		}
+	}
+
+	// tilt and speed of each step may exceed the limit by the slack, otherwise the QP has no
+	// solution when a disturbance pushes the bot beyond, or when the bot needs to speed up before
+	// it can decelerate
+	const int limited[2] = { LQR_TILT, LQR_SPEED };
+	const int target[2] = { MPC_TARGET_ANGLE, MPC_TARGET_SPEED };
+	const double limit[2] = { envelope.tilt, envelope.speed };
+	for (int c = 0;c<2;c++)
+		for (int k = 0;k<n;k++)
+			for (int sign = -1;sign<=1;sign += 2) {
+				// sign·x(k) <= limit·(1 + slack) of the absolute tilt resp. speed, the target is
+				// predicted like the error, i.e. x(k) = Phi(k)·(error + target) + Gamma(k)·U
+				int i = limited[c];
+				for (int j = 0;j<n;j++)
+					g[j] = sign*Gamma[(k*N+i)*n+j];
+				g[n] = -limit[c];
+				std::fill(s, s+NP, 0.0);
+				for (int j = 0;j<N;j++)
+					s[j] = -sign*Phi[(k*N+i)*N+j];
+				s[target[c]] = -sign*Phi[(k*N+i)*N+i];
+				addConstraint(qp, g, limit[c], s);
+			}
+	std::fill(g.begin(), g.end(), 0.0);
+	std::fill(s, s+NP, 0.0);
+	g[n] = -1.0;
+	addConstraint(qp, g, 0, s);
+
+	const int m = qp.constraints;
+	qp.HinvG.assign(v*m, 0.0);
+	qp.GHinvG.assign(m*m, 0.0);
+	for (int a = 0;a<v;a++)
+		for (int i = 0;i<m;i++)
+			for (int b = 0;b<v;b++)
+				qp.HinvG[a*m+i] += qp.Hinv[a*v+b]*qp.G[i*v+b];
+	for (int i = 0;i<m;i++)
+		for (int j = 0;j<m;j++)
+			for (int a = 0;a<v;a++)
+				qp.GHinvG[i*m+j] += qp.G[i*v+a]*qp.HinvG[a*m+j];
+	return true;
+}
+
+static bool affineSolution(const Problem& qp, const std::vector<int>& active, AffineSolution& solution) {
+	const int n = qp.variables;
+	const int m = active.size();
+
+	// HinvF = Hinv·F, HinvG = Hinv·G_W'
+	std::vector<double> HinvF(n*NP, 0.0), HinvG(n*m, 0.0);
+	for (int a = 0;a<n;a++)
+		for (int b = 0;b<n;b++) {
+			double h = qp.Hinv[a*n+b];
+			for (int j = 0;j<NP;j++)
+				HinvF[a*NP+j] += h*qp.F[b*NP+j];
+			for (int i = 0;i<m;i++)
+				HinvG[a*m+i] += h*qp.G[active[i]*n+b];
+		}
+
+	// λ = -(G_W·Hinv·G_W')^-1 · ((S_W + G_W·Hinv·F)·p + w_W)
+	solution.Lambda.assign(m*NP, 0.0);
+	solution.l.assign(m, 0.0);
+	if (m > 0) {
+		std::vector<double> M(m*m, 0.0), Minv(m*m);
+		for (int i = 0;i<m;i++)
+			for (int j = 0;j<m;j++)
+				for (int a = 0;a<n;a++)
+					M[i*m+j] += qp.G[active[i]*n+a]*HinvG[a*m+j];
+		if (!invert(m, &M[0], &Minv[0]))
+			return false;
+		std::vector<double> T(m*NP);
+		for (int i = 0;i<m;i++)
+			for (int j = 0;j<NP;j++) {
+				T[i*NP+j] = qp.S[active[i]*NP+j];
+				for (int a = 0;a<n;a++)
+					T[i*NP+j] += qp.G[active[i]*n+a]*HinvF[a*NP+j];
+			}
+		for (int i = 0;i<m;i++)
+			for (int k = 0;k<m;k++) {
+				for (int j = 0;j<NP;j++)
+					solution.Lambda[i*NP+j] -= Minv[i*m+k]*T[k*NP+j];
+				solution.l[i] -= Minv[i*m+k]*qp.w[active[k]];
+			}
+	}
+
+	// U = -Hinv·(F·p + G_W'·λ)
+	solution.K.assign(n*NP, 0.0);
+	solution.c.assign(n, 0.0);
+	for (int a = 0;a<n;a++) {
+		for (int j = 0;j<NP;j++) {
+			solution.K[a*NP+j] = -HinvF[a*NP+j];
+			for (int i = 0;i<m;i++)
+				solution.K[a*NP+j] -= HinvG[a*m+i]*solution.Lambda[i*NP+j];
+		}
+		for (int i = 0;i<m;i++)
+			solution.c[a] -= HinvG[a*m+i]*solution.l[i];
+	}
+	return true;
+}
+
+static double dot(const double* a, const double* p) {
+	double sum = 0;
+	for (int j = 0;j<NP;j++)
+		sum += a[j]*p[j];
+	return sum;
+}
+
+// dual active set method of Goldfarb and Idnani: starts at the unconstrained minimum and adds
+// violated constraints while keeping the multipliers positive. A constraint that depends on the
+// active ones (the speed rows of two steps differ by the bound of one input) is added by dropping
+// one of them first. Returns the optimal active set in ascending order
+static bool solveQP(const Problem& qp, const double p[NP], std::vector<int>& active, AffineSolution& solution) {
+	const int n = qp.variables;
+	const int m = qp.constraints;
+	const double Tolerance = 1.0e-9;
+	std::vector<double> x(n, 0.0), b(m);
+	for (int a = 0;a<n;a++)
+		for (int c = 0;c<n;c++)
+			x[a] -= qp.Hinv[a*n+c]*dot(&qp.F[c*NP], p);
+	for (int i = 0;i<m;i++)
+		b[i] = qp.w[i] + dot(&qp.S[i*NP], p);
+
+	active.clear();
+	std::vector<double> lambda;
+	for (int iteration = 0;iteration<4*m;iteration++) {
+		// most violated constraint
+		int q = -1;
+		double violation = 0;
+		for (int i = 0;i<m;i++) {
+			if (std::find(active.begin(), active.end(), i) != active.end())
+				continue;
+			double value = -b[i];
+			for (int a = 0;a<n;a++)
+				value += qp.G[i*n+a]*x[a];
+			if ((value > Tolerance*(1.0 + fabs(b[i]))) && (value > violation)) {
+				violation = value;
+				q = i;
+			}
+		}
+		if (q < 0) {
+			std::sort(active.begin(), active.end());
+			return affineSolution(qp, active, solution);
+		}
+
+		double lambdaQ = 0;
+		for (int step = 0;step<=m;step++) {
+			// change of the multipliers r and of the solution z per change of λq
+			const int k = active.size();
+			std::vector<double> M(k*k), Minv(k*k), rhs(k, 0.0), r(k, 0.0);
+			for (int i = 0;i<k;i++) {
+				for (int j = 0;j<k;j++)
+					M[i*k+j] = qp.GHinvG[active[i]*m+active[j]];
+				rhs[i] = qp.GHinvG[active[i]*m+q];
+			}
+			if ((k > 0) && !invert(k, &M[0], &Minv[0]))
+				return false;
+			for (int i = 0;i<k;i++)
+				for (int j = 0;j<k;j++)
+					r[i] += Minv[i*k+j]*rhs[j];
+			std::vector<double> z(n);
+			for (int a = 0;a<n;a++) {
+				z[a] = -qp.HinvG[a*m+q];
+				for (int i = 0;i<k;i++)
+					z[a] += qp.HinvG[a*m+active[i]]*r[i];
+			}
+			double curvature = 0, slack = b[q];
+			for (int a = 0;a<n;a++) {
+				curvature -= qp.G[q*n+a]*z[a];
+				slack -= qp.G[q*n+a]*x[a];
+			}
+
+			// partial step until a multiplier becomes zero, full step until q is satisfied
+			int drop = -1;
+			double partial = INFINITY;
+			for (int i = 0;i<k;i++)
+				if ((r[i] > Tolerance) && (lambda[i]/r[i] < partial)) {
+					partial = lambda[i]/r[i];
+					drop = i;
+				}
+			double full = (curvature > Tolerance)?(-slack/curvature):INFINITY;
+			double t = min(partial, full);
+			if (std::isinf(t))
+				return false;
+
+			if (!std::isinf(full))
+				for (int a = 0;a<n;a++)
+					x[a] += t*z[a];
+			for (int i = 0;i<k;i++)
+				lambda[i] -= t*r[i];
+			lambdaQ += t;
+			if (t == full) {
+				active.push_back(q);
+				lambda.push_back(lambdaQ);
+				break;
+			}
+			active.erase(active.begin() + drop);
+			lambda.erase(lambda.begin() + drop);
+		}
+	}
+	return false;
+}
+
+// region of an active set out of the KKT conditions, rows that cannot be violated within the
+// operating range are left out
+static bool buildRegion(const Problem& qp, const std::vector<int>& active, const AffineSolution& solution,
+						const double limit[NP], const double p[NP], Region& region) {
+	const int n = qp.variables;
+	region.active = active;
+	region.rows.clear();
+	for (int j = 0;j<NP;j++)
+		region.gain[j] = solution.K[j];
+	region.offset = solution.c[0];
+
+	unsigned a = 0;
+	for (int i = 0;i<qp.constraints;i++) {
+		double h[NP+1];
+		if ((a < active.size()) && (active[a] == i)) {
+			// multiplier stays positive, -λ <= 0
+			for (int j = 0;j<NP;j++)
+				h[j] = -solution.Lambda[a*NP+j];
+			h[NP] = solution.l[a];
+			a++;
+		} else {
+			// inactive constraint stays satisfied, (G·K - S)·p <= w - G·c
+			for (int j = 0;j<NP;j++) {
+				h[j] = -qp.S[i*NP+j];
+				for (int b = 0;b<n;b++)
+					h[j] += qp.G[i*n+b]*solution.K[b*NP+j];
+			}
+			h[NP] = qp.w[i];
+			for (int b = 0;b<n;b++)
+				h[NP] -= qp.G[i*n+b]*solution.c[b];
+		}
+		double norm = 0;
+		for (int j = 0;j<NP;j++)
+			norm += h[j]*h[j];
+		norm = sqrt(norm);
+		if (norm < 1.0e-12) {
+			if (h[NP] < -1.0e-9)
+				return false;
+			continue;
+		}
+		for (int j = 0;j<=NP;j++)
+			h[j] /= norm;
+
+		// redundant within the operating range
+		double reach = 0;
+		for (int j = 0;j<NP;j++)
+			reach += fabs(h[j])*limit[j];
+		if (reach <= h[NP])
+			continue;
+		if (dot(h, p) > h[NP] + 1.0e-6)
+			return false;
+
+		bool duplicate = false;
+		for (unsigned r = 0;r<region.rows.size() && !duplicate;r += NP+1) {
+			duplicate = true;
+			for (int j = 0;j<=NP;j++)
+				duplicate = duplicate && (fabs(region.rows[r+j] - h[j]) < 1.0e-9);
+		}
+		if (!duplicate)
+			region.rows.insert(region.rows.end(), h, h+NP+1);
+	}
+	return true;
+}
+
+static bool insideRegion(const Region& region, const double p[NP]) {
+	for (unsigned r = 0;r<region.rows.size();r += NP+1)
+		if (dot(&region.rows[r], p) > region.rows[r+NP])
+			return false;
+	return true;
+}
+
+// runs random choreographies on the linear model with the online QP and calls the sampler with each parameter.
+// Without constraints the unconstrained law is limited to the max acceleration, like by the ControlPlane
+template<class Sampler> static void runChoreographies(const Problem& qp, const LinearModel& model, const Envelope& envelope,
+								   const Choreography& choreography, unsigned seed, bool constrained,
+								   LoopStats& stats, Sampler sampler) {
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+	std::normal_distribution<double> normal(0.0, 1.0);
+	std::vector<int> active;
+	AffineSolution solution;
+
+	int ticks = choreography.duration*SampleFrequency;
+	for (int c = 0;c<choreography.count;c++) {
+		// absolute state of the plane, the integrated position is that of the error
+		Vector x;
+		memset(x, 0, sizeof(Vector));
+		x[LQR_TILT] = radians(2.0)*uniform(random);
+		x[LQR_ANGULAR_VELOCITY] = radians(10.0)*uniform(random);
+		double targetAccel = 0, moveAccel = 0, targetSpeed = 0, targetPos = 0, lastTargetAngle = 0;
+		int moveTicks = 0;
+		for (int tick = 0;tick<ticks;tick++) {
+			// moves with random acceleration and duration, ramped like by the trajectory
+			if (--moveTicks <= 0) {
+				moveAccel = choreography.accel*uniform(random);
+				moveTicks = (0.35 + 0.25*uniform(random))*SampleFrequency;
+			}
+			double maxSpeed = choreography.speed*envelope.speed;
+			if (fabs(targetSpeed + targetAccel*SamplingTime) > maxSpeed)
+				moveAccel = 0;
+			targetAccel += (moveAccel - targetAccel)*SamplingTime/0.05;
+			targetSpeed = constrain(targetSpeed + targetAccel*SamplingTime, -maxSpeed, maxSpeed);
+			targetPos += targetSpeed*SamplingTime;
+			double targetAngle = targetAccel/Gravity;
+
+			double p[NP];
+			p[LQR_TILT] = x[LQR_TILT] - targetAngle;
+			p[LQR_ANGULAR_VELOCITY] = x[LQR_ANGULAR_VELOCITY] - (targetAngle - lastTargetAngle)/SamplingTime;
+			p[LQR_POS] = x[LQR_POS] - targetPos;
+			p[LQR_SPEED] = x[LQR_SPEED] - targetSpeed;
+			p[LQR_POS_INTEGRATED] = x[LQR_POS_INTEGRATED];
+			p[MPC_TARGET_ANGLE] = targetAngle;
+			p[MPC_TARGET_SPEED] = targetSpeed;
+			lastTargetAngle = targetAngle;
+
+			double accel;
+			if (constrained && solveQP(qp, p, active, solution)) {
+				accel = dot(&solution.K[0], p) + solution.c[0];
+				sampler(p, active, solution, accel);
+			} else {
+				accel = dot(qp.unconstrained, p);
+				sampler(p, active, solution, NAN);
+			}
+			accel = constrain(accel, -envelope.accel, envelope.accel);
+			if (fabs(accel) > 0.999*envelope.accel)
+				stats.saturated++;
+
+			Vector next;
+			multiply(model.A, x, next);
+			for (int i = 0;i<N;i++)
+				x[i] = next[i] + model.B[i]*accel;
+			x[LQR_POS_INTEGRATED] = p[LQR_POS_INTEGRATED] + p[LQR_POS]*SamplingTime;
+			x[LQR_ANGULAR_VELOCITY] += choreography.angularAccel*SamplingTime*normal(random);
+
+			stats.maxTilt = max(stats.maxTilt, fabs(x[LQR_TILT]));
+			stats.maxSpeed = max(stats.maxSpeed, fabs(x[LQR_SPEED]));
+			if (fabs(x[LQR_TILT]) > envelope.tilt)
+				stats.beyondTilt++;
+			if (fabs(x[LQR_SPEED]) > envelope.speed)
+				stats.beyondSpeed++;
+			stats.ticks++;
+		}
+	}
+}
+
+static void buildTable(const Problem& qp, const LinearModel& model, const Envelope& envelope,
+					   const Choreography& choreography, int maxRegions, Table& table, LoopStats& stats) {
+	// operating range out of a first run, with some margin
+	std::vector<std::vector<double>> samples;
+	for (int j = 0;j<NP;j++)
+		table.limit[j] = 0;
+	runChoreographies(qp, model, envelope, choreography, 1, true, stats,
+		[&](const double* p, const std::vector<int>& active, const AffineSolution& solution, double accel) {
+			for (int j = 0;j<NP;j++)
+				table.limit[j] = max(table.limit[j], 1.2*fabs(p[j]));
+			if (!std::isnan(accel))
+				samples.push_back(std::vector<double>(p, p+NP));
+			else
+				table.failed++;
+	});
+
+	// regions of the active sets of all samples
+	std::map<std::vector<int>, int> index;
+	std::vector<int> active;
+	AffineSolution solution;
+	for (const std::vector<double>& p : samples) {
+		if (!solveQP(qp, &p[0], active, solution))
+			continue;
+		auto found = index.find(active);
+		if (found != index.end()) {
+			table.regions[found->second].hits++;
+			continue;
+		}
+		Region region;
+		if (!buildRegion(qp, active, solution, table.limit, &p[0], region)) {
+			table.invalid++;
+			continue;
+		}
+		region.hits = 1;
+		index[active] = table.regions.size();
+		table.regions.push_back(region);
+	}
+
+	// unconstrained region first, the others by frequency
+	std::stable_sort(table.regions.begin(), table.regions.end(), [](const Region& a, const Region& b) {
+		if (a.active.empty() != b.active.empty())
+			return a.active.empty();
+		return a.hits > b.hits;
+	});
+	if ((maxRegions > 0) && ((int)table.regions.size() > maxRegions))
+		table.regions.resize(maxRegions);
+}
+
+// share of the parameters of new choreographies, for which the table returns the optimum like the bot controller does
+static double coverage(const Problem& qp, const LinearModel& model, const Envelope& envelope,
+					   const Choreography& choreography, const Table& table) {
+	int samples = 0, covered = 0;
+	LoopStats stats;
+	runChoreographies(qp, model, envelope, choreography, 2, true, stats,
+		[&](const double* p, const std::vector<int>& active, const AffineSolution& solution, double accel) {
+			if (std::isnan(accel))
+				return;
+			samples++;
+			for (int j = 0;j<NP;j++)
+				if (fabs(p[j]) > table.limit[j])
+					return;
+			for (const Region& region : table.regions)
+				if (insideRegion(region, p)) {
+					if (fabs(dot(region.gain, p) + region.offset - accel) < 1.0e-3)
+						covered++;
+					return;
+				}
+	});
+	return (samples > 0)?100.0*covered/samples:0;
+}
+
+static int tableRows(const Table& table) {
+	int rows = 0;
+	for (const Region& region : table.regions)
+		rows += region.rows.size()/(NP+1);
+	return rows;
+}
+
+static int tableBytes(const Table& table) {
+	return tableRows(table)*sizeof(MPCRow) + table.regions.size()*sizeof(MPCRegion) + NP*sizeof(float);
+}
+
+// evaluation of a parameter outside all regions, i.e. all rows of all regions and the affine law
+static int worstCaseMACs(const Table& table) {
+	return tableRows(table)*NP + NP;
+}
+
+// rounding errors of the elimination are written as zero
+static double rounded(double value) {
+	return (fabs(value) < 1.0e-9)?0.0:value;
+}
+
+static bool writeHeader(const char* name, const Problem& qp, const Envelope& envelope, const Choreography& choreography,
+						const Table& table, double coverage, int argc, char* argv[]) {
+	FILE* out = openHeader(name, "mpc_design", "MPCTable.h", "Regions of the explicit MPC mode of the ControlPlane", argc, argv);
+	if (out == NULL)
+		return false;
+	fprintf(out, " * horizon %d steps of %d ticks, limits: accel %.2fm/s^2, tilt %.1fdeg, wheel speed %.2frev/s, i.e. ball speed %.3fm/s.\n",
+			qp.horizon, qp.ticks, envelope.accel, degrees(envelope.tilt), envelope.wheelSpeed, envelope.speed);
+	fprintf(out, " * %d regions with %d rows out of %d choreographies up to %.2fm/s^2, coverage %.2f%%\n",
+			(int)table.regions.size(), tableRows(table), choreography.count, choreography.accel, coverage);
+	beginHeader(out, "MPCTABLE_H_");
+	fprintf(out, "#include <ExplicitMPC.h>\n\n");
+	fprintf(out, "// the table is valid for this sample frequency only\n");
+	fprintf(out, "const int MPCSampleFrequency = %d;\n\n", SampleFrequency);
+	fprintf(out, "const int MPCRegions = %d;\n", (int)table.regions.size());
+	fprintf(out, "const int MPCRows = %d;\n\n", tableRows(table));
+	fprintf(out, "// operating range of the parameter, beyond the rows of the regions are not complete\n");
+	fprintf(out, "constexpr float MPCParameterLimit[%d] = { ", NP);
+	for (int j = 0;j<NP;j++)
+		fprintf(out, "%s%.6g", (j > 0)?", ":"", table.limit[j]);
+	fprintf(out, " };\n\n");
+	fprintf(out, "// rows of all regions, h·p <= k\n");
+	fprintf(out, "constexpr MPCRow MPCRowTable[%d] = {\n", tableRows(table));
+	int row = 0;
+	for (unsigned r = 0;r<table.regions.size();r++) {
+		const Region& region = table.regions[r];
+		for (unsigned i = 0;i<region.rows.size();i += NP+1) {
+			fprintf(out, "\t{ ");
+			for (int j = 0;j<=NP;j++)
+				fprintf(out, "%s%.8g", (j > 0)?", ":"", rounded(region.rows[i+j]));
+			fprintf(out, " }%s\n", (++row < tableRows(table))?",":"");
+		}
+	}
+	fprintf(out, "};\n\n");
+	fprintf(out, "// regions, the unconstrained one first, the others by frequency\n");
+	fprintf(out, "constexpr MPCRegion MPCRegionTable[%d] = {\n", (int)table.regions.size());
+	row = 0;
+	for (unsigned r = 0;r<table.regions.size();r++) {
+		const Region& region = table.regions[r];
+		int rows = region.rows.size()/(NP+1);
+		fprintf(out, "\t{ %d, %d, { ", row, rows);
+		for (int j = 0;j<NP;j++)
+			fprintf(out, "%s%.8g", (j > 0)?", ":"", rounded(region.gain[j]));
+		fprintf(out, " }, %.8g }%s\n", rounded(region.offset), (r+1 < table.regions.size())?",":"");
+		row += rows;
+	}
+	fprintf(out, "};\n\n");
+	closeHeader(out, "MPCTABLE_H_");
+	return true;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: mpc_design [-n horizon] [-b ticks_per_step] [-l tilt_deg,wheel_speed_rev_s] [-a choreography_accel_m_s2]\n");
+	fprintf(stderr, "                  [-c choreographies] [-x max_regions] [-s horizon,horizon,...] [-o MPCTable.h]\n");
+	fprintf(stderr, "       -n steps of the horizon of the table, default 3\n");
+	fprintf(stderr, "       -b ticks per step, default 20\n");
+	fprintf(stderr, "       -l limits of tilt and wheel speed, default 12°,%.2frev/s\n", 0.9*MaxWheelSpeed);
+	fprintf(stderr, "       -a max acceleration of the moves of the choreographies, default 80%% of what the max tilt can sustain\n");
+	fprintf(stderr, "       -c number of choreographies of 5s, default 200\n");
+	fprintf(stderr, "       -x max number of regions of the table, the rare ones are left out, default all\n");
+	fprintf(stderr, "       -s report the table size of these horizons\n");
+	fprintf(stderr, "       -o write the table for the bot controller\n");
+}
+
+int main(int argc, char* argv[]) {
+	DesignWeights weights;
+	Envelope envelope;
+	Choreography choreography;
+	int horizon = 3;
+	int ticks = 20;
+	int maxRegions = 0;
+	std::vector<int> sweep;
+	const char* headerName = NULL;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-n") == 0) && hasValue)
+			horizon = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-b") == 0) && hasValue)
+			ticks = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-l") == 0) && hasValue) {
+			double tilt;
+			if (sscanf(argv[++i], "%lf,%lf", &tilt, &envelope.wheelSpeed) != 2) {
+				usage();
+				return 1;
+			}
+			envelope.tilt = radians(tilt);
+		} else if ((strcmp(argv[i], "-a") == 0) && hasValue)
+			choreography.accel = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-c") == 0) && hasValue)
+			choreography.count = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-x") == 0) && hasValue)
+			maxRegions = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-s") == 0) && hasValue) {
+			for (char* token = strtok(argv[++i], ",");token != NULL;token = strtok(NULL, ","))
+				sweep.push_back(atoi(token));
+		} else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			headerName = argv[++i];
+		else {
+			usage();
+			return 1;
+		}
+	}
+	if ((horizon < 1) || (ticks < 1) || (envelope.tilt <= 0) || (envelope.tilt > MaxTiltAngle) ||
+		(envelope.wheelSpeed <= 0) || (choreography.count < 1) || (maxRegions < 0)) {
+		usage();
+		return 1;
+	}
+	for (int n : sweep)
+		if (n < 1) {
+			usage();
+			return 1;
+		}
+
+	LinearModel model;
+	discreteModel(model);
+	envelope.speed = ballSpeedLimit(envelope.wheelSpeed);
+	printf("limits: accel %.2fm/s^2, tilt %.1f°, wheel speed %.2frev/s, i.e. ball speed %.3fm/s in x and y\n",
+			envelope.accel, degrees(envelope.tilt), envelope.wheelSpeed, envelope.speed);
+
+	// a constant acceleration requires the tilt where gravity compensates the reaction of the ball
+	double sustained = envelope.tilt*model.angularAccelTilt/fabs(model.angularAccelInput);
+	if (choreography.accel < 0)
+		choreography.accel = 0.8*sustained;
+	printf("max tilt sustains an acceleration of %.2fm/s^2, choreographies up to %.2fm/s^2\n", sustained, choreography.accel);
+
+	if (std::find(sweep.begin(), sweep.end(), horizon) == sweep.end())
+		sweep.push_back(horizon);
+	printf("                                                                      online QP                          unconstrained law within max accel\n");
+	printf("horizon  steps  regions   rows  flash[bytes]  worst case MACs  coverage  max tilt max speed  beyond limits  max tilt max speed  beyond limits\n");
+	Problem chosen;
+	Table chosenTable;
+	double chosenCoverage = 0;
+	for (int n : sweep) {
+		Problem qp;
+		if (!setupProblem(qp, model, weights, envelope, n, ticks)) {
+			fprintf(stderr, "horizon of %d steps has no solution\n", n);
+			return 2;
+		}
+		Table table;
+		LoopStats stats, clamped;
+		buildTable(qp, model, envelope, choreography, maxRegions, table, stats);
+		double covered = coverage(qp, model, envelope, choreography, table);
+		runChoreographies(qp, model, envelope, choreography, 1, false, clamped,
+				[](const double*, const std::vector<int>&, const AffineSolution&, double) {});
+		printf("%5.2fs  %5d  %7d  %5d  %12d  %15d  %7.2f%%  %6.2f°  %5.3fm/s  %5.2f%%  %5.2f%%  %6.2f°  %5.3fm/s  %5.2f%%  %5.2f%%\n",
+				n*ticks*SamplingTime, n, (int)table.regions.size(), tableRows(table), tableBytes(table), worstCaseMACs(table), covered,
+				degrees(stats.maxTilt), stats.maxSpeed, 100.0*stats.beyondTilt/stats.ticks, 100.0*stats.beyondSpeed/stats.ticks,
+				degrees(clamped.maxTilt), clamped.maxSpeed, 100.0*clamped.beyondTilt/clamped.ticks, 100.0*clamped.beyondSpeed/clamped.ticks);
+		if (table.failed > 0)
+			fprintf(stderr, "%d QPs of the horizon of %d steps have no solution\n", table.failed, n);
+		if (n == horizon) {
+			chosen = qp;
+			chosenTable = table;
+			chosenCoverage = covered;
+		}
+	}
+
+	// the unconstrained law is applied in each tick, not held for a step like in the prediction
+	Matrix closedLoop;
+	for (int i = 0;i<N;i++)
+		for (int j = 0;j<N;j++)
+			closedLoop[i][j] = model.A[i][j] + model.B[i]*chosen.unconstrained[j];
+	double radius = spectralRadius(closedLoop);
+	printf("unconstrained gains (tilt, angular velocity, pos, speed, integrated pos) = (%.4f, %.4f, %.4f, %.4f, %.4f)\n",
+			chosen.unconstrained[LQR_TILT], chosen.unconstrained[LQR_ANGULAR_VELOCITY], chosen.unconstrained[LQR_POS],
+			chosen.unconstrained[LQR_SPEED], chosen.unconstrained[LQR_POS_INTEGRATED]);
+	printf("spectral radius of the unconstrained closed loop %.6f\n", radius);
+	if (radius >= 1.0) {
+		fprintf(stderr, "closed loop is unstable\n");
+		return 2;
+	}
+	if (chosenTable.regions.empty() || !chosenTable.regions[0].active.empty()) {
+		fprintf(stderr, "table does not contain the unconstrained region\n");
+		return 2;
+	}
+
+	if ((headerName != NULL) && !writeHeader(headerName, chosen, envelope, choreography, chosenTable, chosenCoverage, argc, argv))
+		return 1;
+	return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * sensor_replay.cpp
+ *
+ * Replays a sensor recording of the bot (menu 'R' of the bot controller, see SensorRecording.h)
+ * through the control code, i.e. re-executes a balancing run of the bot on the host. Writes
+ * the course of each tick as csv, with all digits needed to compare floats to the bit. With -r
+ * the run is repeated, to profile it and to check that the replay is deterministic.
+ *
+ * use:
+ *     stty -F /dev/ttyUSB0 230400 raw; cat /dev/ttyUSB0 > recording.bin
+ *     sensor_replay [-n run] [-r repetitions] [-p] [-o trace.csv] recording.bin
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <SensorReplay.h>
+#include <Profiler.h>
+#include <HostConsole.h>
+
+static void printTraceHeader(FILE* out) {
+	fprintf(out, "sequence,tick_us");
+	for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+		fprintf(out, ",%s", SensorReplay::OutputName[i]);
+	fprintf(out, "\n");
+}
+
+static void printTrace(FILE* out, const SensorRecordingSample& sample, SensorReplay& replay) {
+	float output[SensorReplay::NumberOfOutputs];
+	replay.getOutput(output);
+	fprintf(out, "%u,%u", sample.sequence, sample.tick_us);
+	for (int i = 0;i<SensorReplay::NumberOfOutputs;i++)
+		fprintf(out, ",%.9g", output[i]);
+	fprintf(out, "\n");
+}
+
+// FNV-1a over the outputs of a tick, to compare repetitions of the replay
+static uint64_t hashOutput(uint64_t hash, SensorReplay& replay) {
+	float output[SensorReplay::NumberOfOutputs];
+	replay.getOutput(output);
+	const uint8_t* b = (const uint8_t*)output;
+	for (size_t i = 0;i<sizeof(output);i++)
+		hash = (hash ^ b[i])*1099511628211ULL;
+	return hash;
+}
+
+// replay the run until the first gap, returns the hash of all outputs
+static uint64_t replayRun(const SensorRecordingRun& run, FILE* trace, size_t& ticks) {
+	SensorReplay replay;
+	if (!replay.setup(run.header))
+		return 0;
+	uint64_t hash = 14695981039346656037ULL;
+	size_t nextTarget = 0;
+	for (ticks = 0;ticks<run.samples.size();ticks++) {
+		const SensorRecordingSample& sample = run.samples[ticks];
+		if ((ticks > 0) && ((uint16_t)(run.samples[ticks-1].sequence + 1) != sample.sequence))
+			break;
+		while ((nextTarget < run.targets.size()) && (run.targets[nextTarget].first <= ticks))
+			replay.setTarget(run.targets[nextTarget++].second);
+		replay.tick(sample);
+		hash = hashOutput(hash, replay);
+		if (trace)
+			printTrace(trace, sample, replay);
+	}
+	return hash;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: sensor_replay [-n run] [-r repetitions] [-p] [-o trace.csv] recording.bin\n");
+	fprintf(stderr, "       -n number of the balancing run in the recording, default 1\n");
+	fprintf(stderr, "       -r repeat the replay and check that it is deterministic\n");
+	fprintf(stderr, "       -p print the profile of the control code\n");
+}
+
+int main(int argc, char* argv[]) {
+	const char* inputName = NULL;
+	const char* traceName = NULL;
+	int runNo = 1;
+	int repetitions = 1;
+	bool profile = false;
+	for (int i = 1;i<argc;i++) {
+		bool hasValue = (i+1 < argc);
+		if ((strcmp(argv[i], "-n") == 0) && hasValue)
+			runNo = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-r") == 0) && hasValue)
+			repetitions = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-o") == 0) && hasValue)
+			traceName = argv[++i];
+		else if (strcmp(argv[i], "-p") == 0)
+			profile = true;
+		else if ((argv[i][0] == '-') || (inputName != NULL)) {
+			usage();
+			return 1;
+		} else
+			inputName = argv[i];
+	}
+	if ((inputName == NULL) || (repetitions < 1)) {
+		usage();
+		return 1;
+	}
+
+	FILE* in = fopen(inputName, "rb");
+	if (in == NULL) {
+		perror(inputName);
+		return 1;
+	}
+	std::vector<SensorRecordingRun> runs;
+	SensorRecordingStatistics stat;
+	readSensorRecording(in, runs, stat);
+	fclose(in);
+	fprintf(stderr, "frames=%u runs=%u other frames=%u samples without header=%u\n",
+			stat.frames, (unsigned)runs.size(), stat.other, stat.orphans);
+	if ((runNo < 1) || (runNo > (int)runs.size())) {
+		fprintf(stderr, "run %d is not in the recording\n", runNo);
+		return 1;
+	}
+	const SensorRecordingRun& run = runs[runNo-1];
+	if ((run.header.version != SensorRecordingVersion) || (run.header.layoutVersion != PersistentMemLayoutVersion)) {
+		fprintf(stderr, "recording version %u/layout %u does not fit to version %u/layout %u\n",
+				run.header.version, run.header.layoutVersion, SensorRecordingVersion, PersistentMemLayoutVersion);
+		return 1;
+	}
+
+	FILE* trace = NULL;
+	if (traceName != NULL) {
+		trace = fopen(traceName, "w");
+		if (trace == NULL) {
+			perror(traceName);
+			return 1;
+		}
+		printTraceHeader(trace);
+	}
+
+	// the control code must not log, the output of the replay goes to stdout
+	hostConsole.enable(false);
+	profiler.setup();
+	profiler.reset();
+
+	size_t ticks = 0;
+	uint64_t firstHash = 0;
+	bool deterministic = true;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int r = 0;r<repetitions;r++) {
+		uint64_t hash = replayRun(run, (r == 0)?trace:NULL, ticks);
+		if (r == 0)
+			firstHash = hash;
+		else
+			deterministic = deterministic && (hash == firstHash);
+	}
+	float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	hostConsole.enable(true);
+
+	printf("replayed %u of %u ticks (%u gaps), %.2fs of balancing, %.0fns per tick\n",
+			(unsigned)ticks, (unsigned)run.samples.size(), run.gaps, ticks*SamplingTime,
+			(ticks > 0)?elapsed*1e9/(ticks*repetitions):0.0);
+	if (ticks < run.samples.size())
+		printf("replay stopped at the first gap of the recording\n");
+	if (repetitions > 1)
+		printf("%d repetitions %s\n", repetitions, deterministic?"are identical":"DIFFER");
+	if (profile)
+		profiler.print();
+
+	if (trace)
+		fclose(trace);
+	return deterministic?0:2;
+}
@@ -0,0 +1,145 @@
+/*
+ * telemetry_decode.cpp
+ *
+ * Decodes the binary telemetry stream of the bot controller (see Common/Telemetry.h) into csv,
+ * one line per balancing tick. Reads from a file, a serial device or stdin. Frames with a wrong
+ * CRC (e.g. text output in between) are skipped, gaps in the sequence number are counted as dropped
+ * frames. A summary goes to stderr.
+ *
+ * use:
+ *     stty -F /dev/ttyUSB0 230400 raw
+ *     telemetry_decode [-o output.csv] [/dev/ttyUSB0 | recording.bin]
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <Telemetry.h>
+
+static volatile bool stopRequested = false;
+
+struct DecoderStatistics {
+	uint32_t frames = 0;			// valid frames
+	uint32_t dropped = 0;			// frames missing according to the sequence number
+	uint32_t corrupt = 0;			// frames with wrong length or CRC
+	uint32_t wrongVersion = 0;		// valid frames with an unknown version
+};
+
+static void printHeader(FILE* out) {
+	fprintf(out, "sequence,time_us");
+	const char* planeName[2] = { "x", "y" };
+	for (int i = 0;i<2;i++)
+		fprintf(out, ",%s_angle,%s_angvel,%s_pos,%s_speed,%s_accel,%s_out_accel,%s_out_speed",
+				planeName[i], planeName[i], planeName[i], planeName[i], planeName[i], planeName[i], planeName[i]);
+	fprintf(out, ",omega,wheel0,wheel1,wheel2\n");
+}
+
+static void printRecord(FILE* out, const TelemetryRecord& r) {
+	fprintf(out, "%u,%u", r.sequence, r.time_us);
+	for (int i = 0;i<2;i++) {
+		const TelemetryPlane& p = r.plane[i];
+		fprintf(out, ",%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f",
+				p.angle/TelemetryAngleScale,
+				p.angularVelocity/TelemetryAngularVelocityScale,
+				p.ballPos/TelemetryPosScale,
+				p.ballSpeed/TelemetrySpeedScale,
+				p.ballAccel/TelemetryAccelScale,
+				p.outputAccel/TelemetryAccelScale,
+				p.outputSpeed/TelemetrySpeedScale);
+	}
+	fprintf(out, ",%.3f", r.omega/TelemetryOmegaScale);
+	for (int i = 0;i<3;i++)
+		fprintf(out, ",%.2f", r.wheelSpeed[i]/TelemetryWheelSpeedScale);
+	fprintf(out, "\n");
+}
+
+static void printStatistics(const DecoderStatistics& stat) {
+	uint32_t expected = stat.frames + stat.dropped;
+	fprintf(stderr, "frames=%u dropped=%u (%.2f%%) corrupt=%u wrong version=%u\n",
+			stat.frames, stat.dropped, expected?(100.0*stat.dropped/expected):0.0,
+			stat.corrupt, stat.wrongVersion);
+}
+
+static void usage() {
+	fprintf(stderr, "usage: telemetry_decode [-o output.csv] [input]\n");
+	fprintf(stderr, "       input is a file or serial device, default is stdin\n");
+}
+
+int main(int argc, char* argv[]) {
+	const char* inputName = NULL;
+	const char* outputName = NULL;
+	for (int i = 1;i<argc;i++) {
+		if ((strcmp(argv[i], "-o") == 0) && (i+1 < argc))
+			outputName = argv[++i];
+		else if ((strcmp(argv[i], "-h") == 0) || (argv[i][0] == '-' && argv[i][1] != 0)) {
+			usage();
+			return 1;
+		} else
+			inputName = argv[i];
+	}
+
+	FILE* in = (inputName == NULL)?stdin:fopen(inputName, "rb");
+	if (in == NULL) {
+		perror(inputName);
+		return 1;
+	}
+	FILE* out = (outputName == NULL)?stdout:fopen(outputName, "w");
+	if (out == NULL) {
+		perror(outputName);
+		return 1;
+	}
+
+	// stop reading a serial device with Ctrl-C, but still print the statistics
+	signal(SIGINT, [](int) { stopRequested = true; });
+
+	printHeader(out);
+
+	DecoderStatistics stat;
+	bool firstFrame = true;
+	uint16_t expectedSequence = 0;
+
+	// collect bytes between two delimiters, anything longer than a frame is garbage
+	uint8_t encoded[TelemetryMaxFrameSize];
+	size_t len = 0;
+	bool overflow = false;
+	int c;
+	while (!stopRequested && ((c = fgetc(in)) != EOF)) {
+		if (c != 0) {
+			if (len < sizeof(encoded))
+				encoded[len++] = c;
+			else
+				overflow = true;
+			continue;
+		}
+
+		// delimiter, decode what has been collected
+		if ((len > 0) || overflow) {
+			TelemetryRecord record;
+			if (!overflow && telemetryDecodeFrame(encoded, len, record)) {
+				if (record.version != TelemetryVersion)
+					stat.wrongVersion++;
+				else {
+					if (!firstFrame)
+						stat.dropped += (uint16_t)(record.sequence - expectedSequence);
+					firstFrame = false;
+					expectedSequence = record.sequence + 1;
+					stat.frames++;
+					printRecord(out, record);
+				}
+			} else
+				stat.corrupt++;
+		}
+		len = 0;
+		overflow = false;
+	}
+
+	printStatistics(stat);
+	if (in != stdin)
+		fclose(in);
+	if (out != stdout)
+		fclose(out);
+	return 0;
+}
@@ -0,0 +1,28 @@
+/*
+ * LogBridge.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#include <LogBridge.h>
+
+void LogBridge::setup(Stream* botControllerLogs, Print* logBuffer) {
+	in = botControllerLogs;
+	out = logBuffer;
+	bytes = 0;
+	lineLength = 0;
+}
+
+void LogBridge::loop() {
+	// copy log from bot ctrl to log buffer line by line
+	while (in->available()) {
+		uint8_t c = in->read();
+		line[lineLength++] = c;
+		bytes++;
+		if ((c == '\n') || (lineLength == MaxLineLength)) {
+			out->write(line, lineLength);
+			lineLength = 0;
+		}
+	}
+}
@@ -0,0 +1,38 @@
+/*
+ * LogBridge.h
+ *
+ * Copies the log of the bot controller, coming in via serial, into the log buffer that is
+ * shown on the web page. Only complete lines are copied, so the webserver's own log lines
+ * do not end up in the middle of a line of the bot controller.
+ *
+ *  Created on: 16.10.2026
+ *      Author: JochenAlt
+ */
+
+#ifndef LOGBRIDGE_H_
+#define LOGBRIDGE_H_
+
+#include <Arduino.h>
+
+class LogBridge {
+public:
+	LogBridge() {};
+	virtual ~LogBridge() {};
+
+	void setup(Stream* botControllerLogs, Print* logBuffer);
+
+	// copy all lines that came in since the last call
+	void loop();
+
+	uint32_t getBytes() { return bytes; };		// bytes received so far
+private:
+	static const int MaxLineLength = 256;		// longer lines are copied in pieces
+
+	Stream* in = NULL;
+	Print* out = NULL;
+	uint32_t bytes = 0;
+	uint8_t line[MaxLineLength];
+	int lineLength = 0;
+};
+
+#endif /* LOGBRIDGE_H_ */
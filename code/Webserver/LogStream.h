@@ -19,7 +19,7 @@ public:
 	virtual ~LogStream() {};
 
     int available(void) override { 	return size;};
-    virtual int read() override { return get(0);pop(); };
+    virtual int read() override { return (size > 0)?pop():-1; };
     virtual int peek() override { return get(0); };
     virtual int peek(int idx) { return get(idx); };
 	virtual size_t write(uint8_t c)  override {
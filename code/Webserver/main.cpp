@@ -10,6 +10,7 @@
 #include <PatternBlinker.h>
 #include <WebServer.h>
 #include <LogStream.h>
+#include <LogBridge.h>
 #include <Wire.h>
 #include <Util.h>
 #include <I2CPortScanner.h>
@@ -26,6 +27,7 @@ WebServer webserver;
 
 // receive log messages from bot controller
 HardwareSerial* botControllerLogs = NULL;
+LogBridge logBridge;
 
 // communication to bot controller
 I2CMaster* i2cMaster = new I2CMaster(&Wire);
@@ -43,6 +45,7 @@ void setup() {
 	botControllerLogs = &Serial;
 	botControllerLogs->swap();
 	botControllerLogs->begin(230400);
+	logBridge.setup(botControllerLogs, logger);
 
 	i2cMaster->setup();
 
@@ -61,10 +64,7 @@ void setup() {
 
 void subloop() {
 	// copy log from bot ctrl to log buffer
-	while (botControllerLogs->available()) {
-		char c = botControllerLogs->read();
-		logger->print(c);
-	}
+	logBridge.loop();
 
 	// carry out any pending communication
 	i2cMaster->loop();
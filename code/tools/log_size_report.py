@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# log_size_report.py
+#
+# Reports how much flash each log category of the BotController costs. The firmware is built
+# once with all categories, once with none and once without each single category. The
+# categories are switched off by writing LogBuildConfig.h (see DebugLog.h), which is removed
+# afterwards. The header is not a tracked dependency of the build, so the build is cleaned before
+# each configuration, otherwise objects of the previous configuration would be reused. The
+# Release configuration strips everything below warnings (see DebugLog.h), so the header sets
+# LOG_LEVEL_DEBUG to measure the categories with all their statements.
+# Optionally, the output of the performance log captured from the serial line is parsed for the
+# last "log cost:" line to add the share of cpu time per category.
+#
+# use:
+#     log_size_report.py --build "make -C ../BotController/Release all" \
+#                        --clean "make -C ../BotController/Release clean" \
+#                        --elf ../BotController/Release/BotController.elf \
+#                        [--size arm-none-eabi-size] [--perf-log serial.txt]
+#
+#  Created on: 16.10.2026
+#      Author: JochenAlt
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# same sequence as in DebugLog.h
+CATEGORIES = ["balance", "state", "perf", "calib", "motor", "kinematics"]
+ALL = (1 << len(CATEGORIES)) - 1
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+CONFIG_HEADER = os.path.join(HERE, "..", "BotController", "LogBuildConfig.h")
+
+
+def build(mask, args):
+    with open(CONFIG_HEADER, "w") as f:
+        f.write("// generated by tools/log_size_report.py\n")
+        f.write("#define LOG_LEVEL LOG_LEVEL_DEBUG\n")
+        f.write("#define LOG_CATEGORIES 0x%x\n" % mask)
+    # the header is not tracked by the build's dependencies, so build from scratch
+    subprocess.run(args.clean, shell=True, check=True)
+    subprocess.run(args.build, shell=True, check=True)
+    out = subprocess.run([args.size, args.elf], check=True, capture_output=True, text=True).stdout
+    # berkeley format: text data bss dec hex filename
+    text, data, bss = [int(x) for x in out.splitlines()[1].split()[:3]]
+    return text + data
+
+
+def cpu_share(perf_log):
+    share = {}
+    with open(perf_log, errors="replace") as f:
+        lines = [l for l in f if l.startswith("log cost:")]
+    if lines:
+        for name, value in re.findall(r"(\w+)(?:\(off\))?=([0-9.]+)%", lines[-1]):
+            share[name] = float(value)
+    return share
+
+
+def main():
+    parser = argparse.ArgumentParser(description="flash and cpu cost per log category")
+    parser.add_argument("--build", required=True, help="command that builds the firmware")
+    parser.add_argument("--clean", required=True,
+                        help="command that cleans the build, required since LogBuildConfig.h is not a tracked dependency")
+    parser.add_argument("--elf", required=True, help="elf file created by the build")
+    parser.add_argument("--size", default="arm-none-eabi-size", help="size tool of the toolchain")
+    parser.add_argument("--perf-log", default=None, help="captured serial output with the performance log")
+    args = parser.parse_args()
+    if not args.clean.strip():
+        parser.error("--clean must not be empty, otherwise the sizes of a stale build are reported")
+
+    try:
+        full = build(ALL, args)
+        none = build(0, args)
+        saved = {}
+        for i, name in enumerate(CATEGORIES):
+            saved[name] = full - build(ALL & ~(1 << i), args)
+    finally:
+        if os.path.exists(CONFIG_HEADER):
+            os.remove(CONFIG_HEADER)
+
+    share = cpu_share(args.perf_log) if args.perf_log else {}
+
+    print("flash with all categories : %7d bytes" % full)
+    print("flash without any category: %7d bytes (%d saved)" % (none, full - none))
+    print()
+    print("%-12s %12s %10s" % ("category", "flash saved", "cpu"))
+    for name in CATEGORIES:
+        cpu = ("%9.2f%%" % share[name]) if name in share else "         -"
+        print("%-12s %6d bytes %s" % (name, saved[name], cpu))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())